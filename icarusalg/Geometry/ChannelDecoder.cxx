@@ -0,0 +1,118 @@
+/**
+ * @file   icarusalg/Geometry/ChannelDecoder.cxx
+ * @brief  Packed per-channel snapshot of the TPC readout mapping.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/ChannelDecoder.h`
+ */
+
+// library header
+#include "icarusalg/Geometry/ChannelDecoder.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::fill()
+#include <stdexcept> // std::out_of_range
+#include <string>
+#include <cassert>
+
+
+// -----------------------------------------------------------------------------
+void icarus::ChannelDecoder::setChannels(
+  raw::ChannelID_t first, unsigned int nChannels,
+  readout::ROPID const& ropid, geo::View_t view, geo::SigType_t sigType
+) {
+  if ((first > fWords.size()) || (nChannels > fWords.size() - first)) {
+    throw std::out_of_range{
+      "icarus::ChannelDecoder: channels " + std::to_string(first)
+      + " to " + std::to_string(first + nChannels)
+      + " are not all in the table (" + std::to_string(fWords.size())
+      + " channels)"
+      };
+  }
+  auto const begin = fWords.begin() + first;
+  std::fill(begin, begin + nChannels, pack(ropid, view, sigType));
+} // icarus::ChannelDecoder::setChannels()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ChannelDecoder::words
+  (gsl::span<raw::ChannelID_t const> channels, gsl::span<Word_t> words) const
+{
+  assert(words.size() >= channels.size());
+
+  Word_t const* const table = fWords.data();
+  std::size_t const n = fWords.size();
+  std::size_t const nChannels = channels.size();
+  for (std::size_t i = 0; i < nChannels; ++i) {
+    raw::ChannelID_t const channel = channels[i];
+    words[i] = (channel < n)? table[channel]: InvalidWord;
+  }
+
+} // icarus::ChannelDecoder::words()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ChannelDecoder::decode(
+  gsl::span<raw::ChannelID_t const> channels,
+  gsl::span<geo::View_t> views,
+  gsl::span<readout::ROPID> ROPs,
+  gsl::span<readout::TPCsetID> TPCsets
+) const {
+  assert(views.empty() || (views.size() >= channels.size()));
+  assert(ROPs.empty() || (ROPs.size() >= channels.size()));
+  assert(TPCsets.empty() || (TPCsets.size() >= channels.size()));
+
+  /*
+   * Each output array is filled in its own loop, so that each loop does only
+   * one thing (the view one is a plain gather and shift); the packed table is
+   * small enough (4 bytes per channel) to stay in cache across the loops.
+   */
+  Word_t const* const table = fWords.data();
+  std::size_t const n = fWords.size();
+  std::size_t const nChannels = channels.size();
+  auto const wordOf = [table, n](raw::ChannelID_t channel)
+    { return (channel < n)? table[channel]: InvalidWord; };
+
+  if (!views.empty()) {
+    for (std::size_t i = 0; i < nChannels; ++i)
+      views[i] = viewOf(wordOf(channels[i]));
+  }
+
+  if (!ROPs.empty()) {
+    for (std::size_t i = 0; i < nChannels; ++i)
+      ROPs[i] = ROPof(wordOf(channels[i]));
+  }
+
+  if (!TPCsets.empty()) {
+    for (std::size_t i = 0; i < nChannels; ++i)
+      TPCsets[i] = TPCsetOf(wordOf(channels[i]));
+  }
+
+} // icarus::ChannelDecoder::decode()
+
+
+// -----------------------------------------------------------------------------
+auto icarus::ChannelDecoder::pack
+  (readout::ROPID const& ropid, geo::View_t view, geo::SigType_t sigType)
+  -> Word_t
+{
+  if (!ropid.isValid
+    || (ropid.Cryostat >= MaxElements) || (ropid.TPCset >= MaxElements)
+    || (ropid.ROP >= MaxElements)
+  ) {
+    throw std::out_of_range{
+      "icarus::ChannelDecoder: readout plane C:"
+      + std::to_string(ropid.Cryostat) + " S:" + std::to_string(ropid.TPCset)
+      + " R:" + std::to_string(ropid.ROP) + " can't be encoded"
+      };
+  }
+  return ValidBit
+    | static_cast<Word_t>(ropid.ROP)
+    | (static_cast<Word_t>(ropid.TPCset) << 8)
+    | (static_cast<Word_t>(ropid.Cryostat) << 16)
+    | ((static_cast<Word_t>(view) & 0xF) << 24)
+    | ((static_cast<Word_t>(sigType) & 0x3) << 28)
+    ;
+} // icarus::ChannelDecoder::pack()
+
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,222 @@
+/**
+ * @file   icarusalg/Geometry/ChannelDecoder.h
+ * @brief  Packed per-channel snapshot of the TPC readout mapping.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/ChannelDecoder.cxx`
+ */
+
+#ifndef ICARUSALG_GEOMETRY_CHANNELDECODER_H
+#define ICARUSALG_GEOMETRY_CHANNELDECODER_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C++ core guideline library
+#include "gsl/span"
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { class ChannelDecoder; }
+
+/**
+ * @brief Readout location, view and signal type of each TPC channel.
+ *
+ * The decoder is a snapshot of the channel mapping: each channel is described
+ * by a single 32-bit word, stored in an array indexed by channel number,
+ * with the following bit fields (from the least significant bit):
+ * * bits 0-7: readout plane number within the TPC set;
+ * * bits 8-15: TPC set number within the cryostat;
+ * * bits 16-23: cryostat number;
+ * * bits 24-27: view (`geo::View_t`);
+ * * bits 28-29: signal type (`geo::SigType_t`);
+ * * bit 31: set if the channel is mapped.
+ * The word of a channel not in the mapping (`InvalidWord`) has no valid bit,
+ * view `geo::kUnknown` and signal type `geo::kMysteryType`.
+ *
+ * All queries are non-virtual and inline, and they do not throw: channels out
+ * of the table are reported as not mapped. The batch `decode()` fills parallel
+ * arrays with the view, readout plane and TPC set of a whole list of channels.
+ *
+ * The decoder of the ICARUS geometry is built by
+ * `icarus::ICARUSChannelMapAlg::Initialize()` and returned by its
+ * `channelDecoder()` method. The results are the same as the ones of
+ * `ChannelToROP()`, `View()` and `SignalTypeForChannel()` of the channel
+ * mapping.
+ */
+class icarus::ChannelDecoder {
+
+    public:
+
+  using Word_t = std::uint32_t; ///< Type of the packed channel description.
+
+  /// Bit mask of the flag marking a mapped channel.
+  static constexpr Word_t ValidBit = Word_t{ 1 } << 31;
+
+  /// Word describing a channel which is not mapped.
+  static constexpr Word_t InvalidWord
+    = (Word_t{ 0xFF } << 0) | (Word_t{ 0xFF } << 8) | (Word_t{ 0xFF } << 16)
+    | (static_cast<Word_t>(geo::kUnknown) << 24)
+    | (static_cast<Word_t>(geo::kMysteryType) << 28)
+    ;
+
+  /// Largest number of cryostats, TPC sets per cryostat or ROPs per TPC set.
+  static constexpr unsigned int MaxElements = 0xFF;
+
+
+  /// Constructor: no channel is mapped.
+  ChannelDecoder() = default;
+
+  /// Constructor: `nChannels` channels, none of them mapped yet.
+  explicit ChannelDecoder(raw::ChannelID_t nChannels)
+    : fWords(nChannels, InvalidWord) {}
+
+
+  // --- BEGIN -- Filling ------------------------------------------------------
+  /**
+   * @brief Maps a range of channels to the same readout plane.
+   * @param first the first channel of the range
+   * @param nChannels the number of channels in the range
+   * @param ropid ID of the readout plane of all the channels in the range
+   * @param view the view of all the channels in the range
+   * @param sigType the signal type of all the channels in the range
+   * @throw std::out_of_range if the range exceeds the number of channels,
+   *                          or the readout plane ID does not fit the word
+   */
+  void setChannels(
+    raw::ChannelID_t first, unsigned int nChannels,
+    readout::ROPID const& ropid, geo::View_t view, geo::SigType_t sigType
+    );
+  // --- END ---- Filling ------------------------------------------------------
+
+
+  // --- BEGIN -- Single channel queries ---------------------------------------
+  /// Returns the number of channels in the table.
+  std::size_t nChannels() const { return fWords.size(); }
+
+  /// Returns the packed description of `channel` (`InvalidWord` if none).
+  Word_t word(raw::ChannelID_t channel) const
+    { return (channel < fWords.size())? fWords[channel]: InvalidWord; }
+
+  /// Returns whether `channel` is mapped.
+  bool hasChannel(raw::ChannelID_t channel) const
+    { return isValid(word(channel)); }
+
+  /// Returns the ID of the readout plane of `channel` (invalid if none).
+  readout::ROPID ROP(raw::ChannelID_t channel) const
+    { return ROPof(word(channel)); }
+
+  /// Returns the ID of the TPC set of `channel` (invalid if none).
+  readout::TPCsetID TPCset(raw::ChannelID_t channel) const
+    { return TPCsetOf(word(channel)); }
+
+  /// Returns the view of `channel` (`geo::kUnknown` if none).
+  geo::View_t view(raw::ChannelID_t channel) const
+    { return viewOf(word(channel)); }
+
+  /// Returns the signal type of `channel` (`geo::kMysteryType` if none).
+  geo::SigType_t signalType(raw::ChannelID_t channel) const
+    { return signalTypeOf(word(channel)); }
+  // --- END ---- Single channel queries ---------------------------------------
+
+
+  // --- BEGIN -- Batch queries ------------------------------------------------
+  /**
+   * @brief Copies the packed description of each of the `channels`.
+   * @param channels the channels to be decoded
+   * @param[out] words the packed description of each channel
+   *
+   * The output `words` must be as large as the input.
+   */
+  void words
+    (gsl::span<raw::ChannelID_t const> channels, gsl::span<Word_t> words) const;
+
+  /**
+   * @brief Decodes the view and readout location of each of the `channels`.
+   * @param channels the channels to be decoded
+   * @param[out] views the view of each channel
+   * @param[out] ROPs the ID of the readout plane of each channel
+   * @param[out] TPCsets the ID of the TPC set of each channel
+   *
+   * The output arrays must be as large as the input, or empty, in which case
+   * that information is not extracted. Channels which are not mapped get
+   * `geo::kUnknown` view and invalid readout plane and TPC set IDs.
+   */
+  void decode(
+    gsl::span<raw::ChannelID_t const> channels,
+    gsl::span<geo::View_t> views,
+    gsl::span<readout::ROPID> ROPs,
+    gsl::span<readout::TPCsetID> TPCsets
+    ) const;
+  // --- END ---- Batch queries ------------------------------------------------
+
+
+  // --- BEGIN -- Word decoding ------------------------------------------------
+  /// Returns whether the `word` describes a mapped channel.
+  static constexpr bool isValid(Word_t word) { return (word & ValidBit) != 0; }
+
+  /// Returns the view stored in `word`.
+  static constexpr geo::View_t viewOf(Word_t word)
+    { return static_cast<geo::View_t>((word >> 24) & 0xF); }
+
+  /// Returns the signal type stored in `word`.
+  static constexpr geo::SigType_t signalTypeOf(Word_t word)
+    { return static_cast<geo::SigType_t>((word >> 28) & 0x3); }
+
+  /// Returns the ID of the TPC set stored in `word` (invalid if not mapped).
+  static readout::TPCsetID TPCsetOf(Word_t word)
+    {
+      return isValid(word)
+        ? readout::TPCsetID{ cryostatNo(word), TPCsetNo(word) }
+        : readout::TPCsetID{};
+    }
+
+  /// Returns the ID of the readout plane stored in `word` (invalid if none).
+  static readout::ROPID ROPof(Word_t word)
+    {
+      return isValid(word)
+        ? readout::ROPID{ cryostatNo(word), TPCsetNo(word), ROPNo(word) }
+        : readout::ROPID{};
+    }
+
+  /// Returns the word describing a channel with the specified properties.
+  /// @throw std::out_of_range if the readout plane ID does not fit the word
+  static Word_t pack
+    (readout::ROPID const& ropid, geo::View_t view, geo::SigType_t sigType);
+  // --- END ---- Word decoding ------------------------------------------------
+
+
+    private:
+
+  using CryostatNo_t = readout::CryostatID::CryostatID_t;
+  using TPCsetNo_t = readout::TPCsetID::TPCsetID_t;
+  using ROPNo_t = readout::ROPID::ROPID_t;
+
+  std::vector<Word_t> fWords; ///< Packed description, indexed by channel.
+
+
+  /// Returns the cryostat number stored in `word`.
+  static constexpr CryostatNo_t cryostatNo(Word_t word)
+    { return static_cast<CryostatNo_t>((word >> 16) & 0xFF); }
+
+  /// Returns the TPC set number stored in `word`.
+  static constexpr TPCsetNo_t TPCsetNo(Word_t word)
+    { return static_cast<TPCsetNo_t>((word >> 8) & 0xFF); }
+
+  /// Returns the readout plane number stored in `word`.
+  static constexpr ROPNo_t ROPNo(Word_t word)
+    { return static_cast<ROPNo_t>(word & 0xFF); }
+
+}; // icarus::ChannelDecoder
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // ICARUSALG_GEOMETRY_CHANNELDECODER_H
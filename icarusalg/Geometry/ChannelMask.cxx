@@ -0,0 +1,125 @@
+/**
+ * @file   icarusalg/Geometry/ChannelMask.cxx
+ * @brief  Dense set of TPC channels with summaries by readout structure.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/ChannelMask.h`
+ */
+
+// library header
+#include "icarusalg/Geometry/ChannelMask.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <bitset>
+#include <stdexcept> // std::out_of_range
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  /// Returns the number of set bits in `word`.
+  template <typename Word>
+  unsigned int countBits(Word word)
+    { return std::bitset<sizeof(Word) * 8U>(word).count(); }
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+icarus::ChannelMask::ChannelMask(ChannelMaskLayout const& layout)
+  : fEndChannel{ layout.endChannel }
+  , fBits((layout.endChannel + BitsPerWord - 1) / BitsPerWord, Word_t{ 0 })
+{
+  //
+  // size the summary containers so that all elements in the layout fit
+  //
+  unsigned int nCryostats = 0U, nTPCsets = 0U, nROPs = 0U;
+  for (ChannelMaskLayout::ROPInfo_t const& ROP: layout.ROPs) {
+    nCryostats = std::max(nCryostats, ROP.ID.Cryostat + 1U);
+    nTPCsets = std::max(nTPCsets, ROP.ID.TPCset + 1U);
+    nROPs = std::max(nROPs, ROP.ID.ROP + 1U);
+  }
+  fROPcounts.resize(nCryostats, nTPCsets, nROPs, 0U);
+  fTPCsetCounts.resize(nCryostats, nTPCsets, 0U);
+
+  unsigned int nPlaneCryostats = 0U, nTPCs = 0U, nPlanes = 0U;
+  for (ChannelMaskLayout::PlaneInfo_t const& plane: layout.planes) {
+    nPlaneCryostats = std::max(nPlaneCryostats, plane.ID.Cryostat + 1U);
+    nTPCs = std::max(nTPCs, plane.ID.TPC + 1U);
+    nPlanes = std::max(nPlanes, plane.ID.Plane + 1U);
+  }
+  fPlaneCounts.resize(nPlaneCryostats, nTPCs, nPlanes, 0U);
+
+} // icarus::ChannelMask::ChannelMask()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ChannelMask::setChannel(raw::ChannelID_t channel) {
+  if (channel >= fEndChannel) {
+    throw std::out_of_range{
+      "icarus::ChannelMask: channel " + std::to_string(channel)
+      + " is not in the detector (" + std::to_string(fEndChannel)
+      + " channels)"
+      };
+  }
+  fBits[channel / BitsPerWord] |= Word_t{ 1 } << (channel % BitsPerWord);
+} // icarus::ChannelMask::setChannel()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ChannelMask::setChannels
+  (raw::ChannelID_t first, raw::ChannelID_t end)
+{
+  if (first >= end) return;
+  setChannel(end - 1); // checks the range
+  for (raw::ChannelID_t channel = first; channel < end; ++channel)
+    fBits[channel / BitsPerWord] |= Word_t{ 1 } << (channel % BitsPerWord);
+} // icarus::ChannelMask::setChannels()
+
+
+// -----------------------------------------------------------------------------
+unsigned int icarus::ChannelMask::countRange
+  (raw::ChannelID_t first, raw::ChannelID_t end) const
+{
+  end = std::min(end, fEndChannel);
+  if (first >= end) return 0U;
+
+  std::size_t const firstWord = first / BitsPerWord;
+  std::size_t const lastWord = (end - 1) / BitsPerWord;
+
+  // masks of the bits in range within the first and the last words
+  Word_t const firstMask = ~Word_t{ 0 } << (first % BitsPerWord);
+  Word_t const lastMask
+    = ~Word_t{ 0 } >> (BitsPerWord - 1 - (end - 1) % BitsPerWord);
+
+  if (firstWord == lastWord)
+    return countBits(fBits[firstWord] & firstMask & lastMask);
+
+  unsigned int n = countBits(fBits[firstWord] & firstMask);
+  for (std::size_t iWord = firstWord + 1; iWord < lastWord; ++iWord)
+    n += countBits(fBits[iWord]);
+  return n + countBits(fBits[lastWord] & lastMask);
+
+} // icarus::ChannelMask::countRange()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ChannelMask::fillSummaries(ChannelMaskLayout const& layout) {
+
+  fNMasked = countRange(0, fEndChannel);
+
+  // TPC set counts are the sum of the ones of their ROPs
+  for (ChannelMaskLayout::ROPInfo_t const& ROP: layout.ROPs) {
+    unsigned int const n = countRange(ROP.firstChannel, ROP.endChannel);
+    fROPcounts[ROP.ID] = n;
+    fTPCsetCounts[ROP.ID] += n;
+  } // for ROPs
+
+  for (ChannelMaskLayout::PlaneInfo_t const& plane: layout.planes)
+    fPlaneCounts[plane.ID] = countRange(plane.firstChannel, plane.endChannel);
+
+} // icarus::ChannelMask::fillSummaries()
+
+
+// -----------------------------------------------------------------------------
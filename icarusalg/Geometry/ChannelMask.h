@@ -0,0 +1,321 @@
+/**
+ * @file   icarusalg/Geometry/ChannelMask.h
+ * @brief  Dense set of TPC channels with summaries by readout structure.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/ChannelMask.cxx`
+ */
+
+#ifndef ICARUSALG_GEOMETRY_CHANNELMASK_H
+#define ICARUSALG_GEOMETRY_CHANNELMASK_H
+
+// ICARUS libraries
+#include "icarusalg/Utilities/IntegerRanges.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryDataContainers.h"
+#include "larcorealg/Geometry/ReadoutDataContainers.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <algorithm> // std::minmax()
+#include <vector>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+
+
+// -----------------------------------------------------------------------------
+namespace icarus {
+
+  struct ChannelMaskLayout;
+  class ChannelMask;
+
+  /**
+   * @brief Extracts the readout layout for `ChannelMask` from a geometry.
+   * @tparam Geometry type of geometry service provider
+   * @param geom geometry service provider (`geo::GeometryCore` interface)
+   * @return the channel ranges of all readout planes and wire planes
+   *
+   * The channel range of each wire plane is the one between the channels of
+   * its first and last wire.
+   */
+  template <typename Geometry>
+  ChannelMaskLayout makeChannelMaskLayout(Geometry const& geom);
+
+} // namespace icarus
+
+
+// -----------------------------------------------------------------------------
+/// Channel ranges of the readout planes and of the wire planes of a detector.
+struct icarus::ChannelMaskLayout {
+
+  /// Range of channels of a readout plane.
+  struct ROPInfo_t {
+    readout::ROPID ID; ///< ID of the readout plane.
+    raw::ChannelID_t firstChannel; ///< First channel of the readout plane.
+    raw::ChannelID_t endChannel; ///< Channel after the last one.
+  }; // ROPInfo_t
+
+  /// Range of channels of a wire plane.
+  struct PlaneInfo_t {
+    geo::PlaneID ID; ///< ID of the wire plane.
+    raw::ChannelID_t firstChannel; ///< First channel of the wire plane.
+    raw::ChannelID_t endChannel; ///< Channel after the last one.
+  }; // PlaneInfo_t
+
+  raw::ChannelID_t endChannel = 0; ///< The first channel not in the detector.
+
+  std::vector<ROPInfo_t> ROPs; ///< All readout planes.
+
+  std::vector<PlaneInfo_t> planes; ///< All wire planes.
+
+}; // icarus::ChannelMaskLayout
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief A set of TPC channels, with summaries by ROP, TPC set and plane.
+ *
+ * The mask is a bit set over all the channels of the detector (e.g. the bad
+ * channels, or the noisy ones). On construction, the number of masked channels
+ * in each readout plane, TPC set and wire plane is counted, so that queries at
+ * those levels take constant time.
+ * Channels which are shared by two wire planes count for both of them.
+ *
+ * The test of the channels of a whole collection (e.g. of all the hits in an
+ * event) is supported by `countMasked()` and `flagMasked()`.
+ *
+ * Example of masking bad channels, from a list of channels:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * icarus::ChannelMask const badChannels{
+ *   icarus::makeChannelMaskLayout(geom),
+ *   icarus::makeIntegerRanges(badChannelList)
+ *   };
+ *
+ * std::vector<raw::ChannelID_t> hitChannels; // ...
+ * std::vector<char> isBad(hitChannels.size());
+ * badChannels.flagMasked(hitChannels.begin(), hitChannels.end(), isBad.begin());
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Channels that do not belong to the detector layout are never masked,
+ * and elements which are not in the layout contain no masked channel.
+ */
+class icarus::ChannelMask {
+
+    public:
+
+  /// Constructor: mask with no channel.
+  ChannelMask(ChannelMaskLayout const& layout);
+
+  /**
+   * @brief Constructor: masks all the `channels`.
+   * @tparam T type of channel numbers in the ranges
+   * @tparam CheckGrowing (ignored)
+   * @param layout the ranges of channels of ROPs and planes
+   * @param channels the channels to be masked
+   * @throw std::out_of_range if any channel is not in the detector
+   */
+  template <typename T, bool CheckGrowing>
+  ChannelMask(
+    ChannelMaskLayout const& layout,
+    icarus::IntegerRanges<T, CheckGrowing> const& channels
+    );
+
+  /**
+   * @brief Constructor: masks all the channels in a sequence.
+   * @tparam BIter type of iterator to the channels
+   * @tparam EIter type of end iterator to the channels
+   * @param layout the ranges of channels of ROPs and planes
+   * @param begin iterator to the first channel to be masked
+   * @param end iterator after the last channel to be masked
+   * @throw std::out_of_range if any channel is not in the detector
+   *
+   * The channels do not need to be sorted, and duplicates are allowed.
+   */
+  template <typename BIter, typename EIter>
+  ChannelMask(ChannelMaskLayout const& layout, BIter begin, EIter end);
+
+
+  // --- BEGIN -- Single channel queries ---------------------------------------
+  /// Returns the number of channels in the detector.
+  unsigned int nChannels() const { return fEndChannel; }
+
+  /// Returns whether `channel` is masked.
+  bool isMasked(raw::ChannelID_t channel) const
+    {
+      return (channel < fEndChannel)
+        && ((fBits[channel / BitsPerWord] >> (channel % BitsPerWord)) & 1U);
+    }
+  // --- END ---- Single channel queries ---------------------------------------
+
+
+  // --- BEGIN -- Summaries ----------------------------------------------------
+  /// Returns the total number of masked channels.
+  unsigned int nMasked() const { return fNMasked; }
+
+  /// Returns the number of masked channels in the readout plane `ropid`.
+  unsigned int nMasked(readout::ROPID const& ropid) const
+    { return fROPcounts.hasROP(ropid)? fROPcounts[ropid]: 0U; }
+
+  /// Returns the number of masked channels in the TPC set `tpcsetid`.
+  unsigned int nMasked(readout::TPCsetID const& tpcsetid) const
+    { return fTPCsetCounts.hasTPCset(tpcsetid)? fTPCsetCounts[tpcsetid]: 0U; }
+
+  /// Returns the number of masked channels connected to wires of `planeid`.
+  unsigned int nMasked(geo::PlaneID const& planeid) const
+    { return fPlaneCounts.hasPlane(planeid)? fPlaneCounts[planeid]: 0U; }
+
+  /// Returns whether any channel is masked.
+  bool anyMasked() const { return nMasked() > 0U; }
+
+  /// Returns whether any channel in `ropid` is masked.
+  bool anyMasked(readout::ROPID const& ropid) const
+    { return nMasked(ropid) > 0U; }
+
+  /// Returns whether any channel in `tpcsetid` is masked.
+  bool anyMasked(readout::TPCsetID const& tpcsetid) const
+    { return nMasked(tpcsetid) > 0U; }
+
+  /// Returns whether any channel connected to wires of `planeid` is masked.
+  bool anyMasked(geo::PlaneID const& planeid) const
+    { return nMasked(planeid) > 0U; }
+  // --- END ---- Summaries ----------------------------------------------------
+
+
+  // --- BEGIN -- Collection queries -------------------------------------------
+  /// Returns how many of the channels in `[ begin, end [` are masked.
+  template <typename BIter, typename EIter>
+  std::size_t countMasked(BIter begin, EIter end) const;
+
+  /**
+   * @brief Writes whether each of the channels is masked.
+   * @param begin iterator to the first channel to test
+   * @param end iterator after the last channel to test
+   * @param out iterator to the first of the output flags
+   * @return iterator after the last written flag
+   *
+   * A flag is written into `out` for each of the channels in the input range,
+   * in the same order (the flags must be assignable from `bool`).
+   */
+  template <typename BIter, typename EIter, typename OIter>
+  OIter flagMasked(BIter begin, EIter end, OIter out) const;
+  // --- END ---- Collection queries -------------------------------------------
+
+
+    private:
+
+  using Word_t = std::uint64_t; ///< Type of storage of the mask bits.
+
+  /// Number of channels in each `Word_t`.
+  static constexpr unsigned int BitsPerWord = sizeof(Word_t) * 8U;
+
+  raw::ChannelID_t fEndChannel = 0; ///< The first channel not in the mask.
+
+  std::vector<Word_t> fBits; ///< One bit per channel.
+
+  unsigned int fNMasked = 0U; ///< Total number of masked channels.
+
+  /// Number of masked channels in each readout plane.
+  readout::ROPDataContainer<unsigned int> fROPcounts;
+
+  /// Number of masked channels in each TPC set.
+  readout::TPCsetDataContainer<unsigned int> fTPCsetCounts;
+
+  /// Number of masked channels in each wire plane.
+  geo::PlaneDataContainer<unsigned int> fPlaneCounts;
+
+
+  /// Adds `channel` to the mask (no summaries update).
+  void setChannel(raw::ChannelID_t channel);
+
+  /// Adds the channels `[ first, end [` to the mask (no summaries update).
+  void setChannels(raw::ChannelID_t first, raw::ChannelID_t end);
+
+  /// Returns the number of masked channels in `[ first, end [`.
+  unsigned int countRange(raw::ChannelID_t first, raw::ChannelID_t end) const;
+
+  /// Fills all the summaries from the current mask.
+  void fillSummaries(ChannelMaskLayout const& layout);
+
+}; // icarus::ChannelMask
+
+
+// -----------------------------------------------------------------------------
+// ---  Template implementation
+// -----------------------------------------------------------------------------
+template <typename Geometry>
+auto icarus::makeChannelMaskLayout(Geometry const& geom) -> ChannelMaskLayout {
+
+  ChannelMaskLayout layout;
+  layout.endChannel = geom.Nchannels();
+
+  for (readout::ROPID const& ropid: geom.IterateROPIDs()) {
+
+    raw::ChannelID_t const firstROPchannel = geom.FirstChannelInROP(ropid);
+    layout.ROPs.push_back
+      ({ ropid, firstROPchannel, firstROPchannel + geom.Nchannels(ropid) });
+
+    for (geo::PlaneID const& planeid: geom.ROPtoWirePlanes(ropid)) {
+      unsigned int const nWires = geom.Nwires(planeid);
+      if (nWires == 0) continue;
+      auto const [ first, last ] = std::minmax(
+        geom.PlaneWireToChannel(geo::WireID{ planeid, 0U }),
+        geom.PlaneWireToChannel(geo::WireID{ planeid, nWires - 1U })
+        );
+      layout.planes.push_back({ planeid, first, last + 1 });
+    } // for planes
+
+  } // for ROPs
+
+  return layout;
+} // icarus::makeChannelMaskLayout()
+
+
+// -----------------------------------------------------------------------------
+template <typename T, bool CheckGrowing>
+icarus::ChannelMask::ChannelMask(
+  ChannelMaskLayout const& layout,
+  icarus::IntegerRanges<T, CheckGrowing> const& channels
+)
+  : ChannelMask{ layout }
+{
+  for (auto const& range: channels.ranges())
+    setChannels(range.lower, range.upper);
+  fillSummaries(layout);
+} // icarus::ChannelMask::ChannelMask(IntegerRanges)
+
+
+// -----------------------------------------------------------------------------
+template <typename BIter, typename EIter>
+icarus::ChannelMask::ChannelMask
+  (ChannelMaskLayout const& layout, BIter begin, EIter end)
+  : ChannelMask{ layout }
+{
+  for (; begin != end; ++begin) setChannel(*begin);
+  fillSummaries(layout);
+} // icarus::ChannelMask::ChannelMask(BIter, EIter)
+
+
+// -----------------------------------------------------------------------------
+template <typename BIter, typename EIter>
+std::size_t icarus::ChannelMask::countMasked(BIter begin, EIter end) const {
+  std::size_t n = 0;
+  for (; begin != end; ++begin) n += isMasked(*begin);
+  return n;
+} // icarus::ChannelMask::countMasked()
+
+
+// -----------------------------------------------------------------------------
+template <typename BIter, typename EIter, typename OIter>
+OIter icarus::ChannelMask::flagMasked(BIter begin, EIter end, OIter out) const
+{
+  for (; begin != end; ++begin, ++out) *out = isMasked(*begin);
+  return out;
+} // icarus::ChannelMask::flagMasked()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // ICARUSALG_GEOMETRY_CHANNELMASK_H
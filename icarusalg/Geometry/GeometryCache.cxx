@@ -0,0 +1,224 @@
+/**
+ * @file   icarusalg/Geometry/GeometryCache.cxx
+ * @brief  Binary (ROOT) cache of a GDML geometry description.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/GeometryCache.h`
+ */
+
+// library header
+#include "icarusalg/Geometry/GeometryCache.h"
+
+// framework libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+#include "cetlib_except/exception.h" // cet::exception
+
+// ROOT libraries
+#include "TGeoManager.h"
+#include "TFile.h"
+#include "TNamed.h"
+
+// POSIX libraries
+#include <sys/mman.h> // mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <fcntl.h> // open()
+#include <unistd.h> // close(), access()
+
+// C/C++ standard libraries
+#include <memory> // std::unique_ptr
+#include <cstdint> // std::uint64_t
+#include <cstdio> // std::snprintf()
+#include <cstring> // std::strerror()
+#include <cerrno>
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  /// Name of the object storing the checksum of the source GDML.
+  constexpr char const* ChecksumKey = "GDMLchecksum";
+
+  /// Name of the object storing the path of the source GDML.
+  constexpr char const* SourceKey = "GDMLsource";
+
+
+  /// 64-bit FNV-1a hash of a memory buffer.
+  std::uint64_t FNV1a64(unsigned char const* data, std::size_t size) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < size; ++i) {
+      hash ^= data[i];
+      hash *= 0x100000001b3ULL;
+    }
+    return hash;
+  } // FNV1a64()
+
+
+  /// Read-only memory map of a whole file, released on destruction.
+  class MappedFile {
+
+      public:
+
+    MappedFile(std::string const& path)
+      {
+        int const fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw error(path, "open");
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+          int const err = errno;
+          ::close(fd);
+          errno = err;
+          throw error(path, "inspect");
+        }
+        fSize = static_cast<std::size_t>(info.st_size);
+        if (fSize > 0) {
+          void* const data
+            = ::mmap(nullptr, fSize, PROT_READ, MAP_PRIVATE, fd, 0);
+          if (data == MAP_FAILED) {
+            int const err = errno;
+            ::close(fd);
+            errno = err;
+            throw error(path, "map");
+          }
+          fData = static_cast<unsigned char const*>(data);
+          ::madvise(data, fSize, MADV_SEQUENTIAL);
+        }
+        ::close(fd); // the mapping stays valid
+      }
+
+    ~MappedFile()
+      { if (fData) ::munmap(const_cast<unsigned char*>(fData), fSize); }
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator= (MappedFile const&) = delete;
+
+    unsigned char const* data() const { return fData; }
+    std::size_t size() const { return fSize; }
+
+      private:
+
+    unsigned char const* fData = nullptr;
+    std::size_t fSize = 0U;
+
+    static cet::exception error(std::string const& path, char const* action)
+      {
+        return cet::exception("GeometryCache")
+          << "Failed to " << action << " file '" << path << "': "
+          << std::strerror(errno) << "\n";
+      }
+
+  }; // class MappedFile
+
+
+  /// Reads the title of the `TNamed` object `key` from `file` (empty if none).
+  std::string readTitle(TFile& file, char const* key) {
+    std::unique_ptr<TNamed> const obj { file.Get<TNamed>(key) };
+    return obj? std::string{ obj->GetTitle() }: std::string{};
+  } // readTitle()
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+std::string icarus::geo::fileChecksum(std::string const& path) {
+
+  MappedFile const file { path };
+  std::uint64_t const hash = FNV1a64(file.data(), file.size());
+
+  char buffer[17];
+  std::snprintf(buffer, sizeof(buffer), "%016llx",
+    static_cast<unsigned long long>(hash));
+  return buffer;
+
+} // icarus::geo::fileChecksum()
+
+
+// -----------------------------------------------------------------------------
+TGeoManager* icarus::geo::writeGeometryCache
+  (std::string const& gdmlPath, std::string const& cachePath)
+{
+  std::string const checksum = fileChecksum(gdmlPath);
+
+  TGeoManager* const geoManager = TGeoManager::Import(gdmlPath.c_str());
+  if (!geoManager) {
+    throw cet::exception("GeometryCache")
+      << "Failed to import the geometry from '" << gdmlPath << "'\n";
+  }
+
+  std::unique_ptr<TFile> file { TFile::Open(cachePath.c_str(), "RECREATE") };
+  if (!file || file->IsZombie()) {
+    throw cet::exception("GeometryCache")
+      << "Failed to create the geometry cache file '" << cachePath << "'\n";
+  }
+
+  TNamed const checksumObj { ChecksumKey, checksum.c_str() };
+  TNamed const sourceObj { SourceKey, gdmlPath.c_str() };
+  file->WriteTObject(geoManager);
+  file->WriteTObject(&checksumObj);
+  file->WriteTObject(&sourceObj);
+  file->Close();
+
+  mf::LogInfo("GeometryCache")
+    << "Geometry from '" << gdmlPath << "' (checksum: " << checksum
+    << ") cached into '" << cachePath << "'.";
+
+  return geoManager;
+} // icarus::geo::writeGeometryCache()
+
+
+// -----------------------------------------------------------------------------
+auto icarus::geo::readGeometryCacheInfo(std::string const& cachePath)
+  -> GeometryCacheInfo
+{
+  if (::access(cachePath.c_str(), R_OK) != 0) return {}; // no cache file
+
+  std::unique_ptr<TFile> file { TFile::Open(cachePath.c_str(), "READ") };
+  if (!file || file->IsZombie()) return {};
+
+  return { readTitle(*file, SourceKey), readTitle(*file, ChecksumKey) };
+
+} // icarus::geo::readGeometryCacheInfo()
+
+
+// -----------------------------------------------------------------------------
+bool icarus::geo::isGeometryCacheValid
+  (std::string const& cachePath, std::string const& gdmlPath)
+{
+  GeometryCacheInfo const info = readGeometryCacheInfo(cachePath);
+  return info.valid() && (info.checksum == fileChecksum(gdmlPath));
+} // icarus::geo::isGeometryCacheValid()
+
+
+// -----------------------------------------------------------------------------
+TGeoManager* icarus::geo::importGeometry(
+  std::string const& gdmlPath, std::string const& cachePath,
+  GeometrySource* source /* = nullptr */
+) {
+  if (!cachePath.empty()) {
+    if (isGeometryCacheValid(cachePath, gdmlPath)) {
+      TGeoManager* const geoManager = TGeoManager::Import(cachePath.c_str());
+      if (geoManager) {
+        if (source) *source = GeometrySource::Cache;
+        return geoManager;
+      }
+      mf::LogWarning("GeometryCache")
+        << "Failed to import the geometry from cache '" << cachePath
+        << "', falling back to '" << gdmlPath << "'.";
+    }
+    else {
+      mf::LogWarning("GeometryCache")
+        << "Geometry cache '" << cachePath
+        << "' is not a cache of the current '" << gdmlPath << "': ignored.";
+    }
+  } // if cache
+
+  TGeoManager* const geoManager = TGeoManager::Import(gdmlPath.c_str());
+  if (!geoManager) {
+    throw cet::exception("GeometryCache")
+      << "Failed to import the geometry from '" << gdmlPath << "'\n";
+  }
+  if (source) *source = GeometrySource::GDML;
+  return geoManager;
+
+} // icarus::geo::importGeometry()
+
+
+// -----------------------------------------------------------------------------
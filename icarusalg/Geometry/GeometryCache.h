@@ -0,0 +1,132 @@
+/**
+ * @file   icarusalg/Geometry/GeometryCache.h
+ * @brief  Binary (ROOT) cache of a GDML geometry description.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/GeometryCache.cxx`
+ */
+
+#ifndef ICARUSALG_GEOMETRY_GEOMETRYCACHE_H
+#define ICARUSALG_GEOMETRY_GEOMETRYCACHE_H
+
+// C/C++ standard libraries
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+class TGeoManager; // ROOT
+
+/**
+ * @brief Utilities for binary caches of GDML geometry files.
+ *
+ * Parsing a full ICARUS GDML file (tens of MB of XML, most of it wire volumes)
+ * is a noticeable part of the start up of every job. A geometry cache is a ROOT
+ * file with the complete `TGeoManager` built from a GDML file, which ROOT reads
+ * back directly into the geometry tree (materials, shapes, volumes and
+ * placements) without any XML parsing.
+ *
+ * Each cache also stores the checksum of the GDML file it was created from,
+ * so that a stale cache (the GDML file changed after the cache was created)
+ * can be detected and ignored.
+ *
+ * The cache of a GDML file is created by `writeGeometryCache()`, e.g. with the
+ * `makeGeometryCache.C` ROOT macro in the `gdml` directory.
+ * `importGeometry()` loads the geometry from the cache when it is valid, and
+ * from the GDML file otherwise.
+ * A cache file can also be directly used as `ROOT` file in the configuration
+ * of the LArSoft `Geometry` service (in which case no checksum check is done).
+ */
+namespace icarus::geo {
+
+  /// Where a geometry was imported from.
+  enum class GeometrySource {
+    GDML, ///< Parsed from the GDML file.
+    Cache ///< Read from the geometry cache file.
+  }; // GeometrySource
+
+
+  /// Information stored in a geometry cache file about its source.
+  struct GeometryCacheInfo {
+
+    std::string sourcePath; ///< Path of the GDML file the cache was made from.
+    std::string checksum; ///< Checksum of the source GDML file.
+
+    /// Returns whether the information is available.
+    bool valid() const { return !checksum.empty(); }
+
+  }; // GeometryCacheInfo
+
+
+  /**
+   * @brief Returns the checksum of the content of a file.
+   * @param path path of the file
+   * @return a checksum of the file content, as hexadecimal string
+   * @throw cet::exception (category: `"GeometryCache"`) if file can't be read
+   *
+   * The file is memory-mapped and its content checksummed in a single pass.
+   * The checksum (64-bit FNV-1a) is meant to detect changes of the file, not
+   * malicious tampering.
+   */
+  std::string fileChecksum(std::string const& path);
+
+
+  /**
+   * @brief Creates a geometry cache file from a GDML file.
+   * @param gdmlPath path of the GDML file to be cached
+   * @param cachePath path of the ROOT cache file to be written
+   * @return the geometry manager imported from `gdmlPath`
+   * @throw cet::exception (category: `"GeometryCache"`) on any failure
+   *
+   * The geometry is imported from the GDML file (the imported geometry becomes
+   * the current `gGeoManager`) and written into `cachePath`, overwriting it,
+   * together with the checksum and path of the source GDML file.
+   */
+  TGeoManager* writeGeometryCache
+    (std::string const& gdmlPath, std::string const& cachePath);
+
+
+  /**
+   * @brief Reads the information about the source of a geometry cache.
+   * @param cachePath path of the ROOT cache file
+   * @return the information, not `valid()` if not available
+   *
+   * If the file can't be opened or it is not a geometry cache, the returned
+   * information is empty.
+   */
+  GeometryCacheInfo readGeometryCacheInfo(std::string const& cachePath);
+
+
+  /**
+   * @brief Returns whether `cachePath` is a cache of the current `gdmlPath`.
+   * @param cachePath path of the ROOT cache file
+   * @param gdmlPath path of the GDML file
+   * @return whether the cache was created from the current content of GDML
+   * @throw cet::exception (category: `"GeometryCache"`) if GDML can't be read
+   */
+  bool isGeometryCacheValid
+    (std::string const& cachePath, std::string const& gdmlPath);
+
+
+  /**
+   * @brief Imports a geometry, from its cache when possible.
+   * @param gdmlPath path of the GDML file of the geometry
+   * @param cachePath path of the ROOT cache file (none if empty)
+   * @param[out] source (if not null) set to where the geometry was read from
+   * @return the geometry manager with the geometry (`gGeoManager`)
+   * @throw cet::exception (category: `"GeometryCache"`) if import fails
+   *
+   * If `cachePath` is a valid cache of `gdmlPath` (`isGeometryCacheValid()`),
+   * the geometry is read from the cache, otherwise it is parsed from the GDML
+   * file. A stale or unreadable cache is neither used nor updated.
+   */
+  TGeoManager* importGeometry(
+    std::string const& gdmlPath, std::string const& cachePath,
+    GeometrySource* source = nullptr
+    );
+
+} // namespace icarus::geo
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // ICARUSALG_GEOMETRY_GEOMETRYCACHE_H
@@ -33,10 +33,9 @@
 #include <vector>
 #include <array>
 #include <set>
-#include <algorithm> // std::transform(), std::find()
+#include <algorithm> // std::transform(), std::find(), std::sort(), std::min()...
 #include <utility> // std::move()
 #include <iterator> // std::back_inserter()
-#include <functional> // std::mem_fn()
 #include <tuple>
 
 
@@ -93,8 +92,16 @@ void icarus::ICARUSChannelMapAlg::Initialize(geo::GeometryData_t const& geodata)
   
   buildReadoutPlanes(geodata.cryostats);
   
+  buildReadoutIDtables();
+  
   fillChannelToWireMap(geodata.cryostats);
   
+  buildChannelDecoder(geodata.cryostats);
+  
+  buildWireTables(geodata.cryostats);
+  
+  buildChannelCrossings();
+  
   MF_LOG_TRACE("ICARUSChannelMapAlg")
     << "ICARUSChannelMapAlg::Initialize() completed.";
   
@@ -106,10 +113,20 @@ void icarus::ICARUSChannelMapAlg::Uninitialize() {
   
   fReadoutMapInfo.clear();
   
+  fReadoutIDs.clear();
+  
   fChannelToWireMap.clear();
   
+  fChannelDecoder = icarus::ChannelDecoder{};
+  
   fPlaneInfo.clear();
   
+  fWireTables.clear();
+  
+  fWireCrossings.clear();
+  
+  fChannelCrossings.clear();
+  
 } // icarus::ICARUSChannelMapAlg::Uninitialize()
 
 
@@ -238,6 +255,7 @@ std::set<geo::PlaneID> const& icarus::ICARUSChannelMapAlg::PlaneIDs() const {
   cet::exception e("ICARUSChannelMapAlg");
   e << "ICARUSChannelMapAlg does not support `PlaneIDs()` call."
     "\nPlease update calling software to use geo::GeometryCore::IteratePlanes()`"
+    " or `ICARUSChannelMapAlg::SortedPlaneIDs()`."
     "\n";
   
   lar::debug::printBacktrace(e, 3U);
@@ -247,6 +265,147 @@ std::set<geo::PlaneID> const& icarus::ICARUSChannelMapAlg::PlaneIDs() const {
 } // icarus::ICARUSChannelMapAlg::PlaneIDs()
 
 
+//------------------------------------------------------------------------------
+auto icarus::ICARUSChannelMapAlg::SortedPlaneIDs() const -> PlaneIDspan_t {
+  std::vector<geo::PlaneID> const& IDs = fReadoutIDs.fPlaneIDs;
+  return PlaneIDspan_t{ IDs.begin(), IDs.end() };
+} // icarus::ICARUSChannelMapAlg::SortedPlaneIDs()
+
+
+//------------------------------------------------------------------------------
+auto icarus::ICARUSChannelMapAlg::WirePlanesInROP
+  (readout::ROPID const& ropid) const -> PlaneIDspan_t
+{
+  std::vector<geo::PlaneID> const& IDs = fReadoutIDs.fROPplaneIDs;
+  if (!HasROP(ropid)) return PlaneIDspan_t{ IDs.end(), IDs.end() };
+  IndexRange_t const& range = fReadoutIDs.fROPranges[ropid];
+  return PlaneIDspan_t{ IDs.begin() + range.first, IDs.begin() + range.second };
+} // icarus::ICARUSChannelMapAlg::WirePlanesInROP()
+
+
+//------------------------------------------------------------------------------
+auto icarus::ICARUSChannelMapAlg::TPCsInROP
+  (readout::ROPID const& ropid) const -> TPCIDspan_t
+{
+  std::vector<geo::TPCID> const& IDs = fReadoutIDs.fROPTPCIDs;
+  if (!HasROP(ropid)) return TPCIDspan_t{ IDs.end(), IDs.end() };
+  IndexRange_t const& range = fReadoutIDs.fROPranges[ropid];
+  return TPCIDspan_t{ IDs.begin() + range.first, IDs.begin() + range.second };
+} // icarus::ICARUSChannelMapAlg::TPCsInROP()
+
+
+//------------------------------------------------------------------------------
+auto icarus::ICARUSChannelMapAlg::TPCsInTPCset
+  (readout::TPCsetID const& tpcsetid) const -> TPCIDspan_t
+{
+  std::vector<geo::TPCID> const& IDs = fReadoutIDs.fTPCsetTPCIDs;
+  if (!HasTPCset(tpcsetid)) return TPCIDspan_t{ IDs.end(), IDs.end() };
+  IndexRange_t const& range = fReadoutIDs.fTPCsetRanges[tpcsetid];
+  return TPCIDspan_t{ IDs.begin() + range.first, IDs.begin() + range.second };
+} // icarus::ICARUSChannelMapAlg::TPCsInTPCset()
+
+
+//------------------------------------------------------------------------------
+icarus::WireTable const& icarus::ICARUSChannelMapAlg::PlaneWireTable
+  (geo::PlaneID const& planeid) const
+{
+  if (!fWireTables.hasPlane(planeid) || fWireTables[planeid].empty()) {
+    throw cet::exception("Geometry")
+      << "icarus::ICARUSChannelMapAlg::PlaneWireTable(" << planeid
+      << "): no wire plane with this ID in the geometry\n";
+  }
+  return fWireTables[planeid];
+} // icarus::ICARUSChannelMapAlg::PlaneWireTable()
+
+
+//------------------------------------------------------------------------------
+auto icarus::ICARUSChannelMapAlg::CrossingWires
+  (geo::WireID const& wireid, geo::PlaneID const& otherPlaneID) const
+  -> icarus::WireCrossingTable::WireRange_t
+{
+  if (!fWireCrossings.hasPlane(wireid)) return {};
+  if (wireid.asTPCID() != otherPlaneID.asTPCID()) return {};
+  
+  std::vector<icarus::WireCrossingTable> const& tables
+    = fWireCrossings[wireid];
+  return (otherPlaneID.Plane < tables.size())
+    ? tables[otherPlaneID.Plane].crossingWires(wireid.Wire)
+    : icarus::WireCrossingTable::WireRange_t{};
+} // icarus::ICARUSChannelMapAlg::CrossingWires()
+
+
+//------------------------------------------------------------------------------
+auto icarus::ICARUSChannelMapAlg::CrossingChannels
+  (raw::ChannelID_t channel, readout::ROPID const& ropid) const
+  -> ChannelRangeSpan_t
+{
+  icarus::details::ChannelToWireMap::ChannelsInROPStruct const* channelInfo
+    = fChannelToWireMap.find(channel);
+  if (!channelInfo) {
+    throw cet::exception("Geometry")
+      << "icarus::ICARUSChannelMapAlg::CrossingChannels(" << channel
+      << "): invalid channel requested (must be lower than "
+      << Nchannels() << ")\n";
+  }
+  
+  // only the readout planes in the same TPC set can cross the channel
+  std::vector<ChannelRange_t> const& ranges = fChannelCrossings.fRanges;
+  readout::TPCsetID const& sid = channelInfo->ropid.asTPCsetID();
+  if (!HasROP(ropid) || (ropid.asTPCsetID() != sid))
+    return ChannelRangeSpan_t{ ranges.end(), ranges.end() };
+  
+  std::size_t const iBlock = channel * fChannelCrossings.fNROPs + ropid.ROP;
+  IndexRange_t const& block = fChannelCrossings.fBlocks[iBlock];
+  return ChannelRangeSpan_t
+    { ranges.begin() + block.first, ranges.begin() + block.second };
+} // icarus::ICARUSChannelMapAlg::CrossingChannels()
+
+
+//------------------------------------------------------------------------------
+auto icarus::ICARUSChannelMapAlg::computeCrossingChannels
+  (raw::ChannelID_t channel, readout::ROPID const& ropid) const
+  -> std::vector<ChannelRange_t>
+{
+  std::vector<ChannelRange_t> ranges;
+  if (!HasROP(ropid)) return ranges;
+  
+  //
+  // collect the range of crossing channels from each pair of wires
+  // in the same TPC; within a plane, consecutive wires are on consecutive
+  // channels (in either order)
+  //
+  for (geo::WireID const& wireid: ChannelToWire(channel)) {
+    for (geo::PlaneGeo const* plane: ROPplanes(ropid)) {
+      geo::PlaneID const& pid = plane->ID();
+      icarus::WireCrossingTable::WireRange_t const wires
+        = CrossingWires(wireid, pid);
+      if (wires.empty()) continue;
+      raw::ChannelID_t const firstChannel
+        = PlaneWireToChannel(geo::WireID{ pid, wires.first });
+      raw::ChannelID_t const lastChannel
+        = PlaneWireToChannel(geo::WireID{ pid, wires.end - 1 });
+      ranges.emplace_back(
+        std::min(firstChannel, lastChannel),
+        std::max(firstChannel, lastChannel) + 1
+        );
+    } // for planes in ROP
+  } // for wires of the channel
+  
+  //
+  // merge the overlapping ranges (e.g. from shared channels)
+  //
+  std::sort(ranges.begin(), ranges.end());
+  std::vector<ChannelRange_t> merged;
+  for (ChannelRange_t const& range: ranges) {
+    if (!merged.empty() && (range.begin() <= merged.back().end()))
+      merged.back().second = std::max(merged.back().end(), range.end());
+    else merged.push_back(range);
+  } // for
+  
+  return merged;
+} // icarus::ICARUSChannelMapAlg::computeCrossingChannels()
+
+
 //------------------------------------------------------------------------------
 unsigned int icarus::ICARUSChannelMapAlg::NTPCsets
   (readout::CryostatID const& cryoid) const
@@ -286,15 +445,9 @@ readout::TPCsetID icarus::ICARUSChannelMapAlg::TPCtoTPCset
 std::vector<geo::TPCID> icarus::ICARUSChannelMapAlg::TPCsetToTPCs
   (readout::TPCsetID const& tpcsetid) const
 {
-  std::vector<geo::TPCID> TPCs;
-  if (!tpcsetid) return TPCs;
-  
-  auto const& TPClist = TPCsetTPCs(tpcsetid);
-  TPCs.reserve(TPClist.size());
-  std::transform(TPClist.begin(), TPClist.end(), std::back_inserter(TPCs),
-    std::mem_fn(&geo::TPCGeo::ID)
-    );
-  return TPCs;
+  if (!tpcsetid) return {};
+  TPCIDspan_t const TPCs = TPCsInTPCset(tpcsetid);
+  return { TPCs.begin(), TPCs.end() };
 } // icarus::ICARUSChannelMapAlg::TPCsetToTPCs()
 
 
@@ -354,15 +507,9 @@ readout::ROPID icarus::ICARUSChannelMapAlg::WirePlaneToROP
 std::vector<geo::PlaneID> icarus::ICARUSChannelMapAlg::ROPtoWirePlanes
   (readout::ROPID const& ropid) const
 {
-  std::vector<geo::PlaneID> Planes;
-  if (!ropid) return Planes;
-  
-  auto const& PlaneList = ROPplanes(ropid);
-  Planes.reserve(PlaneList.size());
-  std::transform(PlaneList.begin(), PlaneList.end(), std::back_inserter(Planes),
-    std::mem_fn(&geo::PlaneGeo::ID)
-    );
-  return Planes;
+  if (!ropid) return {};
+  PlaneIDspan_t const planes = WirePlanesInROP(ropid);
+  return { planes.begin(), planes.end() };
 } // icarus::ICARUSChannelMapAlg::ROPtoWirePlanes()
 
 
@@ -370,26 +517,9 @@ std::vector<geo::PlaneID> icarus::ICARUSChannelMapAlg::ROPtoWirePlanes
 std::vector<geo::TPCID> icarus::ICARUSChannelMapAlg::ROPtoTPCs
   (readout::ROPID const& ropid) const
 {
-  std::vector<geo::TPCID> TPCs;
-  if (!ropid) return TPCs;
-  
-  /*
-   * We use the same algorithm as for extracting the plane IDs
-   * (they implicitly convert to TPC ID... kind of them).
-   * The algorithm does not test for duplication, i.e. in theory it could
-   * produce lists with the same TPC ID being present multiple times
-   * from different planes.
-   * But this is not expected in this mapping, where each TPC holds at most
-   * one wire plane for each view, and the planes in a ROP are all on the same
-   * view. It might be matter of an assertion, but it's too complex to fit in an
-   * `assert()` call.
-   */
-  auto const& PlaneList = ROPplanes(ropid);
-  TPCs.reserve(PlaneList.size());
-  std::transform(PlaneList.begin(), PlaneList.end(), std::back_inserter(TPCs),
-    std::mem_fn(&geo::PlaneGeo::ID)
-    );
-  return TPCs;
+  if (!ropid) return {};
+  TPCIDspan_t const TPCs = TPCsInROP(ropid);
+  return { TPCs.begin(), TPCs.end() };
 } // icarus::ICARUSChannelMapAlg::ROPtoTPCs()
 
 
@@ -397,10 +527,7 @@ std::vector<geo::TPCID> icarus::ICARUSChannelMapAlg::ROPtoTPCs
 readout::ROPID icarus::ICARUSChannelMapAlg::ChannelToROP
   (raw::ChannelID_t channel) const
 {
-  if (!raw::isValidChannelID(channel)) return {};
-  icarus::details::ChannelToWireMap::ChannelsInROPStruct const* info
-    = fChannelToWireMap.find(channel);
-  return info? info->ropid: readout::ROPID{};
+  return fChannelDecoder.ROP(channel);
 } // icarus::ICARUSChannelMapAlg::ChannelToROP()
 
 
@@ -590,6 +717,202 @@ void icarus::ICARUSChannelMapAlg::buildReadoutPlanes
 } // icarus::ICARUSChannelMapAlg::buildReadoutPlanes()
 
 
+// -----------------------------------------------------------------------------
+void icarus::ICARUSChannelMapAlg::buildReadoutIDtables() {
+  
+  assert(fReadoutMapInfo);
+  
+  ReadoutIDTables_t tables;
+  
+  tables.fTPCsetRanges = readout::TPCsetDataContainer<IndexRange_t>
+    { fReadoutMapInfo.NCryostats(), fReadoutMapInfo.MaxTPCsets() };
+  tables.fROPranges = readout::ROPDataContainer<IndexRange_t>{
+    fReadoutMapInfo.NCryostats(), fReadoutMapInfo.MaxTPCsets(),
+    fReadoutMapInfo.MaxROPs()
+    };
+  
+  for (auto const c: util::counter(fReadoutMapInfo.NCryostats())) {
+    
+    readout::CryostatID const cid { c };
+    
+    auto const nTPCsets
+      = static_cast<readout::TPCsetID::TPCsetID_t>(TPCsetCount(cid));
+    
+    for (readout::TPCsetID::TPCsetID_t s: util::counter(nTPCsets)) {
+      
+      readout::TPCsetID const sid { cid, s };
+      
+      std::size_t const firstTPC = tables.fTPCsetTPCIDs.size();
+      for (geo::TPCGeo const* TPC: TPCsetTPCs(sid))
+        tables.fTPCsetTPCIDs.push_back(TPC->ID());
+      tables.fTPCsetRanges[sid] = { firstTPC, tables.fTPCsetTPCIDs.size() };
+      
+      auto const nROPs = static_cast<readout::ROPID::ROPID_t>(ROPcount(sid));
+      
+      for (readout::ROPID::ROPID_t r: util::counter(nROPs)) {
+        
+        readout::ROPID const rid { sid, r };
+        
+        /*
+         * Plane IDs implicitly convert to TPC ID (kind of them).
+         * This does not test for duplication, i.e. in theory it could
+         * produce lists with the same TPC ID being present multiple times
+         * from different planes.
+         * But this is not expected in this mapping, where each TPC holds at
+         * most one wire plane for each view, and the planes in a ROP are all
+         * on the same view.
+         */
+        std::size_t const firstPlane = tables.fROPplaneIDs.size();
+        for (geo::PlaneGeo const* plane: ROPplanes(rid)) {
+          tables.fROPplaneIDs.push_back(plane->ID());
+          tables.fROPTPCIDs.push_back(plane->ID());
+        }
+        tables.fROPranges[rid] = { firstPlane, tables.fROPplaneIDs.size() };
+        
+      } // for readout plane
+      
+    } // for TPC set
+    
+  } // for cryostat
+  
+  // each wire plane belongs to exactly one readout plane
+  tables.fPlaneIDs = tables.fROPplaneIDs;
+  std::sort(tables.fPlaneIDs.begin(), tables.fPlaneIDs.end());
+  
+  fReadoutIDs = std::move(tables);
+  
+} // icarus::ICARUSChannelMapAlg::buildReadoutIDtables()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ICARUSChannelMapAlg::buildChannelDecoder
+  (geo::GeometryData_t::CryostatList_t const& Cryostats)
+{
+  /*
+   * We rely on the accuracy of `findPlaneType()` (which is admittedly less than
+   * great) to assign signal type accordingly.
+   */
+  
+  fChannelDecoder = icarus::ChannelDecoder{ fChannelToWireMap.nChannels() };
+  
+  for (geo::CryostatGeo const& cryo: Cryostats) {
+    
+    readout::CryostatID const cid { cryo.ID() };
+    
+    auto const nTPCsets 
+      = static_cast<readout::TPCsetID::TPCsetID_t>(TPCsetCount(cid));
+    
+    for (readout::TPCsetID::TPCsetID_t s: util::counter(nTPCsets)) {
+      
+      readout::TPCsetID const sid { cid, s };
+      
+      auto const nROPs = static_cast<readout::ROPID::ROPID_t>(ROPcount(sid));
+      
+      for (readout::ROPID::ROPID_t r: util::counter(nROPs)) {
+        
+        readout::ROPID const rid { sid, r };
+        
+        icarus::details::ChannelToWireMap::ChannelsInROPStruct const* info
+          = fChannelToWireMap.find(rid);
+        if (!info) continue;
+        
+        PlaneColl_t const& planes = ROPplanes(rid);
+        geo::View_t const view
+          = planes.empty()? geo::kUnknown: planes.front()->View();
+        
+        geo::SigType_t sigType = geo::kMysteryType;
+        switch (findPlaneType(rid)) {
+          case kFirstInductionType:
+          case kSecondInductionType:
+            sigType = geo::kInduction;
+            break;
+          case kCollectionType:
+            sigType = geo::kCollection;
+            break;
+          default:
+            break;
+        } // switch
+        
+        fChannelDecoder.setChannels
+          (info->firstChannel, info->nChannels, rid, view, sigType);
+        
+      } // for readout plane
+      
+    } // for TPC set
+    
+  } // for cryostat
+  
+} // icarus::ICARUSChannelMapAlg::buildChannelDecoder()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ICARUSChannelMapAlg::buildWireTables
+  (geo::GeometryData_t::CryostatList_t const& Cryostats)
+{
+  assert(fWireTables.empty());
+  std::array<unsigned int, 3U> const maxSizes
+    = geo::details::extractMaxGeometryElements<3U>(Cryostats);
+  
+  fWireTables.resize(maxSizes[0U], maxSizes[1U], maxSizes[2U]);
+  fWireCrossings.resize(maxSizes[0U], maxSizes[1U], maxSizes[2U]);
+  
+  for (geo::CryostatGeo const& cryo: Cryostats) {
+    for (geo::TPCGeo const& TPC: cryo.IterateTPCs()) {
+      
+      for (geo::PlaneGeo const& plane: TPC.IteratePlanes())
+        fWireTables[plane.ID()] = icarus::WireTable::fromPlane(plane);
+      
+      for (geo::PlaneGeo const& plane: TPC.IteratePlanes()) {
+        std::vector<icarus::WireCrossingTable>& crossings
+          = fWireCrossings[plane.ID()];
+        crossings.resize(TPC.Nplanes());
+        for (geo::PlaneGeo const& other: TPC.IteratePlanes()) {
+          if (other.ID() == plane.ID()) continue; // no crossing with itself
+          crossings[other.ID().Plane] = icarus::WireCrossingTable
+            { fWireTables[plane.ID()], fWireTables[other.ID()] };
+        } // for other planes
+      } // for planes
+      
+    } // for TPCs
+  } // for cryostats
+  
+} // icarus::ICARUSChannelMapAlg::buildWireTables()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ICARUSChannelMapAlg::buildChannelCrossings() {
+  
+  assert(fChannelCrossings.fBlocks.empty());
+  
+  ChannelCrossingTables_t tables;
+  tables.fNROPs = fReadoutMapInfo.MaxROPs();
+  tables.fBlocks.resize(Nchannels() * tables.fNROPs, IndexRange_t{ 0U, 0U });
+  
+  for (raw::ChannelID_t channel = 0; channel < Nchannels(); ++channel) {
+    
+    readout::TPCsetID const sid
+      = fChannelToWireMap.find(channel)->ropid.asTPCsetID();
+    
+    auto const nROPs = static_cast<readout::ROPID::ROPID_t>(ROPcount(sid));
+    for (readout::ROPID::ROPID_t r: util::counter(nROPs)) {
+      
+      std::vector<ChannelRange_t> const ranges
+        = computeCrossingChannels(channel, readout::ROPID{ sid, r });
+      
+      std::size_t const first = tables.fRanges.size();
+      tables.fRanges.insert(tables.fRanges.end(), ranges.begin(), ranges.end());
+      tables.fBlocks[channel * tables.fNROPs + r]
+        = { first, tables.fRanges.size() };
+      
+    } // for readout planes
+    
+  } // for channels
+  
+  fChannelCrossings = std::move(tables);
+  
+} // icarus::ICARUSChannelMapAlg::buildChannelCrossings()
+
+
 // -----------------------------------------------------------------------------
 auto icarus::ICARUSChannelMapAlg::findPlaneType(readout::ROPID const& rid) const
   -> PlaneType_t
@@ -620,25 +943,8 @@ auto icarus::ICARUSChannelMapAlg::findPlaneType(readout::ROPID const& rid) const
 geo::SigType_t icarus::ICARUSChannelMapAlg::SignalTypeForChannelImpl
   (raw::ChannelID_t const channel) const
 {
-  /*
-   * We rely on the accuracy of `findPlaneType()` (which is admittedly less than
-   * great) to assign signal type accordingly.
-   */
-  
-  icarus::details::ChannelToWireMap::ChannelsInROPStruct const* channelInfo
-    = fChannelToWireMap.find(channel);
-  if (!channelInfo) return geo::kMysteryType;
-  
-  switch (findPlaneType(channelInfo->ropid)) {
-    case kFirstInductionType:
-    case kSecondInductionType:
-      return geo::kInduction;
-    case kCollectionType:
-      return geo::kCollection;
-    default:
-      return geo::kMysteryType;
-  } // switch
-  
+  // the signal type is assigned to each channel by `buildChannelDecoder()`
+  return fChannelDecoder.signalType(channel);
 } // icarus::ICARUSChannelMapAlg::SignalTypeForChannelImpl()
 
 
@@ -11,6 +11,9 @@
 
 // ICARUS libraries
 #include "icarusalg/Geometry/GeoObjectSorterPMTasTPC.h"
+#include "icarusalg/Geometry/WireTable.h"
+#include "icarusalg/Geometry/WireCrossingTable.h"
+#include "icarusalg/Geometry/ChannelDecoder.h"
 #include "icarusalg/Geometry/details/ChannelToWireMap.h"
 #include "icarusalg/Geometry/details/GeometryObjectCollections.h"
 
@@ -20,6 +23,7 @@
 #include "larcorealg/Geometry/GeometryData.h"
 #include "larcorealg/Geometry/GeometryDataContainers.h"
 #include "larcorealg/Geometry/ReadoutDataContainers.h"
+#include "larcorealg/CoreUtils/span.h" // util::span
 #include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
@@ -32,6 +36,7 @@
 // C/C++ standard libraries
 #include <vector>
 #include <cassert>
+#include <cstddef> // std::size_t
 
 
 // -----------------------------------------------------------------------------
@@ -337,6 +342,105 @@ class icarus::ICARUSChannelMapAlg: public geo::ChannelMapAlg {
   /// @}
   
   
+  // --- BEGIN -- Precomputed ID ranges ----------------------------------------
+  /**
+   * @name Precomputed ID ranges
+   * 
+   * These ranges are filled on `Initialize()` and they are contiguous and
+   * read-only: iterating through them does not allocate memory.
+   * They stay valid until the mapping is reinitialized or uninitialized.
+   * Invalid or non-existing IDs are associated to empty ranges.
+   */
+  /// @{
+  
+  /// Type of range of plane IDs.
+  using PlaneIDspan_t = util::span<std::vector<geo::PlaneID>::const_iterator>;
+  
+  /// Type of range of TPC IDs.
+  using TPCIDspan_t = util::span<std::vector<geo::TPCID>::const_iterator>;
+  
+  /// Returns the IDs of all the wire planes, sorted (replaces `PlaneIDs()`).
+  PlaneIDspan_t SortedPlaneIDs() const;
+  
+  /// Returns the IDs of the wire planes in `ropid` (as `ROPtoWirePlanes()`).
+  PlaneIDspan_t WirePlanesInROP(readout::ROPID const& ropid) const;
+  
+  /// Returns the IDs of the TPCs `ropid` spans (as `ROPtoTPCs()`).
+  TPCIDspan_t TPCsInROP(readout::ROPID const& ropid) const;
+  
+  /// Returns the IDs of the TPCs in `tpcsetid` (as `TPCsetToTPCs()`).
+  TPCIDspan_t TPCsInTPCset(readout::TPCsetID const& tpcsetid) const;
+  
+  /// @}
+  // --- END -- Precomputed ID ranges ------------------------------------------
+  
+  
+  /**
+   * @brief Returns the table of the wire coordinates of the plane `planeid`.
+   * @param planeid ID of the wire plane
+   * @return the wire table of the plane
+   * @throws cet::exception (category: "Geometry") if the plane is not present
+   * @see `icarus::WireTable`
+   * 
+   * The tables of all planes are filled on `Initialize()`.
+   */
+  icarus::WireTable const& PlaneWireTable(geo::PlaneID const& planeid) const;
+  
+  
+  /**
+   * @brief Returns the range of wires of `otherPlaneID` crossed by `wireid`.
+   * @param wireid ID of the wire
+   * @param otherPlaneID ID of the plane with the wires to be crossed
+   * @return the range of the wire numbers crossed in `otherPlaneID`
+   * 
+   * The two planes must be in the same TPC, otherwise the returned range is
+   * empty. The ranges are precomputed on `Initialize()` (see
+   * `icarus::WireCrossingTable`), so the query takes constant time.
+   */
+  icarus::WireCrossingTable::WireRange_t CrossingWires
+    (geo::WireID const& wireid, geo::PlaneID const& otherPlaneID) const;
+  
+  /// Type of range of channel ranges.
+  using ChannelRangeSpan_t
+    = util::span<std::vector<icarus::details::ChannelRange_t>::const_iterator>;
+  
+  /**
+   * @brief Returns the channels of readout plane `ropid` crossing `channel`.
+   * @param channel the TPC readout channel
+   * @param ropid ID of the readout plane with the channels to be crossed
+   * @return the ranges of the crossing channels, sorted and not overlapping
+   * @throws cet::exception (category: "Geometry") if non-existent channel
+   * 
+   * A channel of `ropid` crosses `channel` if any of the wires of the two
+   * channels cross each other. The wires of the two channels are matched TPC
+   * by TPC, so that the wires of `channel` in one TPC are only tested against
+   * the wires of `ropid` in the same TPC: for example, a channel of the first
+   * induction plane, whose wires are split in two ROPs, only crosses the
+   * channels of the other planes in the same TPC, while a channel of the
+   * collection plane, whose wires cover both TPCs of the TPC set, may cross
+   * channels of both the first induction ROPs.
+   * 
+   * The ranges are precomputed on `Initialize()` for each channel and each
+   * readout plane in its TPC set, and they are valid until `Uninitialize()`;
+   * the range is empty if `ropid` is not in the TPC set of `channel`.
+   */
+  ChannelRangeSpan_t CrossingChannels
+    (raw::ChannelID_t channel, readout::ROPID const& ropid) const;
+  
+  
+  /**
+   * @brief Returns a packed snapshot of the mapping of all the channels.
+   * @see `icarus::ChannelDecoder`
+   * 
+   * The decoder provides the readout plane, TPC set, view and signal type of
+   * each channel (single or in batches) without virtual calls.
+   * It is filled on `Initialize()`, and it is valid until `Uninitialize()`.
+   */
+  icarus::ChannelDecoder const& channelDecoder() const
+    { return fChannelDecoder; }
+  
+  
+  
   //
   // TPC set interface
   //
@@ -612,15 +716,83 @@ class icarus::ICARUSChannelMapAlg: public geo::ChannelMapAlg {
   }; // struct PlaneInfo_t
   
   
+  /// Range of indices `[ first, second )` in one of the flat ID lists.
+  using IndexRange_t = std::pair<std::size_t, std::size_t>;
+  
+  /// Flat, sorted lists of IDs of readout and geometry elements.
+  struct ReadoutIDTables_t {
+    
+    /// IDs of all wire planes, sorted.
+    std::vector<geo::PlaneID> fPlaneIDs;
+    
+    /// IDs of the wire planes of all the ROPs, each ROP in a contiguous block.
+    std::vector<geo::PlaneID> fROPplaneIDs;
+    
+    /// IDs of the TPC of each of the planes in `fROPplaneIDs`.
+    std::vector<geo::TPCID> fROPTPCIDs;
+    
+    /// Range of each ROP in `fROPplaneIDs` and `fROPTPCIDs`.
+    readout::ROPDataContainer<IndexRange_t> fROPranges;
+    
+    /// IDs of the TPCs of all the TPC sets, each in a contiguous block.
+    std::vector<geo::TPCID> fTPCsetTPCIDs;
+    
+    /// Range of each TPC set in `fTPCsetTPCIDs`.
+    readout::TPCsetDataContainer<IndexRange_t> fTPCsetRanges;
+    
+    /// Frees the memory.
+    void clear()
+      {
+        fPlaneIDs.clear(); fROPplaneIDs.clear(); fROPTPCIDs.clear();
+        fROPranges.clear(); fTPCsetTPCIDs.clear(); fTPCsetRanges.clear();
+      }
+    
+  }; // ReadoutIDTables_t
+  
+  
   /// Information about TPC sets and readout planes in the geometry.
   ReadoutMappingInfo_t fReadoutMapInfo;
   
+  /// Precomputed lists of IDs for the range accessors.
+  ReadoutIDTables_t fReadoutIDs;
+  
   /// Mapping of channels to wire planes and ROP's.
   icarus::details::ChannelToWireMap fChannelToWireMap;
   
+  /// Readout plane, view and signal type of each channel, packed.
+  icarus::ChannelDecoder fChannelDecoder;
+  
   /// Range of channels covered by each of the wire planes.
   geo::PlaneDataContainer<PlaneInfo_t> fPlaneInfo;
   
+  /// Coordinates of the wires of each of the wire planes.
+  geo::PlaneDataContainer<icarus::WireTable> fWireTables;
+  
+  /// Wires crossed by each wire plane in each other plane (by plane number)
+  /// in the same TPC.
+  geo::PlaneDataContainer<std::vector<icarus::WireCrossingTable>>
+    fWireCrossings;
+  
+  /// Channels crossing each channel, in the readout planes of its TPC set.
+  struct ChannelCrossingTables_t {
+    
+    /// Ranges of crossing channels, in contiguous blocks.
+    std::vector<ChannelRange_t> fRanges;
+    
+    /// Number of readout planes in each channel block of `fBlocks`.
+    std::size_t fNROPs = 0U;
+    
+    /// Range in `fRanges` for each channel (by ID) and ROP (by number).
+    std::vector<IndexRange_t> fBlocks;
+    
+    /// Frees the memory.
+    void clear() { fRanges.clear(); fNROPs = 0U; fBlocks.clear(); }
+    
+  }; // ChannelCrossingTables_t
+  
+  /// Precomputed ranges of crossing channels.
+  ChannelCrossingTables_t fChannelCrossings;
+  
   
   /// @}
   // --- END -- Readout element information ------------------------------------
@@ -748,6 +920,45 @@ class icarus::ICARUSChannelMapAlg: public geo::ChannelMapAlg {
   void buildReadoutPlanes(geo::GeometryData_t::CryostatList_t const& Cryostats);
   
   
+  /**
+   * @brief Fills the flat lists of IDs returned by the range accessors.
+   * 
+   * The readout information must have been already filled
+   * (`buildReadoutPlanes()`).
+   */
+  void buildReadoutIDtables();
+  
+  
+  /**
+   * @brief Fills the packed per-channel decoder.
+   * @param Cryostats the sorted list of cryostats in the detector
+   * 
+   * The channel mapping must have been already filled
+   * (`fillChannelToWireMap()`).
+   */
+  void buildChannelDecoder
+    (geo::GeometryData_t::CryostatList_t const& Cryostats);
+  
+  
+  /// Fills the wire coordinate tables of all the wire planes in `Cryostats`,
+  /// and the crossing tables between all the planes in the same TPC.
+  void buildWireTables(geo::GeometryData_t::CryostatList_t const& Cryostats);
+  
+  
+  /**
+   * @brief Fills the ranges of crossing channels of all the channels.
+   * 
+   * The channel mapping and the wire crossing tables must have been already
+   * filled (`fillChannelToWireMap()`, `buildWireTables()`).
+   */
+  void buildChannelCrossings();
+  
+  /// Computes the ranges of channels in `ropid` crossing `channel`
+  /// (see `CrossingChannels()`).
+  std::vector<ChannelRange_t> computeCrossingChannels
+    (raw::ChannelID_t channel, readout::ROPID const& ropid) const;
+  
+  
   /**
    * @brief Returns the "type" of readout plane.
    * @param ropid ID of the readout plane to query
@@ -0,0 +1,75 @@
+/**
+ * @file   icarusalg/Geometry/WireCrossingTable.cxx
+ * @brief  Precomputed ranges of crossing wires between two wire planes.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/WireCrossingTable.h`
+ */
+
+// library header
+#include "icarusalg/Geometry/WireCrossingTable.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max(), std::clamp()
+#include <cmath> // std::floor(), std::ceil()
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  /// Returns whether `wire` of `planeA` crosses `otherWire` of `planeB`.
+  bool crosses(
+    icarus::WireTable const& planeA, icarus::WireTable::WireNo_t wire,
+    icarus::WireTable const& planeB, icarus::WireTable::WireNo_t otherWire
+  ) {
+    icarus::WireTable::Coord_t y, z;
+    char inside;
+    planeA.intersections(planeB, { &wire, 1U }, { &otherWire, 1U },
+      { &y, 1U }, { &z, 1U }, { &inside, 1U });
+    return inside != 0;
+  } // crosses()
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+icarus::WireCrossingTable::WireCrossingTable
+  (icarus::WireTable const& planeA, icarus::WireTable const& planeB)
+{
+  std::size_t const nWiresA = planeA.nWires();
+  long int const nWiresB = static_cast<long int>(planeB.nWires());
+
+  fFirst.resize(nWiresA, 0U);
+  fEnd.resize(nWiresA, 0U);
+  if (nWiresB == 0) return;
+
+  for (std::size_t iWire = 0; iWire < nWiresA; ++iWire) {
+    WireNo_t const wire = static_cast<WireNo_t>(iWire);
+
+    //
+    // the candidates are the wires of B between the projections of the ends
+    // of the wire of A, with one wire of margin on each side;
+    // then the range is trimmed from both sides to the wires actually crossed
+    //
+    icarus::WireTable::Coord_t const cStart
+      = planeB.wireCoordinate(planeA.startY()[iWire], planeA.startZ()[iWire]);
+    icarus::WireTable::Coord_t const cEnd
+      = planeB.wireCoordinate(planeA.endY()[iWire], planeA.endZ()[iWire]);
+    auto const cMin = std::min(cStart, cEnd), cMax = std::max(cStart, cEnd);
+    auto first = static_cast<WireNo_t>(std::clamp
+      (static_cast<long int>(std::floor(cMin)) - 1L, 0L, nWiresB));
+    auto end = static_cast<WireNo_t>(std::clamp
+      (static_cast<long int>(std::ceil(cMax)) + 2L, 0L, nWiresB));
+
+    while ((first < end) && !crosses(planeA, wire, planeB, first)) ++first;
+    while ((first < end) && !crosses(planeA, wire, planeB, end - 1)) --end;
+
+    if (first < end) {
+      fFirst[iWire] = first;
+      fEnd[iWire] = end;
+    }
+  } // for wires of A
+
+} // icarus::WireCrossingTable::WireCrossingTable()
+
+
+// -----------------------------------------------------------------------------
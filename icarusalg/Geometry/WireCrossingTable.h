@@ -0,0 +1,91 @@
+/**
+ * @file   icarusalg/Geometry/WireCrossingTable.h
+ * @brief  Precomputed ranges of crossing wires between two wire planes.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/WireCrossingTable.cxx`
+ */
+
+#ifndef ICARUSALG_GEOMETRY_WIRECROSSINGTABLE_H
+#define ICARUSALG_GEOMETRY_WIRECROSSINGTABLE_H
+
+// ICARUS libraries
+#include "icarusalg/Geometry/WireTable.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { class WireCrossingTable; }
+
+/**
+ * @brief For each wire of a plane, the range of wires of another plane crossed.
+ *
+ * Within a TPC, the wires of a plane cross a contiguous range of the wires
+ * of another plane with a different orientation. This table stores, for each
+ * wire of the first plane ("A"), the first and the past-the-last wire of the
+ * second plane ("B") that it crosses, so that the query takes constant time.
+ *
+ * Two wires cross if their crossing point lies within both of them, as in
+ * `icarus::WireTable::intersections()` (and
+ * `geo::GeometryCore::WireIDsIntersect()`).
+ * Wires parallel to the ones of the other plane cross no wire.
+ */
+class icarus::WireCrossingTable {
+
+    public:
+
+  using WireNo_t = icarus::WireTable::WireNo_t; ///< Type of wire number.
+
+  /// Range of wires `[ first, end [`.
+  struct WireRange_t {
+    WireNo_t first = 0; ///< The first wire in the range.
+    WireNo_t end = 0; ///< The wire after the last one in the range.
+
+    /// Returns whether the range contains no wire.
+    constexpr bool empty() const { return first >= end; }
+
+    /// Returns the number of wires in the range.
+    constexpr std::size_t size() const { return empty()? 0U: end - first; }
+
+    /// Returns whether `wire` is in the range.
+    constexpr bool contains(WireNo_t wire) const
+      { return (wire >= first) && (wire < end); }
+  }; // WireRange_t
+
+
+  /// Constructor: an empty table.
+  WireCrossingTable() = default;
+
+  /// Constructor: computes the crossings of wires of `planeA` with `planeB`.
+  WireCrossingTable
+    (icarus::WireTable const& planeA, icarus::WireTable const& planeB);
+
+  /// Returns the number of wires of plane A in the table.
+  std::size_t nWires() const { return fFirst.size(); }
+
+  /// Returns the range of wires of plane B crossed by `wire` of plane A.
+  WireRange_t crossingWires(WireNo_t wire) const
+    {
+      return (wire < fFirst.size())
+        ? WireRange_t{ fFirst[wire], fEnd[wire] }: WireRange_t{};
+    }
+
+  /// Returns whether `wire` of plane A crosses `otherWire` of plane B.
+  bool cross(WireNo_t wire, WireNo_t otherWire) const
+    { return crossingWires(wire).contains(otherWire); }
+
+
+    private:
+
+  std::vector<WireNo_t> fFirst; ///< First crossing wire, per wire of A.
+  std::vector<WireNo_t> fEnd; ///< Wire after the last crossing, per wire of A.
+
+}; // icarus::WireCrossingTable
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // ICARUSALG_GEOMETRY_WIRECROSSINGTABLE_H
@@ -0,0 +1,157 @@
+/**
+ * @file   icarusalg/Geometry/WireTable.cxx
+ * @brief  Precomputed wire coordinates of a wire plane, for batch queries.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/WireTable.h`
+ */
+
+// library header
+#include "icarusalg/Geometry/WireTable.h"
+
+// C/C++ standard libraries
+#include <cmath> // std::lround(), std::hypot()
+#include <limits> // std::numeric_limits<>
+#include <cassert>
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  /// Tolerance on the position of the crossing points at the wire ends [cm]
+  constexpr icarus::WireTable::Coord_t EndTolerance = 1e-4;
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+icarus::WireTable::WireTable(Coord_t x, std::vector<WireEnds_t> const& wires)
+  : fPlaneX{ x }
+{
+  std::size_t const nWires = wires.size();
+  if (nWires == 0) return;
+
+  fStartY.reserve(nWires);
+  fStartZ.reserve(nWires);
+  fEndY.reserve(nWires);
+  fEndZ.reserve(nWires);
+  fDirY.reserve(nWires);
+  fDirZ.reserve(nWires);
+  fLength.reserve(nWires);
+  fWireCoord.reserve(nWires);
+
+  for (WireEnds_t const& wire: wires) {
+    fStartY.push_back(wire.startY);
+    fStartZ.push_back(wire.startZ);
+    fEndY.push_back(wire.endY);
+    fEndZ.push_back(wire.endZ);
+    Coord_t const dy = wire.endY - wire.startY;
+    Coord_t const dz = wire.endZ - wire.startZ;
+    Coord_t const length = std::hypot(dy, dz);
+    fLength.push_back(length);
+    fDirY.push_back((length > 0.0)? dy / length: 0.0);
+    fDirZ.push_back((length > 0.0)? dz / length: 0.0);
+  } // for
+
+  //
+  // wire coordinate: like `geo::PlaneGeo`, it is measured from the center of
+  // the first wire, along the direction perpendicular to the first wire and
+  // pointing to the second one; the pitch is the distance between these two
+  //
+  fRefY = (fStartY[0] + fEndY[0]) / 2.0;
+  fRefZ = (fStartZ[0] + fEndZ[0]) / 2.0;
+  fWireCoordDirY = -fDirZ[0];
+  fWireCoordDirZ = fDirY[0];
+  if (nWires > 1) {
+    Coord_t const dy = (fStartY[1] + fEndY[1]) / 2.0 - fRefY;
+    Coord_t const dz = (fStartZ[1] + fEndZ[1]) / 2.0 - fRefZ;
+    fPitch = dy * fWireCoordDirY + dz * fWireCoordDirZ;
+    if (fPitch < 0.0) {
+      fPitch = -fPitch;
+      fWireCoordDirY = -fWireCoordDirY;
+      fWireCoordDirZ = -fWireCoordDirZ;
+    }
+  } // if more than one wire
+
+  for (std::size_t iWire = 0; iWire < nWires; ++iWire) {
+    Coord_t const cy = (fStartY[iWire] + fEndY[iWire]) / 2.0 - fRefY;
+    Coord_t const cz = (fStartZ[iWire] + fEndZ[iWire]) / 2.0 - fRefZ;
+    fWireCoord.push_back(cy * fWireCoordDirY + cz * fWireCoordDirZ);
+  } // for
+
+} // icarus::WireTable::WireTable()
+
+
+// -----------------------------------------------------------------------------
+void icarus::WireTable::nearestWires(
+  gsl::span<Coord_t const> y, gsl::span<Coord_t const> z,
+  gsl::span<WireNo_t> wires
+) const {
+
+  assert(z.size() == y.size());
+  assert(wires.size() >= y.size());
+
+  std::size_t const nPoints = y.size();
+  long int const nWires = static_cast<long int>(this->nWires());
+
+  if (nWires <= 1) {
+    WireNo_t const wire = (nWires == 1)? 0: InvalidWire;
+    for (std::size_t i = 0; i < nPoints; ++i) wires[i] = wire;
+    return;
+  }
+
+  Coord_t const dirY = fWireCoordDirY / fPitch;
+  Coord_t const dirZ = fWireCoordDirZ / fPitch;
+  for (std::size_t i = 0; i < nPoints; ++i) {
+    long int const wireNo
+      = std::lround((y[i] - fRefY) * dirY + (z[i] - fRefZ) * dirZ);
+    wires[i] = ((wireNo < 0) || (wireNo >= nWires))
+      ? InvalidWire: static_cast<WireNo_t>(wireNo);
+  } // for
+
+} // icarus::WireTable::nearestWires()
+
+
+// -----------------------------------------------------------------------------
+void icarus::WireTable::intersections(
+  WireTable const& other,
+  gsl::span<WireNo_t const> wires, gsl::span<WireNo_t const> otherWires,
+  gsl::span<Coord_t> y, gsl::span<Coord_t> z, gsl::span<char> inside
+) const {
+
+  assert(otherWires.size() == wires.size());
+  assert(y.size() >= wires.size());
+  assert(z.size() >= wires.size());
+  assert(inside.size() >= wires.size());
+
+  constexpr Coord_t NaN = std::numeric_limits<Coord_t>::quiet_NaN();
+
+  std::size_t const nPairs = wires.size();
+  for (std::size_t i = 0; i < nPairs; ++i) {
+    WireNo_t const a = wires[i], b = otherWires[i];
+    assert(a < nWires());
+    assert(b < other.nWires());
+
+    // solve start(A) + t dir(A) = start(B) + s dir(B)
+    Coord_t const cross
+      = fDirY[a] * other.fDirZ[b] - fDirZ[a] * other.fDirY[b];
+    if (cross == 0.0) { // parallel wires
+      y[i] = NaN;
+      z[i] = NaN;
+      inside[i] = false;
+      continue;
+    }
+    Coord_t const dy = other.fStartY[b] - fStartY[a];
+    Coord_t const dz = other.fStartZ[b] - fStartZ[a];
+    Coord_t const t = (dy * other.fDirZ[b] - dz * other.fDirY[b]) / cross;
+    Coord_t const s = (dy * fDirZ[a] - dz * fDirY[a]) / cross;
+
+    y[i] = fStartY[a] + t * fDirY[a];
+    z[i] = fStartZ[a] + t * fDirZ[a];
+    inside[i] = (t >= -EndTolerance) && (t <= fLength[a] + EndTolerance)
+      && (s >= -EndTolerance) && (s <= other.fLength[b] + EndTolerance);
+  } // for
+
+} // icarus::WireTable::intersections()
+
+
+// -----------------------------------------------------------------------------
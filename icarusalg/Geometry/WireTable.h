@@ -0,0 +1,239 @@
+/**
+ * @file   icarusalg/Geometry/WireTable.h
+ * @brief  Precomputed wire coordinates of a wire plane, for batch queries.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/WireTable.cxx`
+ */
+
+#ifndef ICARUSALG_GEOMETRY_WIRETABLE_H
+#define ICARUSALG_GEOMETRY_WIRETABLE_H
+
+// C++ core guideline library
+#include "gsl/span"
+
+// C/C++ standard libraries
+#include <vector>
+#include <limits>
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { class WireTable; }
+
+/**
+ * @brief Coordinates of all the wires of a plane, as a structure of arrays.
+ *
+ * The wire geometry objects (`geo::WireGeo`) compute the wire ends and center
+ * on request from their transformation. This table stores instead the ends of
+ * all the wires of a plane in contiguous arrays, together with their direction
+ * and the position of each wire along the direction of increasing wire number
+ * ("wire coordinate"). The table is meant to be built once, at initialization.
+ *
+ * The wires are assumed to lie on a plane of constant _x_ (drift coordinate),
+ * so that the _y_ and _z_ coordinates are enough to describe them.
+ *
+ * Two batch queries are supported:
+ * * `nearestWires()`: the wire closest to each of a list of points, with the
+ *   same result as `geo::PlaneGeo::NearestWireID()` (but an invalid wire number
+ *   instead of an exception when the point is outside the plane);
+ * * `intersections()`: the crossing point of each of a list of wire pairs,
+ *   with the wires from this plane and another one (like
+ *   `geo::GeometryCore::WireIDsIntersect()`).
+ *
+ * The input and output of the batch queries are separate arrays of the same
+ * size, one per coordinate.
+ */
+class icarus::WireTable {
+
+    public:
+
+  using Coord_t = double; ///< Type of coordinate.
+  using WireNo_t = unsigned int; ///< Type of wire number.
+
+  /// Wire number representing no wire.
+  static constexpr WireNo_t InvalidWire = std::numeric_limits<WireNo_t>::max();
+
+  /// Ends of a wire.
+  struct WireEnds_t {
+    Coord_t startY; ///< _y_ coordinate of the start of the wire.
+    Coord_t startZ; ///< _z_ coordinate of the start of the wire.
+    Coord_t endY; ///< _y_ coordinate of the end of the wire.
+    Coord_t endZ; ///< _z_ coordinate of the end of the wire.
+  }; // WireEnds_t
+
+
+  /// Constructor: an empty table (no wires).
+  WireTable() = default;
+
+  /**
+   * @brief Constructor: table of the specified wires.
+   * @param x drift coordinate of the plane
+   * @param wires the ends of all wires, sorted by increasing wire number
+   *
+   * The wires are expected to be parallel and sorted along a direction
+   * perpendicular to them, as in a `geo::PlaneGeo`.
+   */
+  WireTable(Coord_t x, std::vector<WireEnds_t> const& wires);
+
+  /**
+   * @brief Returns a table with the wires of `plane`.
+   * @tparam Plane type of wire plane (`geo::PlaneGeo` interface)
+   * @param plane the wire plane
+   * @return a table with all the wires from `plane`
+   */
+  template <typename Plane>
+  static WireTable fromPlane(Plane const& plane);
+
+
+  // --- BEGIN -- Table access -------------------------------------------------
+  /// Returns the number of wires in the table.
+  std::size_t nWires() const { return fStartY.size(); }
+
+  /// Returns whether the table has no wire.
+  bool empty() const { return fStartY.empty(); }
+
+  /// Returns the drift coordinate of the plane.
+  Coord_t planeX() const { return fPlaneX; }
+
+  /// Returns the distance between consecutive wires.
+  Coord_t pitch() const { return fPitch; }
+
+  /// Returns the _y_ component of the direction of increasing wire number.
+  Coord_t wireCoordDirY() const { return fWireCoordDirY; }
+
+  /// Returns the _z_ component of the direction of increasing wire number.
+  Coord_t wireCoordDirZ() const { return fWireCoordDirZ; }
+
+  /// The _y_ coordinate of the start of all the wires.
+  gsl::span<Coord_t const> startY() const { return fStartY; }
+
+  /// The _z_ coordinate of the start of all the wires.
+  gsl::span<Coord_t const> startZ() const { return fStartZ; }
+
+  /// The _y_ coordinate of the end of all the wires.
+  gsl::span<Coord_t const> endY() const { return fEndY; }
+
+  /// The _z_ coordinate of the end of all the wires.
+  gsl::span<Coord_t const> endZ() const { return fEndZ; }
+
+  /// The _y_ component of the direction of all the wires (start to end).
+  gsl::span<Coord_t const> dirY() const { return fDirY; }
+
+  /// The _z_ component of the direction of all the wires (start to end).
+  gsl::span<Coord_t const> dirZ() const { return fDirZ; }
+
+  /// The length of all the wires.
+  gsl::span<Coord_t const> length() const { return fLength; }
+
+  /// The wire coordinate of all the wires (the first one is at `0`).
+  gsl::span<Coord_t const> wireCoord() const { return fWireCoord; }
+
+  /**
+   * @brief Returns the wire coordinate of a point, in units of pitch.
+   * @param y _y_ coordinate of the point
+   * @param z _z_ coordinate of the point
+   * @return the position of the point along the wire number direction
+   *
+   * The position is relative to the first wire and in units of wire pitch,
+   * as in `geo::PlaneGeo::WireCoordinate()`. If the table has less than two
+   * wires, the result is `0`.
+   */
+  Coord_t wireCoordinate(Coord_t y, Coord_t z) const
+    {
+      return (fPitch > 0.0)
+        ? ((y - fRefY) * fWireCoordDirY + (z - fRefZ) * fWireCoordDirZ) / fPitch
+        : 0.0;
+    }
+  // --- END ---- Table access -------------------------------------------------
+
+
+  // --- BEGIN -- Batch queries ------------------------------------------------
+  /**
+   * @brief Finds the wire nearest to each of the specified points.
+   * @param y the _y_ coordinates of the points
+   * @param z the _z_ coordinates of the points (same size as `y`)
+   * @param[out] wires the number of the nearest wire to each point
+   *
+   * The output `wires` must be as large as the input.
+   * If a point is farther than half a pitch from the first or last wire,
+   * its wire is set to `InvalidWire`.
+   */
+  void nearestWires(
+    gsl::span<Coord_t const> y, gsl::span<Coord_t const> z,
+    gsl::span<WireNo_t> wires
+    ) const;
+
+  /**
+   * @brief Finds the crossing point of pairs of wires.
+   * @param other the table of the plane of the second wire of each pair
+   * @param wires the number of the first wire of each pair (from this table)
+   * @param otherWires the number of the second wire of each pair (from `other`)
+   * @param[out] y _y_ coordinate of the crossing point of each pair
+   * @param[out] z _z_ coordinate of the crossing point of each pair
+   * @param[out] inside whether each crossing point is within both wires
+   *                    (non-zero if it is)
+   *
+   * All the arrays must have the same size.
+   * The crossing point is computed even if it lies beyond the end of either
+   * wire, in which case `inside` is set to `false`. If the wires are parallel,
+   * the crossing point coordinates are NaN and `inside` is `false`.
+   */
+  void intersections(
+    WireTable const& other,
+    gsl::span<WireNo_t const> wires, gsl::span<WireNo_t const> otherWires,
+    gsl::span<Coord_t> y, gsl::span<Coord_t> z, gsl::span<char> inside
+    ) const;
+  // --- END ---- Batch queries ------------------------------------------------
+
+
+    private:
+
+  Coord_t fPlaneX = 0.0; ///< Drift coordinate of the plane.
+  Coord_t fPitch = 0.0; ///< Distance between consecutive wires.
+
+  /// Direction of increasing wire number (_y_ and _z_ components).
+  Coord_t fWireCoordDirY = 0.0, fWireCoordDirZ = 0.0;
+
+  // wire coordinates are measured from the center of the first wire
+  Coord_t fRefY = 0.0; ///< _y_ of the reference point of wire coordinates.
+  Coord_t fRefZ = 0.0; ///< _z_ of the reference point of wire coordinates.
+
+  std::vector<Coord_t> fStartY; ///< _y_ of the start of each wire.
+  std::vector<Coord_t> fStartZ; ///< _z_ of the start of each wire.
+  std::vector<Coord_t> fEndY; ///< _y_ of the end of each wire.
+  std::vector<Coord_t> fEndZ; ///< _z_ of the end of each wire.
+  std::vector<Coord_t> fDirY; ///< _y_ component of each wire direction.
+  std::vector<Coord_t> fDirZ; ///< _z_ component of each wire direction.
+  std::vector<Coord_t> fLength; ///< Length of each wire.
+  std::vector<Coord_t> fWireCoord; ///< Wire coordinate of each wire.
+
+}; // icarus::WireTable
+
+
+// -----------------------------------------------------------------------------
+// ---  Template implementation
+// -----------------------------------------------------------------------------
+template <typename Plane>
+icarus::WireTable icarus::WireTable::fromPlane(Plane const& plane) {
+
+  unsigned int const nWires = plane.Nwires();
+  if (nWires == 0) return {};
+
+  std::vector<WireEnds_t> wires;
+  wires.reserve(nWires);
+  for (unsigned int iWire = 0; iWire < nWires; ++iWire) {
+    auto const& wire = plane.Wire(iWire);
+    auto const start = wire.GetStart();
+    auto const end = wire.GetEnd();
+    wires.push_back({ start.Y(), start.Z(), end.Y(), end.Z() });
+  } // for
+
+  return { plane.GetCenter().X(), wires };
+
+} // icarus::WireTable::fromPlane()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // ICARUSALG_GEOMETRY_WIRETABLE_H
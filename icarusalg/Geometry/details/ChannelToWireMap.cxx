@@ -11,7 +11,7 @@
 
 // C/C++ libraries
 #include <iterator> // std::prev()
-#include <algorithm> // std::upper_bound(), std::find_if()
+#include <algorithm> // std::upper_bound(), std::max()
 
 
 //------------------------------------------------------------------------------
@@ -33,19 +33,42 @@ auto icarus::details::ChannelToWireMap::find
 auto icarus::details::ChannelToWireMap::find
   (readout::ROPID const& ropid) const -> ChannelsInROPStruct const*
 {
-  // find the first element whose channel is _not_ included
-  auto const dend = fROPfirstChannel.end();
-  auto const iData = std::find_if(
-    fROPfirstChannel.begin(), dend,
-    [&ropid](ChannelsInROPStruct const& data){ return data.ropid == ropid; }
-    );
-  return (iData == dend)? nullptr: &*iData;
+  // invalid and out-of-range IDs are not in the table
+  if (!fROPindex.hasROP(ropid)) return nullptr;
+  std::size_t const index = fROPindex[ropid];
+  return (index == NoIndex)? nullptr: &fROPfirstChannel[index];
 } // icarus::details::ChannelToWireMap::find(readout::ROPID)
 
 
+// -----------------------------------------------------------------------------
+void icarus::details::ChannelToWireMap::indexROP(std::size_t index) {
+  
+  readout::ROPID const& ropid = fROPfirstChannel[index].ropid;
+  if (fROPindex.hasROP(ropid)) {
+    fROPindex[ropid] = index;
+    return;
+  }
+  
+  // the table is too small: rebuild it large enough for this ROP too;
+  // this happens only a few times while the map is filled
+  readout::ROPDataContainer<std::size_t> table;
+  table.resize(
+    std::max<unsigned int>(fROPindex.dimSize<0U>(), ropid.Cryostat + 1),
+    std::max<unsigned int>(fROPindex.dimSize<1U>(), ropid.TPCset + 1),
+    std::max<unsigned int>(fROPindex.dimSize<2U>(), ropid.ROP + 1),
+    NoIndex
+    );
+  for (std::size_t i = 0; i <= index; ++i)
+    table[fROPfirstChannel[i].ropid] = i;
+  fROPindex = std::move(table);
+  
+} // icarus::details::ChannelToWireMap::indexROP()
+
+
 // -----------------------------------------------------------------------------
 void icarus::details::ChannelToWireMap::clear() {
   fROPfirstChannel.clear();
+  fROPindex.clear();
   fEndChannel = raw::ChannelID_t{ 0 };
 } // icarus::details::ChannelToWireMap::clear()
 
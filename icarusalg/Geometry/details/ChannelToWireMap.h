@@ -10,6 +10,7 @@
 #define ICARUSALG_GEOMETRY_DETAILS_CHANNELTOWIREMAP_H
 
 // LArSoft libraries
+#include "larcorealg/Geometry/ReadoutDataContainers.h" // readout::ROPDataContainer
 #include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
 #include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
 
@@ -17,6 +18,8 @@
 #include <vector>
 #include <cassert>
 #include <utility> // std::pair<>
+#include <limits>
+#include <cstddef> // std::size_t
 
 
 // -----------------------------------------------------------------------------
@@ -30,6 +33,10 @@ namespace icarus::details { class ChannelToWireMap; }
  * found from the next ROP), and for all wire planes after the first one,
  * the first channel that is shared (with the previous plane, that is) and
  * the first channel on that plane that is not shared.
+ * 
+ * The ROP records are sorted by channel, for the lookup by channel; a dense
+ * table, indexed by ROP ID, points to the record of each ROP, so that the
+ * lookup by ROP ID takes constant time.
  */
 class icarus::details::ChannelToWireMap {
   
@@ -104,6 +111,7 @@ class icarus::details::ChannelToWireMap {
         || (firstROPchannel > fROPfirstChannel.back().firstChannel)
         );
       fROPfirstChannel.emplace_back(firstROPchannel, nChannels, rid);
+      indexROP(fROPfirstChannel.size() - 1);
     }
   
   /// Sets the ID of the channels after the last valid one.
@@ -114,11 +122,20 @@ class icarus::details::ChannelToWireMap {
   
     private:
   
+  /// Value in `fROPindex` for ROPs with no record.
+  static constexpr std::size_t NoIndex = std::numeric_limits<std::size_t>::max();
+  
   /// Collection of channel ROP channel information, sorted by first channel.
   std::vector<ChannelsInROPStruct> fROPfirstChannel;
   
+  /// Index in `fROPfirstChannel` of the record of each ROP.
+  readout::ROPDataContainer<std::size_t> fROPindex;
+  
   raw::ChannelID_t fEndChannel = 0; ///< ID of the first invalid channel.
   
+  /// Records in `fROPindex` the ROP with index `index` (growing the table).
+  void indexROP(std::size_t index);
+  
 }; // class icarus::details::ChannelToWireMap
 
 
@@ -26,10 +26,13 @@
 // C/C++ standard libraries
 #include <algorithm> // std::set_difference(), std::any_of(), ...
 #include <functional> // std::mem_fn()
+#include <limits> // std::numeric_limits<>
 #include <utility> // std::move(), std::forward()
 #include <ostream>
 #include <vector>
 #include <variant>
+#include <thread>
+#include <exception> // std::exception_ptr, std::rethrow_exception()
 #include <optional>
 #include <initializer_list>
 #include <unordered_map>
@@ -50,6 +53,7 @@ namespace icarus::ns::util {
   template <typename T> class InputSpecs;
   template <typename T> using hopTo = InputSpecs<T>;
   template <typename T> using startFrom = StartSpecs<T>;
+  struct AssnsCrosserOptions;
   template <typename KeyType, typename... OtherTypes> class AssnsCrosser;
   
   template <typename KeyType, typename... OtherTypes, typename Event>
@@ -62,6 +66,12 @@ namespace icarus::ns::util {
     StartSpecs<KeyType>, InputSpecs<OtherTypes>... inputSpecs
     );
   
+  template <typename KeyType, typename... OtherTypes, typename Event>
+  AssnsCrosser<KeyType, OtherTypes...> makeAssnsCrosser(
+    Event const& event, AssnsCrosserOptions const& options,
+    StartSpecs<KeyType> startSpecs, InputSpecs<OtherTypes>... inputSpecs
+    );
+  
   std::ostream& operator<< (std::ostream& out, InputSpec const& spec);
   template <typename T>
   std::ostream& operator<< (std::ostream& out, StartSpec<T> const& spec);
@@ -76,6 +86,7 @@ namespace icarus::ns::util {
     template <typename KeyType, typename TargetType> class AssnsMap;
     template <typename KeyType, typename... OtherTypes> class AssnsCrosserTypes;
     template <typename T> struct PointerSelector;
+    template <typename T> class PtrEpochMarker;
     using SupportedInputSpecs = std::variant<
         std::monostate
       , art::InputTag
@@ -97,6 +108,52 @@ namespace icarus::ns::util {
   
 } // namespace icarus::ns::util
 
+// -----------------------------------------------------------------------------
+/**
+ * @brief Options for the traversal of associations in `AssnsCrosser`.
+ * 
+ * The default options reproduce the plain join of the associations.
+ */
+struct icarus::ns::util::AssnsCrosserOptions {
+  
+  /// How to treat a target reached from the same key via multiple paths.
+  enum class Duplicates {
+    keep,   ///< The target is listed once per path (default).
+    remove, ///< The target is listed only once.
+    count   ///< The target is listed only once, and its paths are counted.
+  };
+  
+  /// Treatment of targets reached via multiple paths.
+  Duplicates duplicates = Duplicates::keep;
+  
+  /**
+   * @brief Number of threads used to expand the keys (`0`: one per core).
+   * 
+   * The associations are always read serially. Once read, the keys of each
+   * join are split among the threads, and each thread expands its keys into
+   * its own buffer. Joins with few keys are always performed serially.
+   * The results do not depend on the number of threads.
+   */
+  unsigned int nThreads = 1U;
+  
+  /// Returns whether duplicate targets are removed.
+  constexpr bool removeDuplicates() const noexcept
+    { return duplicates != Duplicates::keep; }
+  
+  /// Returns whether the number of paths to each target is recorded.
+  constexpr bool countPaths() const noexcept
+    { return duplicates == Duplicates::count; }
+  
+  /// Returns the number of threads to be used (resolving `nThreads` `0`).
+  unsigned int effectiveThreads() const noexcept
+    {
+      return (nThreads > 0)
+        ? nThreads: std::max(std::thread::hardware_concurrency(), 1U);
+    }
+  
+}; // icarus::ns::util::AssnsCrosserOptions
+
+
 // -----------------------------------------------------------------------------
 /**
  * @brief Builds multi-hop one-to-many associations from associated pairs.
@@ -195,6 +252,39 @@ namespace icarus::ns::util {
  * `C`s associated with `A1` twice, because there are two paths connecting
  * `A1` and `C1`.
  * 
+ * With many hops the number of paths can grow combinatorially, and so do the
+ * lists of targets. The duplicates can be instead suppressed while joining
+ * each hop, by constructing the object with `AssnsCrosserOptions` specifying
+ * `Duplicates::remove`: each target then appears only once in the list of each
+ * key, and the cost of the join becomes linear in the number of _distinct_
+ * targets. With `Duplicates::count`, duplicates are also suppressed, and the
+ * number of paths leading from the key to each target is available via
+ * `pathCounts()`:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * using icarus::ns::util::AssnsCrosserOptions;
+ * using icarus::ns::util::startFrom, icarus::ns::util::hopTo;
+ * icarus::ns::util::AssnsCrosser const AtoC{ event
+ *   , AssnsCrosserOptions{ AssnsCrosserOptions::Duplicates::count }
+ *   , startFrom<DataTypeA>{}
+ *   , hopTo<DataTypeB>{ "B" }
+ *   , hopTo<DataTypeC>{ "C" }
+ *   };
+ * 
+ * std::vector<art::Ptr<DataTypeC>> const& Cptrs = AtoC.assPtrs(A1ptr);
+ * std::vector<std::size_t> const& nPaths = AtoC.pathCounts(A1ptr);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * In the "diamond" example above, `Cptrs` would then contain `C1` only once,
+ * and `nPaths` would be `{ 2 }`.
+ * 
+ * 
+ * ### Parallel expansion
+ * 
+ * The associations are always read serially, but after each hop is read the
+ * expansion of the keys can be split among threads, by setting
+ * `AssnsCrosserOptions::nThreads`. The result does not depend on the number of
+ * threads. This pays off only for large association sets (e.g. PFParticles to
+ * hits), and joins with few keys are always executed serially.
+ * 
  * 
  * ### Comparison with `art::FindManyP`
  * 
@@ -334,6 +424,10 @@ class icarus::ns::util::AssnsCrosser
   using KeyPtr_t = typename This_t::KeyPtr_t;
   using TargetPtr_t = typename This_t::TargetPtr_t;
   using TargetPtrs_t = typename This_t::TargetPtrs_t;
+  using PathCounts_t = typename This_t::PathCounts_t;
+  
+  /// Type of options for the traversal.
+  using Options_t = AssnsCrosserOptions;
   
   /**
    * @brief Constructor: reads and joins the specified associations.
@@ -377,6 +471,29 @@ class icarus::ns::util::AssnsCrosser
     StartSpecs<KeyType> startSpec,
     InputSpecs<OtherTypes>... otherInputSpecs
     );
+  
+  /**
+   * @brief Constructor: reads and joins the specified associations.
+   * @tparam Event type to read the data from (`art::Event` interface)
+   * @param event data source
+   * @param options options for the traversal of the associations
+   * @param startSpec specifies which type to start hopping from
+   * @param otherInputSpecs input specifications for all the hops
+   * 
+   * This constructor acts like
+   * `AssnsCrosser(Event const&, StartSpecs<KeyType>, InputSpecs<OtherTypes>...)`
+   * with the traversal customized by the specified `options`.
+   */
+  template <typename Event>
+  AssnsCrosser(
+    Event const& event,
+    Options_t const& options,
+    StartSpecs<KeyType> startSpec,
+    InputSpecs<OtherTypes>... otherInputSpecs
+    );
+  
+  /// Returns the options used for the traversal.
+  Options_t const& options() const noexcept { return fOptions; }
 
   /**
    * @brief Returns pointers to all target objects associated to `keyPtr`.
@@ -470,6 +587,18 @@ class icarus::ns::util::AssnsCrosser
    */
   TargetPtr_t const& assPtr(KeyPtr_t const& keyPtr) const;
   
+  /**
+   * @brief Returns the number of paths to each target associated to `keyPtr`.
+   * @param keyPtr pointer to the key object to find the associated objects of
+   * @return the number of paths, in the same order as `assPtrs(keyPtr)`
+   * 
+   * The path counts are recorded only when the object is constructed with the
+   * `AssnsCrosserOptions::Duplicates::count` option; otherwise, or if the key
+   * is unknown, an empty collection is returned.
+   */
+  PathCounts_t const& pathCounts(KeyPtr_t const& keyPtr) const
+    { return fAssnsMap.pathCounts(keyPtr); }
+  
   
     private:
   
@@ -481,6 +610,8 @@ class icarus::ns::util::AssnsCrosser
   /// Which algorithm to use for traversing the associations.
   enum class HoppingAlgo { forward, backward };
   
+  Options_t fOptions; ///< Options for the traversal.
+  
   AssnsMap_t fAssnsMap; ///< Associated objects per key.
   
   
@@ -783,6 +914,9 @@ class icarus::ns::util::details::AssnsCrosserTypes {
   using TargetPtr_t = art::Ptr<Target_t>;
   using TargetPtrs_t = std::vector<TargetPtr_t>;
   
+  /// Number of paths to each of the targets of a key.
+  using PathCounts_t = std::vector<std::size_t>;
+  
   using Assns_t = art::Assns<Key_t, Target_t>;
   
   using AssnsMap_t = std::unordered_map<KeyPtr_t, TargetPtrs_t>;
@@ -803,6 +937,7 @@ class icarus::ns::util::details::AssnsMap
   using KeyPtr_t = typename This_t::KeyPtr_t;
   using TargetPtr_t = typename This_t::TargetPtr_t;
   using TargetPtrs_t = typename This_t::TargetPtrs_t;
+  using PathCounts_t = typename This_t::PathCounts_t;
   
   using AssnsMap_t = typename This_t::AssnsMap_t;
   
@@ -821,6 +956,12 @@ class icarus::ns::util::details::AssnsMap
   /// The content of `targetPtrs` is lost.
   This_t& add(KeyPtr_t const& keyPtr, TargetPtrs_t&& targetPtrs);
   
+  /// Add all `targetPtrs` associated to a `keyPtr`, each reached via the
+  /// number of paths in the matching element of `pathCounts`
+  /// (duplicates not checked). The content of the arguments is lost.
+  This_t& add
+    (KeyPtr_t const& keyPtr, TargetPtrs_t&& targetPtrs, PathCounts_t&& counts);
+  
   /// Returns the pointers associated to `keyPtr` (empty if none).
   /// The key is not associated with them any more.
   TargetPtrs_t yieldAssPtrs(KeyPtr_t const& keyPtr);
@@ -830,7 +971,7 @@ class icarus::ns::util::details::AssnsMap
   AssnsMap_t& assnsMap() { return fAssnsMap; }
   
   /// Removes all the stored associations and keys.
-  void clear() { fAssnsMap.clear(); }
+  void clear() { fAssnsMap.clear(); fPathCounts.clear(); }
   
   ///@}
   // --- END ---- Modify interface ---------------------------------------------
@@ -846,6 +987,10 @@ class icarus::ns::util::details::AssnsMap
   /// Returns the pointers associated to `keyPtr` (empty if none).
   TargetPtrs_t const& assPtrs(KeyPtr_t const& keyPtr) const;
   
+  /// Returns the number of paths to each of the `assPtrs(keyPtr)`
+  /// (empty if not recorded, meaning one path each).
+  PathCounts_t const& pathCounts(KeyPtr_t const& keyPtr) const;
+  
   /// Returns a map of key pointers to a sequence of associated target pointers.
   AssnsMap_t const& assnsMap() const { return fAssnsMap; }
   
@@ -866,9 +1011,13 @@ class icarus::ns::util::details::AssnsMap
     private:
   
   static TargetPtrs_t const EmptyColl;
+  static PathCounts_t const EmptyCounts;
   
   AssnsMap_t fAssnsMap; ///< Key pointer -> all associated target pointers.
   
+  /// Key pointer -> number of paths to each associated target (if recorded).
+  std::unordered_map<KeyPtr_t, PathCounts_t> fPathCounts;
+  
 }; // icarus::ns::util::details::AssnsMap
 
 
@@ -889,6 +1038,60 @@ struct icarus::ns::util::details::PointerSelector {
 }; // icarus::ns::util::details::PointerSelector
 
 
+// -----------------------------------------------------------------------------
+/**
+ * @brief Records a value for pointers of type `T`, until the next "epoch".
+ * @tparam T type of the pointed data
+ * 
+ * Each data product has a table indexed by the `key()` of the pointers, where
+ * each entry is stamped with the epoch it was last marked in.
+ * Starting a new epoch (`newEpoch()`) invalidates all marks in constant time.
+ * The tables grow up to the largest key that has been marked.
+ */
+template <typename T>
+class icarus::ns::util::details::PtrEpochMarker {
+  
+    public:
+  using Ptr_t = art::Ptr<T>;
+  
+  /// Value returned by `mark()` for pointers not marked in this epoch.
+  static constexpr std::size_t NotMarked
+    = std::numeric_limits<std::size_t>::max();
+  
+  /// Forgets all the marks.
+  void newEpoch();
+  
+  /**
+   * @brief Marks `ptr` with `value`, unless already marked in this epoch.
+   * @param ptr the pointer to be marked
+   * @param value the value to mark `ptr` with
+   * @return the value `ptr` was already marked with, or `NotMarked` if none
+   */
+  std::size_t mark(Ptr_t const& ptr, std::size_t value);
+  
+    private:
+  
+  using Epoch_t = unsigned int;
+  
+  /// Marks of the pointers of a single data product.
+  struct ProductMarks_t {
+    art::ProductID ID; ///< ID of the data product.
+    std::vector<Epoch_t> epochs; ///< Epoch of the last mark, by pointer key.
+    std::vector<std::size_t> values; ///< Marked value, by pointer key.
+  }; // ProductMarks_t
+  
+  Epoch_t fEpoch = 1U; ///< Current epoch (stamps start at `0`).
+  
+  std::vector<ProductMarks_t> fProducts; ///< Marks of all data products.
+  
+  std::size_t fLastProduct = 0U; ///< Index of the last product marked.
+  
+  /// Returns the marks of the product with the specified `ID`.
+  ProductMarks_t& productMarks(art::ProductID ID);
+  
+}; // icarus::ns::util::details::PtrEpochMarker
+
+
 // -----------------------------------------------------------------------------
 // ---  template implementation
 // -----------------------------------------------------------------------------
@@ -949,6 +1152,10 @@ template <typename KeyType, typename TargetType>
 typename icarus::ns::util::details::AssnsMap<KeyType, TargetType>::TargetPtrs_t
 const icarus::ns::util::details::AssnsMap<KeyType, TargetType>::EmptyColl;
 
+template <typename KeyType, typename TargetType>
+typename icarus::ns::util::details::AssnsMap<KeyType, TargetType>::PathCounts_t
+const icarus::ns::util::details::AssnsMap<KeyType, TargetType>::EmptyCounts;
+
 
 // -----------------------------------------------------------------------------
 template <typename KeyType, typename TargetType>
@@ -977,6 +1184,19 @@ auto icarus::ns::util::details::AssnsMap<KeyType, TargetType>::add
 } // icarus::ns::util::details::AssnsMap<>::add(TargetPtrs_t&&)
 
 
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename TargetType>
+auto icarus::ns::util::details::AssnsMap<KeyType, TargetType>::add
+  (KeyPtr_t const& keyPtr, TargetPtrs_t&& targetPtrs, PathCounts_t&& counts)
+  -> This_t&
+{
+  assert(targetPtrs.size() == counts.size());
+  append(fAssnsMap[keyPtr], std::move(targetPtrs));
+  append(fPathCounts[keyPtr], std::move(counts));
+  return *this;
+} // icarus::ns::util::details::AssnsMap<>::add(TargetPtrs_t&&, PathCounts_t&&)
+
+
 // -----------------------------------------------------------------------------
 template <typename KeyType, typename TargetType>
 auto icarus::ns::util::details::AssnsMap<KeyType, TargetType>::assPtrs
@@ -987,6 +1207,16 @@ auto icarus::ns::util::details::AssnsMap<KeyType, TargetType>::assPtrs
 } // icarus::ns::util::details::AssnsMap<>::assPtrs()
 
 
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename TargetType>
+auto icarus::ns::util::details::AssnsMap<KeyType, TargetType>::pathCounts
+  (KeyPtr_t const& keyPtr) const -> PathCounts_t const&
+{
+  auto const it = fPathCounts.find(keyPtr);
+  return (it == fPathCounts.end())? EmptyCounts: it->second;
+} // icarus::ns::util::details::AssnsMap<>::pathCounts()
+
+
 // -----------------------------------------------------------------------------
 template <typename KeyType, typename TargetType>
 auto icarus::ns::util::details::AssnsMap<KeyType, TargetType>::keyProductIDs()
@@ -1097,6 +1327,52 @@ bool icarus::ns::util::details::PointerSelector<T>::operator()
 }
 
 
+// -----------------------------------------------------------------------------
+// --- icarus::ns::util::details::PtrEpochMarker
+// -----------------------------------------------------------------------------
+template <typename T>
+void icarus::ns::util::details::PtrEpochMarker<T>::newEpoch() {
+  if (++fEpoch != 0) return;
+  // the epoch counter wrapped around: old stamps might look current
+  for (ProductMarks_t& marks: fProducts)
+    std::fill(marks.epochs.begin(), marks.epochs.end(), Epoch_t{ 0 });
+  fEpoch = 1U;
+} // icarus::ns::util::details::PtrEpochMarker<>::newEpoch()
+
+
+// -----------------------------------------------------------------------------
+template <typename T>
+std::size_t icarus::ns::util::details::PtrEpochMarker<T>::mark
+  (Ptr_t const& ptr, std::size_t value)
+{
+  ProductMarks_t& marks = productMarks(ptr.id());
+  std::size_t const key = ptr.key();
+  if (key >= marks.epochs.size()) {
+    marks.epochs.resize(key + 1, Epoch_t{ 0 });
+    marks.values.resize(key + 1, NotMarked);
+  }
+  if (marks.epochs[key] == fEpoch) return marks.values[key];
+  marks.epochs[key] = fEpoch;
+  marks.values[key] = value;
+  return NotMarked;
+} // icarus::ns::util::details::PtrEpochMarker<>::mark()
+
+
+// -----------------------------------------------------------------------------
+template <typename T>
+auto icarus::ns::util::details::PtrEpochMarker<T>::productMarks
+  (art::ProductID ID) -> ProductMarks_t&
+{
+  // there are usually very few products, and pointers come in runs
+  if ((fLastProduct < fProducts.size()) && (fProducts[fLastProduct].ID == ID))
+    return fProducts[fLastProduct];
+  for (fLastProduct = 0; fLastProduct < fProducts.size(); ++fLastProduct)
+    if (fProducts[fLastProduct].ID == ID) return fProducts[fLastProduct];
+  fProducts.push_back({ ID, {}, {} });
+  return fProducts.back();
+} // icarus::ns::util::details::PtrEpochMarker<>::productMarks()
+
+
 // -----------------------------------------------------------------------------
 // ---  icarus::ns::util::InputSpec and related
 // -----------------------------------------------------------------------------
@@ -1241,6 +1517,7 @@ struct icarus::ns::util::details::MapJoiner {
    * @brief Returns a association map from `KeyType` to `TargetType`.
    * @tparam Event a data repository (`art::Event`-like interface)
    * @param event the event to read the associations from
+   * @param options options for the traversal
    * @param firstHopInputSpec specification for the first hop associations
    * @param otherHopInputSpec specification for all other hop associations
    * @return a association map from `KeyType` to `TargetType`
@@ -1254,6 +1531,7 @@ struct icarus::ns::util::details::MapJoiner {
   template <typename Event>
   static AssnsMap<KeyType, TargetType> joinBackward(
     Event const& event,
+    AssnsCrosserOptions const& options,
     InputSpecs<FirstHopType> firstHopInputSpec,
     InputSpecs<OtherHopTypes>... otherHopInputSpecs
   ) {
@@ -1267,9 +1545,9 @@ struct icarus::ns::util::details::MapJoiner {
         // 1 is the first hop (KeyType -> FirstHopType),
         // 2 is all the others (FirstHopType -> TargetType)
         auto assnsMap2 = MapJoiner<FirstHopType, OtherHopTypes...>::joinBackward
-          (event, std::move(otherHopInputSpecs)...);
+          (event, options, std::move(otherHopInputSpecs)...);
         return leftExtendMapWithAssns<KeyType>
-          (std::move(assnsMap2), event, std::move(firstHopInputSpec));
+          (std::move(assnsMap2), event, std::move(firstHopInputSpec), options);
       } // if more than one hop
     } // joinBackward()
   
@@ -1279,6 +1557,7 @@ struct icarus::ns::util::details::MapJoiner {
    * @tparam Event a data repository (`art::Event`-like interface)
    * @tparam Selector functor with `bool operator() const (art::Ptr<KeyType>)`
    * @param event the event to read the associations from
+   * @param options options for the traversal
    * @param firstHopInputSpec specification for the first hop associations
    * @param otherHopInputSpec specification for all other hop associations
    * @param selector if specified, only keys passing the selector are considered
@@ -1291,6 +1570,7 @@ struct icarus::ns::util::details::MapJoiner {
   template <typename Event, typename Selector>
   static AssnsMap<KeyType, TargetType> joinForward(
     Event const& event,
+    AssnsCrosserOptions const& options,
     InputSpecs<FirstHopType> firstHopInputSpec,
     InputSpecs<OtherHopTypes>... otherHopInputSpecs,
     std::optional<Selector> const& selector = NoSelector
@@ -1306,7 +1586,7 @@ struct icarus::ns::util::details::MapJoiner {
       }
       else {
         return multiRightExtendMapWithAssns
-          (std::move(leftMap), event, std::move(otherHopInputSpecs)...);
+          (std::move(leftMap), event, options, std::move(otherHopInputSpecs)...);
       }
     } // joinForward()
   
@@ -1365,6 +1645,7 @@ struct icarus::ns::util::details::MapJoiner {
    * @param map the map to be "extended"; it will be depleted of its content
    * @param event the data repository to read the associations from
    * @param specs the specification for the input of the extending association
+   * @param options options for the traversal
    * @return a new association map
    * 
    * The returned association map has `NewLeft` as the new key type and the same
@@ -1377,7 +1658,9 @@ struct icarus::ns::util::details::MapJoiner {
     typename NewLeft, typename Left, typename Right, typename Event, typename T
     >
   static AssnsMap<NewLeft, Right> leftExtendMapWithAssns(
-    AssnsMap<Left, Right>&& map, Event const& event, InputSpecs<T> specs) {
+    AssnsMap<Left, Right>&& map, Event const& event, InputSpecs<T> specs,
+    AssnsCrosserOptions const& options
+  ) {
       // read the associations with the material for the extension
       bool const bAutodetect = specs.hasEmptySpecs();
       std::vector<art::InputTag> const tags
@@ -1386,7 +1669,7 @@ struct icarus::ns::util::details::MapJoiner {
       if (bAutodetect) neededIDs = map.keyProductIDs();
       auto const leftMap = mapExtensionPreparation<NewLeft, Left, 1>
         (event, tags, std::move(neededIDs));
-      return joinMaps(leftMap, std::move(map));
+      return joinMaps(leftMap, map, options);
     } // leftExtendMapWithAssns()
   
   
@@ -1398,19 +1681,20 @@ struct icarus::ns::util::details::MapJoiner {
   multiRightExtendMapWithAssns(
     AssnsMap<Left, Right>&& map,
     Event const& event,
+    AssnsCrosserOptions const& options,
     InputSpecs<NextRight> nextInputSpec,
     InputSpecs<MoreRights>... otherInputSpec
     )
     {
       AssnsMap<Left, NextRight> assnsMap = rightExtendMapWithAssns<NextRight>
-        (std::move(map), event, std::move(nextInputSpec));
+        (std::move(map), event, std::move(nextInputSpec), options);
       
       if constexpr(sizeof...(MoreRights) == 0) {
         return assnsMap;
       }
       else {
         return multiRightExtendMapWithAssns
-          (std::move(assnsMap), event, std::move(otherInputSpec)...);
+          (std::move(assnsMap), event, options, std::move(otherInputSpec)...);
       }
     } // multiRightExtendMapWithAssns()
   
@@ -1424,6 +1708,7 @@ struct icarus::ns::util::details::MapJoiner {
    * @param map the map to be "extended"; it will be depleted of its content
    * @param event the data repository to read the associations from
    * @param specs the specification for the input of the extending association
+   * @param options options for the traversal
    * @return a new association map
    * 
    * The returned association map has `NewRight` as the new target type and the
@@ -1435,8 +1720,10 @@ struct icarus::ns::util::details::MapJoiner {
   template<
     typename NewRight, typename Left, typename Right, typename Event, typename T
     >
-  static AssnsMap<Left, NewRight> rightExtendMapWithAssns
-    (AssnsMap<Left, Right> map, Event const& event, InputSpecs<T> specs)
+  static AssnsMap<Left, NewRight> rightExtendMapWithAssns(
+    AssnsMap<Left, Right> map, Event const& event, InputSpecs<T> specs,
+    AssnsCrosserOptions const& options
+    )
     {
       // read the associations with the material for the extension
       bool const bAutodetect = specs.hasEmptySpecs();
@@ -1444,24 +1731,205 @@ struct icarus::ns::util::details::MapJoiner {
         = extractTagList(std::move(specs), event);
       std::vector<art::ProductID> neededIDs;
       if (bAutodetect) neededIDs = map.targetProductIDs();
-      auto rightMap = mapExtensionPreparation<Right, NewRight, 0U>
+      auto const rightMap = mapExtensionPreparation<Right, NewRight, 0U>
         (event, tags, std::move(neededIDs));
-      return joinMaps(map, std::move(rightMap));
+      return joinMaps(map, rightMap, options);
     }
   
-  /// Joins two maps in the middle, stealing content from the right one.
+  /// Minimum number of keys for each thread in parallel joins.
+  static constexpr std::size_t MinKeysPerThread = 128;
+  
+  /// Expansion of a single key, as stored by parallel joins.
+  template <typename Left, typename Right>
+  struct KeyExpansion_t {
+    art::Ptr<Left> keyPtr; ///< The expanded key.
+    std::vector<art::Ptr<Right>> targets; ///< The targets of the key.
+    std::vector<std::size_t> counts; ///< Path counts (if requested).
+  }; // KeyExpansion_t
+  
+  /**
+   * @brief Joins two maps in the middle, as directed by the `options`.
+   * @param leftMap map from the key to the middle type
+   * @param rightMap map from the middle to the target type
+   * @param options options for the traversal
+   * @return the joined map
+   * 
+   * Each key is expanded independently (see `expandKey()`).
+   * If `options` allow for more than one thread, the keys are split into
+   * contiguous blocks, each expanded by its own thread into its own buffer;
+   * the buffers are moved into the joined map at the end.
+   * Only the expansion is parallel: the input maps are just read.
+   */
   template <typename Left, typename Middle, typename Right>
-  static AssnsMap<Left, Right> joinMaps
-    (AssnsMap<Left, Middle> const& leftMap, AssnsMap<Middle, Right>&& rightMap)
+  static AssnsMap<Left, Right> joinMaps(
+    AssnsMap<Left, Middle> const& leftMap,
+    AssnsMap<Middle, Right> const& rightMap,
+    AssnsCrosserOptions const& options
+    )
     {
+      using Entry_t
+        = typename AssnsMap<Left, Middle>::AssnsMap_t::value_type;
+      using Expansion_t = KeyExpansion_t<Left, Right>;
+      
+      std::vector<Entry_t const*> entries;
+      entries.reserve(leftMap.assnsMap().size());
+      for (Entry_t const& entry: leftMap.assnsMap()) entries.push_back(&entry);
+      
+      // expands the keys in [ begin, end [ and hands the results to `store`
+      auto expandKeys = [&](std::size_t begin, std::size_t end, auto&& store)
+        {
+          PtrEpochMarker<Right> targetIndices;
+          for (std::size_t iEntry = begin; iEntry < end; ++iEntry) {
+            Entry_t const& entry = *(entries[iEntry]);
+            Expansion_t expansion{ entry.first, {}, {} };
+            expandKey(
+              entry.second, leftMap.pathCounts(entry.first), rightMap, options,
+              targetIndices, expansion.targets, expansion.counts
+              );
+            store(std::move(expansion));
+          } // for
+        };
+      
       AssnsMap<Left, Right> map;
-      for (auto& [ leftPtr, middlePtrs ]: leftMap.assnsMap()) {
+      auto storeInMap = [&map, countPaths=options.countPaths()]
+        (Expansion_t&& expansion)
+        {
+          if (countPaths) {
+            map.add(expansion.keyPtr,
+              std::move(expansion.targets), std::move(expansion.counts));
+          }
+          else map.add(expansion.keyPtr, std::move(expansion.targets));
+        };
+      
+      std::size_t const nKeys = entries.size();
+      std::size_t const nWorkers = std::min<std::size_t>
+        (options.effectiveThreads(), nKeys / MinKeysPerThread);
+      if (nWorkers <= 1) {
+        expandKeys(0, nKeys, storeInMap);
+        return map;
+      }
+      
+      std::vector<std::vector<Expansion_t>> buffers(nWorkers);
+      std::vector<std::exception_ptr> errors(nWorkers);
+      std::vector<std::thread> workers;
+      for (std::size_t iWorker = 0; iWorker < nWorkers; ++iWorker) {
+        std::size_t const begin = nKeys * iWorker / nWorkers;
+        std::size_t const end = nKeys * (iWorker + 1) / nWorkers;
+        workers.emplace_back(
+          [&expandKeys, &buffer=buffers[iWorker], &error=errors[iWorker],
+            begin, end]()
+          {
+            try {
+              buffer.reserve(end - begin);
+              expandKeys(begin, end, [&buffer](Expansion_t&& expansion)
+                { buffer.push_back(std::move(expansion)); });
+            }
+            catch (...) { error = std::current_exception(); }
+          });
+      } // for workers
+      for (std::thread& worker: workers) worker.join();
+      for (std::exception_ptr const& error: errors)
+        if (error) std::rethrow_exception(error);
+      
+      for (std::vector<Expansion_t>& buffer: buffers)
+        for (Expansion_t& expansion: buffer) storeInMap(std::move(expansion));
+      
+      return map;
+    } // joinMaps()
+  
+  /**
+   * @brief Collects all the targets reached from a key through the middle.
+   * @param middlePtrs the middle pointers associated to the key
+   * @param middleCounts number of paths to each of the `middlePtrs`
+   *                     (if empty, one each)
+   * @param rightMap map from the middle to the target type
+   * @param options options for the traversal
+   * @param targetIndices working area for the removal of duplicates
+   * @param[out] targets the list of targets to be filled
+   * @param[out] counts the number of paths to each target (if counting them)
+   * 
+   * When removing duplicates, the position in `targets` of each target already
+   * reached is recorded in `targetIndices`, indexed by pointer key, so that
+   * the cost of each key is linear in the number of paths from it.
+   * The path counts of the input maps, if present, are compounded.
+   */
+  template <typename Middle, typename Right>
+  static void expandKey(
+    std::vector<art::Ptr<Middle>> const& middlePtrs,
+    std::vector<std::size_t> const& middleCounts,
+    AssnsMap<Middle, Right> const& rightMap,
+    AssnsCrosserOptions const& options,
+    PtrEpochMarker<Right>& targetIndices,
+    std::vector<art::Ptr<Right>>& targets,
+    std::vector<std::size_t>& counts
+    )
+    {
+      using Marker_t = PtrEpochMarker<Right>;
+      using PathCounts_t = typename AssnsMap<Middle, Right>::PathCounts_t;
+      
+      if (!options.removeDuplicates()) {
         for (art::Ptr<Middle> const& middlePtr: middlePtrs) {
-          map.add(leftPtr, rightMap.yieldAssPtrs(middlePtr));
+          // copy: other left pointers may be associated with the same middle
+          append(targets, rightMap.assPtrs(middlePtr));
         } // for middle pointers
+        return;
+      }
+      
+      bool const countPaths = options.countPaths();
+      
+      targetIndices.newEpoch();
+      for (std::size_t iMiddle = 0; iMiddle < middlePtrs.size(); ++iMiddle) {
+        art::Ptr<Middle> const& middlePtr = middlePtrs[iMiddle];
+        std::size_t const nMiddlePaths
+          = middleCounts.empty()? 1: middleCounts[iMiddle];
+        
+        auto const& rightPtrs = rightMap.assPtrs(middlePtr);
+        PathCounts_t const& rightCounts = rightMap.pathCounts(middlePtr);
+        for (std::size_t iRight = 0; iRight < rightPtrs.size(); ++iRight) {
+          std::size_t const index
+            = targetIndices.mark(rightPtrs[iRight], targets.size());
+          std::size_t const nPaths = countPaths
+            ? nMiddlePaths * (rightCounts.empty()? 1: rightCounts[iRight])
+            : 0;
+          if (index == Marker_t::NotMarked) {
+            targets.push_back(rightPtrs[iRight]);
+            if (countPaths) counts.push_back(nPaths);
+          }
+          else if (countPaths) counts[index] += nPaths;
+        } // for right pointers
+      } // for middle pointers
+      
+    } // expandKey()
+  
+  /// Returns a copy of `map` where each target is listed once per key.
+  template <typename Left, typename Right>
+  static AssnsMap<Left, Right> removeDuplicates
+    (AssnsMap<Left, Right> const& map, bool countPaths)
+    {
+      using Marker_t = PtrEpochMarker<Right>;
+      using PathCounts_t = typename AssnsMap<Left, Right>::PathCounts_t;
+      
+      AssnsMap<Left, Right> uniqueMap;
+      Marker_t targetIndices; // position of each target in `targets`
+      for (auto const& [ leftPtr, rightPtrs ]: map.assnsMap()) {
+        std::vector<art::Ptr<Right>> targets;
+        PathCounts_t counts;
+        targetIndices.newEpoch();
+        for (art::Ptr<Right> const& rightPtr: rightPtrs) {
+          std::size_t const index = targetIndices.mark(rightPtr, targets.size());
+          if (index == Marker_t::NotMarked) {
+            targets.push_back(rightPtr);
+            if (countPaths) counts.push_back(1);
+          }
+          else if (countPaths) ++counts[index];
+        } // for right pointers
+        
+        if (countPaths)
+          uniqueMap.add(leftPtr, std::move(targets), std::move(counts));
+        else uniqueMap.add(leftPtr, std::move(targets));
       } // for left map
-      return map;
-    } // joinMaps()
+      return uniqueMap;
+    } // removeDuplicates()
   
   
   /**
@@ -1622,7 +2090,22 @@ icarus::ns::util::AssnsCrosser<KeyType, OtherTypes...>::AssnsCrosser(
   StartSpecs<KeyType> startSpecs,
   InputSpecs<OtherTypes>... otherInputSpecs
 )
-  : fAssnsMap
+  : AssnsCrosser
+    { event, Options_t{}, std::move(startSpecs), std::move(otherInputSpecs)... }
+{}
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+template <typename Event>
+icarus::ns::util::AssnsCrosser<KeyType, OtherTypes...>::AssnsCrosser(
+  Event const& event,
+  Options_t const& options,
+  StartSpecs<KeyType> startSpecs,
+  InputSpecs<OtherTypes>... otherInputSpecs
+)
+  : fOptions{ options }
+  , fAssnsMap
     { prepare(event, std::move(startSpecs), std::move(otherInputSpecs)... ) }
 {}
 
@@ -1652,21 +2135,34 @@ auto icarus::ns::util::AssnsCrosser<KeyType, OtherTypes...>::prepare(
   StartSpecs<KeyType> startSpecs, InputSpecs<OtherTypes>... otherInputSpecs
 ) const -> AssnsMap_t
 {
+  using MapJoiner_t = details::MapJoiner<KeyType, OtherTypes...>;
+  
   std::optional<details::PointerSelector<Key_t>> keySelector
     = keysFromSpecs(event, startSpecs);
   HoppingAlgo const algo
     = chooseTraversalAlgorithm(startSpecs, otherInputSpecs...);
+  AssnsMap_t map;
   switch (algo) {
     case HoppingAlgo::forward:
-      return details::MapJoiner<KeyType, OtherTypes...>::joinForward
-        (event, std::move(otherInputSpecs)..., keySelector);
+      map = MapJoiner_t::joinForward
+        (event, fOptions, std::move(otherInputSpecs)..., keySelector);
+      break;
     case HoppingAlgo::backward:
-      return details::MapJoiner<KeyType, OtherTypes...>::joinBackward
-        (event, std::move(otherInputSpecs)... );
+      map = MapJoiner_t::joinBackward
+        (event, fOptions, std::move(otherInputSpecs)... );
+      break;
     default:
       throw std::logic_error
         { "Unexpected direction: " + std::to_string(static_cast<int>(algo)) };
   } // switch
+  
+  // with more hops, duplicates are removed while joining
+  if constexpr(sizeof...(OtherTypes) == 1) {
+    if (fOptions.removeDuplicates())
+      map = MapJoiner_t::removeDuplicates(map, fOptions.countPaths());
+  }
+  
+  return map;
 } // icarus::ns::util::AssnsCrosser<>::prepare()
 
 
@@ -1683,7 +2179,14 @@ auto icarus::ns::util::AssnsCrosser<KeyType, OtherTypes...>
    * Otherwise, we go backward (faster) unless there is no specification for
    * the last hop (in which case we can't start from the back).
    * 
-   * When both algorithms are available, the backward one is chosen.
+   * When both algorithms are available, the forward one is chosen, unless
+   * more than one thread is allowed and all the hops are explicitly specified
+   * (so that both algorithms read the same associations).
+   * In the forward traversal all the joins are keyed by `KeyType` objects,
+   * each accumulating its whole target list hop after hop, while in the
+   * backward traversal the joins before the last are keyed by the intermediate
+   * objects, which are usually more numerous and each with less work to do:
+   * their work is split more evenly among the threads.
    */
   
   bool const hasStartInfo = startSpecs.hasSpecs();
@@ -1717,6 +2220,14 @@ auto icarus::ns::util::AssnsCrosser<KeyType, OtherTypes...>
     bool const hasFirstSpecs
       = hasStartInfo || details::getElement<0>(otherInputSpecs...).hasSpecs();
     
+    if (hasStartInfo) return HoppingAlgo::forward;
+    
+    bool const allHopsSpecified
+      = (otherInputSpecs.hasSpecs() && ...)
+      && !(otherInputSpecs.hasEmptySpecs() || ...);
+    if (allHopsSpecified && (fOptions.effectiveThreads() > 1))
+      return HoppingAlgo::backward;
+    
     if (hasFirstSpecs) return HoppingAlgo::forward;
     if (hasEndSpecs) return HoppingAlgo::backward;
     
@@ -1823,6 +2334,20 @@ auto icarus::ns::util::makeAssnsCrosser(
 }
 
 
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes, typename Event>
+auto icarus::ns::util::makeAssnsCrosser(
+  Event const& event,
+  AssnsCrosserOptions const& options,
+  StartSpecs<KeyType> startSpecs,
+  InputSpecs<OtherTypes>... inputSpecs
+) -> AssnsCrosser<KeyType, OtherTypes...>
+{
+  return AssnsCrosser<KeyType, OtherTypes...>
+    (event, options, std::move(startSpecs), std::move(inputSpecs)...);
+}
+
+
 // -----------------------------------------------------------------------------
 
 #endif // ICARUSALG_UTILITIES_ASSNSCROSSER_H
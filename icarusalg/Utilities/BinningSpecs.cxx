@@ -12,6 +12,7 @@
 #include "icarusalg/Utilities/BinningSpecs.h"
 
 // C/C++ standard libraries
+#include <array>
 #include <utility> // std::move(), std::pair
 #include <cmath>
 #include <cassert>
@@ -34,6 +35,101 @@ namespace {
       { floorMult(lower, width), upper, width };
   }
   
+  
+  /// Returns the order of magnitude of `width` (a power of ten).
+  double orderOfMagnitude(double width)
+    { return std::pow(10.0, std::floor(std::log10(width))); }
+  
+  
+  /**
+   * @brief Table of powers of ten, to find the order of magnitude of a value.
+   * 
+   * The table holds the same values as `std::pow(10.0, k)` for all `k` giving
+   * normal numbers, so that `orderOf()` returns the same value as
+   * `orderOfMagnitude()` without logarithms. Values too close to a power of ten
+   * (where `std::log10()` rounding decides) are delegated to
+   * `orderOfMagnitude()`, as well as values outside the table.
+   */
+  class PowersOfTen {
+    
+    static constexpr int MinExp = -307; ///< Smallest tabulated exponent.
+    static constexpr int MaxExp = 308; ///< Largest tabulated exponent.
+    
+    /// Relative distance from a power of ten below which we defer.
+    static constexpr double Tolerance = 1e-9;
+    
+    std::array<double, MaxExp - MinExp + 1> fPowers; ///< The table.
+    
+    /// Returns the power of ten with exponent `k` (within the table range).
+    double power(int k) const { return fPowers[k - MinExp]; }
+    
+      public:
+    
+    PowersOfTen()
+      {
+        for (int k = MinExp; k <= MaxExp; ++k)
+          fPowers[k - MinExp] = std::pow(10.0, static_cast<double>(k));
+      }
+    
+    /// Returns the same as `orderOfMagnitude(width)`.
+    double orderOf(double width) const
+      {
+        if (!(width >= power(MinExp)) || !(width < power(MaxExp)))
+          return orderOfMagnitude(width);
+        
+        // estimate from the binary exponent (log10(2) ~ 0.30103), then refine
+        int exp2;
+        std::frexp(width, &exp2);
+        int k = static_cast<int>(std::floor((exp2 - 1) * 0.30102999566398120));
+        if (k < MinExp) k = MinExp;
+        if (k >= MaxExp) k = MaxExp - 1;
+        while ((k > MinExp) && (power(k) > width)) --k;
+        while ((k < MaxExp - 1) && (power(k + 1) <= width)) ++k;
+        
+        double const lowerPower = power(k), upperPower = power(k + 1);
+        if ((width - lowerPower <= lowerPower * Tolerance)
+          || (upperPower - width <= upperPower * Tolerance)
+        ) {
+          return orderOfMagnitude(width);
+        }
+        return lowerPower;
+      }
+    
+  }; // class PowersOfTen
+  
+  
+  /// Implementation of `chooseBinningWidth()` with known order of magnitude.
+  double chooseBinningWidthWithOrder(
+    double order, double lower, double upper,
+    double width, unsigned long nBins,
+    double const* beginHints, double const* endHints,
+    double allowedStretch
+  ) {
+    
+    double span = upper - lower;
+    
+    // don't consider binnings stretching the range more than allowed;
+    // if no hinted binning is good enough, exact `width` will be used
+    using Quality_t = std::pair<double, double>; // stretch/distance from request
+    
+    double best_w = width;
+    Quality_t best_d { allowedStretch, 0.0 };
+    for (double const* factor = beginHints; factor != endHints; ++factor) {
+      double const w = order * *factor;
+      Quality_t const d {
+        std::abs((w * nBins / span) - 1.0),
+        std::abs(w - width)
+      };
+      if (d >= best_d) continue;
+      best_d = d;
+      best_w = w;
+    } // for
+    
+    return best_w;
+    
+  } // chooseBinningWidthWithOrder()
+  
+  
 } // local namespace
 
 
@@ -150,30 +246,46 @@ double icarus::ns::util::chooseBinningWidth(
   
   // order of magnitude of the bins: width will be chosen as this power-of-ten
   // multiplied by one of the hinted values
-  double const order = std::pow(10.0, std::floor(std::log10(width)));
+  double const order = orderOfMagnitude(width);
   
-  double span = upper - lower;
+  return chooseBinningWidthWithOrder(
+    order, lower, upper, width, nBins, hints.begin(), hints.end(),
+    allowedStretch
+    );
   
-  // don't consider binnings stretching the range more than allowed;
-  // if no hinted binning is good enough, exact `width` will be used
-  using Quality_t = std::pair<double, double>; // stretch/distance from request
+} // icarus::ns::util::chooseBinningWidth()
+
+
+// -----------------------------------------------------------------------------
+auto icarus::ns::util::makeBinningsFromNBins(
+  gsl::span<BinningRequest const> requests,
+  std::initializer_list<double> hints /* = DefaultBinningHints */,
+  double allowedStretch /* = DefaultAllowedBinningStretch */
+) -> std::vector<BinningSpecs> {
   
-  double best_w = width;
-  Quality_t best_d { allowedStretch, 0.0 };
-  for (double const factor: hints) {
-    double const w = order * factor;
-    Quality_t const d {
-      std::abs((w * nBins / span) - 1.0),
-      std::abs(w - width)
-    };
-    if (d >= best_d) continue;
-    best_d = d;
-    best_w = w;
+  assert(allowedStretch > 0.0);
+  
+  static PowersOfTen const powersOfTen;
+  
+  std::vector<BinningSpecs> binnings;
+  binnings.reserve(requests.size());
+  for (BinningRequest const& request: requests) {
+    
+    double const width = (request.upper - request.lower) / request.nBins;
+    assert(width > 0.0);
+    
+    double const finalWidth = chooseBinningWidthWithOrder(
+      powersOfTen.orderOf(width), request.lower, request.upper,
+      width, request.nBins, hints.begin(), hints.end(), allowedStretch
+      );
+    binnings.push_back
+      (makeBinningAlignedTo0(request.lower, request.upper, finalWidth));
+    
   } // for
   
-  return best_w;
+  return binnings;
   
-} // icarus::ns::util::chooseBinningWidth()
+} // icarus::ns::util::makeBinningsFromNBins()
 
 
 // -----------------------------------------------------------------------------
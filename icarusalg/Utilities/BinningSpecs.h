@@ -11,15 +11,20 @@
 #define ICARUSALG_UTILITIES_BINNINGSPECS_H
 
 
+// C++ core guideline library
+#include "gsl/span"
+
 // C/C++ standard libraries
 #include <initializer_list>
 #include <utility> // std::pair
+#include <vector>
 
 
 // -----------------------------------------------------------------------------
 namespace icarus::ns::util {
   
   class BinningSpecs;
+  struct BinningRequest;
   
   // --- BEGIN -- Algorithms for binning ---------------------------------------
   /**
@@ -149,12 +154,44 @@ namespace icarus::ns::util {
     double allowedStretch = DefaultAllowedBinningStretch
     );
   
+  
+  /**
+   * @brief Returns the "optimal" binning for each of the requests.
+   * @param requests the range and desired number of bins of each binning
+   * @param hints set of bin sizes to consider
+   *              (not including the order of magnitude)
+   * @param allowedStretch how much the resulting range can differ from the
+   *        desired one (`upper - lower`), as a factor
+   * @return the optimal binnings, one per request and in the same order
+   * @see `makeBinningFromNBins()`
+   * 
+   * Each binning is the same as the one returned by `makeBinningFromNBins()`
+   * for the same request. The order of magnitude of the bin width is looked
+   * up in a table of powers of ten instead of being computed with logarithm
+   * and power (the computation is still performed when the width is very
+   * close to a power of ten, to preserve the exact same rounding).
+   */
+  std::vector<BinningSpecs> makeBinningsFromNBins(
+    gsl::span<BinningRequest const> requests,
+    std::initializer_list<double> hints = DefaultBinningHints,
+    double allowedStretch = DefaultAllowedBinningStretch
+    );
+  
   // --- END ---- Algorithms ---------------------------------------------------
   
   
 } // namespace icarus::ns::util
 
 
+// -----------------------------------------------------------------------------
+/// Parameters of a binning request: full range and number of bins.
+struct icarus::ns::util::BinningRequest {
+  double lower; ///< Desired lower limit of the binning.
+  double upper; ///< Desired upper limit of the binning.
+  unsigned long nBins; ///< Desired number of bins.
+}; // struct icarus::ns::util::BinningRequest
+
+
 // -----------------------------------------------------------------------------
 /**
  * @brief Data structure holding binning information.
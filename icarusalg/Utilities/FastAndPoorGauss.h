@@ -10,9 +10,14 @@
 // ROOT
 #include "TMath.h" // TMath::ErfInverse()
 
+// Guideline Support Library
+#include "gsl/span"
+
 // C/C++ standard library
 #include <array>
-#include <type_traits> // std::is_integral_v, std::is_signed_v
+#include <algorithm> // std::min()
+#include <limits> // std::numeric_limits<>
+#include <type_traits> // std::is_integral_v, std::is_signed_v, ...
 #include <cmath> // std::sqrt()
 #include <cstddef> // std::size_t
 
@@ -35,6 +40,17 @@ namespace util::details {
   
   
   // ---------------------------------------------------------------------------
+  /// Returns the base 2 logarithm of `value`, which must be a power of 2.
+  template <typename T>
+  constexpr unsigned int log2OfPowerOfTwo(T value)
+    {
+      unsigned int bits = 0U;
+      while (value >>= 1) ++bits;
+      return bits;
+    } // log2OfPowerOfTwo()
+  
+  
+  // ---------------------------------------------------------------------------
   
   
 } // namespace util::details
@@ -74,6 +90,27 @@ namespace util {
  * (see e.g. `util::GaussianTransformer`).
  * 
  * 
+ * Input from random integral words
+ * ---------------------------------
+ * 
+ * Random engines usually produce uniformly distributed integral words, which
+ * are then converted into _u_. Since `N` is a power of 2, the table index is
+ * directly given by the highest bits of the word, and `transformWord()` and
+ * `transformWords()` skip the conversion to and from real numbers:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * util::FastAndPoorGauss<32768U, float> const toGauss;
+ * std::vector<std::uint32_t> words = ... ; // e.g. from a std::mt19937
+ * std::vector<float> noise(words.size());
+ * toGauss.transformWords(gsl::span<std::uint32_t const>{ words },
+ *   gsl::span<float>{ noise }, util::GaussianTransformer<float>{ 0.0, 2.5 });
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The word _w_ of an unsigned type of _B_ bits maps into the same value as
+ * @f$ u = w / 2^{B} @f$.
+ * The bulk loop has no dependency between its elements, which allows the
+ * compiler to vectorize it (including the table lookup, with a "gather"
+ * instruction where available).
+ * 
+ * 
  * Resources
  * ----------
  * 
@@ -101,12 +138,53 @@ class util::FastAndPoorGauss {
   
   static constexpr std::size_t NPoints = N; ///< Number of sampled points.
   
+  /// Number of bits of a random word used to pick a sampled point.
+  static constexpr unsigned int NBits = util::details::log2OfPowerOfTwo(N);
+  
   //@{
   /// Returns the Gaussian distributed value corresponding to `u`.
   Data_t transform(Data_t const u) const { return fSamples[indexOf(u)]; }
   Data_t operator() (Data_t const u) const { return transform(u); }
   //@}
   
+  /// Returns the Gaussian distributed value from the random integral `word`.
+  template <typename UInt>
+  Data_t transformWord(UInt const word) const
+    { return fSamples[indexOfWord(word)]; }
+  
+  /**
+   * @brief Transforms random integral words into Gaussian distributed values.
+   * @tparam UInt type of the random words (unsigned integral)
+   * @tparam Out type of the output values (`float` or `double`)
+   * @param words uniformly distributed random words
+   * @param out the destination of the values
+   * @return the number of values written
+   * 
+   * The values are written in sequence into `out`, up to the smaller of the
+   * size of `words` and of `out`.
+   */
+  template <typename UInt, typename Out>
+  std::size_t transformWords
+    (gsl::span<UInt const> words, gsl::span<Out> out) const;
+  
+  /**
+   * @brief Transforms random words into values from a Gaussian distribution.
+   * @tparam UInt type of the random words (unsigned integral)
+   * @tparam Out type of the output values (`float` or `double`)
+   * @param words uniformly distributed random words
+   * @param out the destination of the values
+   * @param target the transformation to the target distribution
+   * @return the number of values written
+   * 
+   * As `transformWords(gsl::span<UInt const>, gsl::span<Out>)`, but the
+   * values are also transformed by `target` in the same pass.
+   */
+  template <typename UInt, typename Out>
+  std::size_t transformWords(
+    gsl::span<UInt const> words, gsl::span<Out> out,
+    util::GaussianTransformer<Data_t> const& target
+    ) const;
+  
     private:
   /// Sampled points of inverse Gaussian.
   static std::array<Data_t, N> const fSamples;
@@ -114,6 +192,17 @@ class util::FastAndPoorGauss {
   /// Returns the index of the precomputed table serving the value `u`.
   std::size_t indexOf(Data_t u) const;
   
+  /// Returns the index of the precomputed table serving the random `word`.
+  template <typename UInt>
+  static constexpr std::size_t indexOfWord(UInt word);
+  
+  /// Implementation of `transformWords()`, with or without transformation.
+  template <bool Transform, typename UInt, typename Out>
+  static std::size_t transformWordsImpl(
+    gsl::span<UInt const> words, gsl::span<Out> out,
+    Data_t const mean, Data_t const stddev
+    );
+  
   /// Fills the pre-sampling table.
   static std::array<Data_t, NPoints> makeSamples();
   
@@ -236,6 +325,72 @@ std::size_t util::FastAndPoorGauss<N, T>::indexOf(Data_t u) const {
 } // util::FastAndPoorGauss<>::indexOf()
 
 
+// -----------------------------------------------------------------------------
+template <std::size_t N, typename T>
+template <typename UInt>
+constexpr std::size_t util::FastAndPoorGauss<N, T>::indexOfWord(UInt word) {
+  static_assert(std::is_integral_v<UInt> && std::is_unsigned_v<UInt>,
+    "Random words must be of an unsigned integral type.");
+  constexpr unsigned int WordBits = std::numeric_limits<UInt>::digits;
+  static_assert(NBits <= WordBits,
+    "Random words are too short for the number of sampled points.");
+  if constexpr (NBits == 0U) return 0U;
+  else return static_cast<std::size_t>(word >> (WordBits - NBits));
+} // util::FastAndPoorGauss<>::indexOfWord()
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t N, typename T>
+template <typename UInt, typename Out>
+std::size_t util::FastAndPoorGauss<N, T>::transformWords
+  (gsl::span<UInt const> words, gsl::span<Out> out) const
+{
+  return transformWordsImpl<false>
+    (words, out, Data_t{ 0.0 }, Data_t{ 1.0 });
+} // util::FastAndPoorGauss<>::transformWords()
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t N, typename T>
+template <typename UInt, typename Out>
+std::size_t util::FastAndPoorGauss<N, T>::transformWords(
+  gsl::span<UInt const> words, gsl::span<Out> out,
+  util::GaussianTransformer<Data_t> const& target
+) const {
+  return transformWordsImpl<true>(words, out, target.mean(), target.stdDev());
+} // util::FastAndPoorGauss<>::transformWords(GaussianTransformer)
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t N, typename T>
+template <bool Transform, typename UInt, typename Out>
+std::size_t util::FastAndPoorGauss<N, T>::transformWordsImpl(
+  gsl::span<UInt const> words, gsl::span<Out> out,
+  Data_t const mean, Data_t const stddev
+) {
+  static_assert(std::is_floating_point_v<Out>,
+    "Output values must be of a floating point type.");
+  
+  std::size_t const n = std::min<std::size_t>(words.size(), out.size());
+  
+  // plain pointers and a simple loop help the compiler vectorizing
+  UInt const* const in = words.data();
+  Out* const dest = out.data();
+  Data_t const* const samples = fSamples.data();
+  for (std::size_t i = 0; i < n; ++i) {
+    Data_t const z = samples[indexOfWord(in[i])];
+    if constexpr (Transform) {
+      dest[i] = static_cast<Out>
+        (util::GaussianTransformer<Data_t>::transform(z, mean, stddev));
+    }
+    else
+      dest[i] = static_cast<Out>(z);
+  } // for
+  
+  return n;
+} // util::FastAndPoorGauss<>::transformWordsImpl()
+
+
 // -----------------------------------------------------------------------------
 template <std::size_t N, typename T>
 auto util::FastAndPoorGauss<N, T>::makeSamples() -> std::array<Data_t, NPoints>
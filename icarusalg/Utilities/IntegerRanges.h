@@ -15,9 +15,13 @@
 #include <ostream>
 #include <vector>
 #include <initializer_list>
+#include <algorithm> // std::sort(), std::minmax_element()
 #include <numeric> // std::accumulate()
+#include <iterator> // std::distance()
+#include <thread>
 #include <stdexcept> // std::runtime_error
-#include <type_traits> // std::is_integral_v
+#include <type_traits> // std::is_integral_v, std::make_unsigned_t
+#include <cstdint> // std::uint64_t
 
 
 // -----------------------------------------------------------------------------
@@ -34,15 +38,28 @@ namespace icarus {
       typename IntegerRangesBase<T>::Data_t const& range
       );
     
+    /// Returns the position of the lowest bit set in `word` (not `0`).
+    constexpr unsigned int lowestBitSet(std::uint64_t word) noexcept;
+    
   } // namespace details
   // ---------------------------------------------------------------------------
   
   
+  /// Tag type for constructing `IntegerRanges` from unsorted input.
+  struct unsorted_t { explicit unsorted_t() = default; };
+  
+  /// Tag value for constructing `IntegerRanges` from unsorted input.
+  inline constexpr unsorted_t unsorted{};
+  
   template <typename T = int, bool CheckGrowing = false> class IntegerRanges;
   
   template <bool CheckGrowing = true , typename Coll>
   IntegerRanges<typename Coll::value_type, CheckGrowing> makeIntegerRanges
     (Coll const& coll);
+  
+  template <typename Coll>
+  IntegerRanges<typename Coll::value_type> makeIntegerRangesFromUnsorted
+    (Coll const& coll, unsigned int nThreads = 1U);
 
 
   template <typename T, bool CheckGrowing>
@@ -146,6 +163,11 @@ class icarus::details::IntegerRangesBase {
   template <bool CheckGrowing, typename BIter, typename EIter>
   static std::vector<Range_t> compactRange(BIter b, EIter e);
   
+  /// Fills the ranges from values in any order, using up to `nThreads`.
+  template <typename BIter, typename EIter>
+  static std::vector<Range_t> compactUnsortedRange
+    (BIter b, EIter e, unsigned int nThreads);
+  
   
   /// Returns `value` incremented by 1.
   static constexpr Data_t plusOne(Data_t value) noexcept;
@@ -155,9 +177,35 @@ class icarus::details::IntegerRangesBase {
   
     private:
   
+  using Offset_t = std::make_unsigned_t<Data_t>; ///< Offset from the minimum.
+  
+  /// Use a bitmap if the domain is not wider than this many times the values.
+  static constexpr std::size_t BitmapDensityFactor = 16U;
+  
+  /// Fewer values than this are sorted by comparison rather than radix sort.
+  static constexpr std::size_t MinRadixSortSize = 256U;
+  
+  /// Minimum number of values assigned to each thread.
+  static constexpr std::size_t MinValuesPerThread = 65536U;
+  
   std::vector<Range_t> fRanges; ///< List of current ranges.
   
   
+  /// Compacts the values in `[ b, e [` (which may be reordered).
+  static std::vector<Range_t> compactUnsortedValues(Data_t* b, Data_t* e);
+  
+  /// Compacts the values in `[ b, e [`, all within `lower` + `domain`.
+  static std::vector<Range_t> compactWithBitmap
+    (Data_t const* b, Data_t const* e, Data_t lower, Offset_t domain);
+  
+  /// Sorts the values in `[ b, e [` (all within `lower` + `domain`).
+  static void radixSort(Data_t* b, Data_t* e, Data_t lower, Offset_t domain);
+  
+  /// Merges sorted range lists, joining overlapping and contiguous ranges.
+  static std::vector<Range_t> mergeRanges
+    (std::vector<std::vector<Range_t>> const& rangeLists);
+  
+  
 }; // class icarus::details::IntegerRangesBase<>
 
 
@@ -209,6 +257,29 @@ class icarus::IntegerRanges: public icarus::details::IntegerRangesBase<T> {
   
   IntegerRanges(std::initializer_list<Data_t> data);
   
+  /**
+   * @brief Constructor: range from values between `b` and `e` in any order.
+   * @param b iterator to the first value
+   * @param e iterator past the last value
+   * @param nThreads maximum number of threads to use for large inputs
+   * 
+   * The input does not need to be sorted, and duplicates are allowed.
+   * The values are placed in a bitmap when they are dense in their domain,
+   * and sorted by a radix sort otherwise. When allowed more than one thread,
+   * large inputs are split in chunks compacted concurrently and then merged.
+   * 
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<int> data { 8, 4, 10, 2, 6, 5, 1, 4 };
+   * 
+   * icarus::IntegerRanges ranges
+   *   { icarus::unsorted, data.begin(), data.end() };
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * yields the same ranges as `{ 1, 2, 4, 5, 6, 8, 10 }`.
+   */
+  template <typename BIter, typename EIter>
+  IntegerRanges(unsorted_t, BIter b, EIter e, unsigned int nThreads = 1U);
+  
 }; // class icarus::IntegerRanges<>
 
 
@@ -223,10 +294,37 @@ auto icarus::makeIntegerRanges(Coll const& coll)
 } // icarus::makeIntegerRanges(Coll const& coll)
 
 
+// -----------------------------------------------------------------------------
+/// Returns a `IntegerRanges` object from the elements in `coll` in any order.
+template <typename Coll>
+auto icarus::makeIntegerRangesFromUnsorted
+  (Coll const& coll, unsigned int nThreads /* = 1U */)
+  -> IntegerRanges<typename Coll::value_type>
+{
+  return IntegerRanges<typename Coll::value_type>
+    { unsorted, begin(coll), end(coll), nThreads };
+} // icarus::makeIntegerRangesFromUnsorted()
+
+
 
 // -----------------------------------------------------------------------------
 // --- template implementation
 // -----------------------------------------------------------------------------
+constexpr unsigned int icarus::details::lowestBitSet
+  (std::uint64_t word) noexcept
+{
+  // de Bruijn sequence lookup on the isolated lowest bit
+  constexpr std::uint64_t DeBruijn = 0x03F79D71B4CB0A89ULL;
+  constexpr unsigned char Table[64] = {
+     0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+    62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+    63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+    46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+  };
+  return Table[((word & (~word + 1)) * DeBruijn) >> 58];
+} // icarus::details::lowestBitSet()
+
+
 // --- icarus::details::IntegerRangesBase<>::Range_t
 // -----------------------------------------------------------------------------
 template <typename T /* = int */>
@@ -381,6 +479,186 @@ auto icarus::details::IntegerRangesBase<T>::compactRange(BIter b, EIter e)
 } // icarus::details::IntegerRangesBase<>::compactRange()
 
 
+// -----------------------------------------------------------------------------
+template <typename T /* = int */>
+template <typename BIter, typename EIter>
+auto icarus::details::IntegerRangesBase<T>::compactUnsortedRange
+  (BIter b, EIter e, unsigned int nThreads)
+  -> std::vector<Range_t>
+{
+  std::vector<Data_t> values;
+  for (auto it = b; it != e; ++it) values.push_back(*it);
+  if (values.empty()) return {};
+  
+  Data_t* const begin = values.data();
+  Data_t* const end = begin + values.size();
+  
+  std::size_t const nChunks = std::max<std::size_t>(1U,
+    std::min<std::size_t>(nThreads, values.size() / MinValuesPerThread));
+  if (nChunks == 1U) return compactUnsortedValues(begin, end);
+  
+  //
+  // each thread compacts its own chunk, then the chunks are merged
+  //
+  std::vector<std::vector<Range_t>> chunkRanges(nChunks);
+  std::size_t const chunkSize = (values.size() + nChunks - 1) / nChunks;
+  std::vector<std::thread> threads;
+  threads.reserve(nChunks - 1);
+  for (std::size_t iChunk = 1; iChunk < nChunks; ++iChunk) {
+    Data_t* const chunkBegin = begin + iChunk * chunkSize;
+    Data_t* const chunkEnd = std::min(chunkBegin + chunkSize, end);
+    if (chunkBegin >= end) break;
+    threads.emplace_back([&ranges = chunkRanges[iChunk], chunkBegin, chunkEnd]()
+      { ranges = compactUnsortedValues(chunkBegin, chunkEnd); });
+  } // for
+  chunkRanges[0] = compactUnsortedValues(begin, begin + chunkSize);
+  for (std::thread& thread: threads) thread.join();
+  
+  return mergeRanges(chunkRanges);
+  
+} // icarus::details::IntegerRangesBase<>::compactUnsortedRange()
+
+
+// -----------------------------------------------------------------------------
+template <typename T /* = int */>
+auto icarus::details::IntegerRangesBase<T>::compactUnsortedValues
+  (Data_t* b, Data_t* e) -> std::vector<Range_t>
+{
+  if (b == e) return {};
+  
+  auto const [ iMin, iMax ] = std::minmax_element(b, e);
+  Data_t const lower = *iMin;
+  Offset_t const domain = static_cast<Offset_t>
+    (static_cast<Offset_t>(*iMax) - static_cast<Offset_t>(lower));
+  std::size_t const n = e - b;
+  
+  if (domain / BitmapDensityFactor < n)
+    return compactWithBitmap(b, e, lower, domain);
+  
+  if (n < MinRadixSortSize) std::sort(b, e);
+  else                      radixSort(b, e, lower, domain);
+  return compactRange<false>(b, e);
+  
+} // icarus::details::IntegerRangesBase<>::compactUnsortedValues()
+
+
+// -----------------------------------------------------------------------------
+template <typename T /* = int */>
+auto icarus::details::IntegerRangesBase<T>::compactWithBitmap
+  (Data_t const* b, Data_t const* e, Data_t lower, Offset_t domain)
+  -> std::vector<Range_t>
+{
+  // the domain is small enough to fit in memory (see `BitmapDensityFactor`)
+  std::size_t const nWords = static_cast<std::size_t>(domain) / 64U + 1U;
+  std::vector<std::uint64_t> bits(nWords, 0ULL);
+  for (Data_t const* it = b; it != e; ++it) {
+    std::size_t const offset = static_cast<Offset_t>
+      (static_cast<Offset_t>(*it) - static_cast<Offset_t>(lower));
+    bits[offset / 64U] |= (std::uint64_t{ 1 } << (offset % 64U));
+  }
+  
+  // returns the first bit from `pos` on with value `set` (or the total bits)
+  auto const findNext = [&bits, nWords](std::size_t pos, bool set)
+    {
+      std::size_t iWord = pos / 64U;
+      std::uint64_t const flip = set? 0ULL: ~0ULL;
+      std::uint64_t word = (bits[iWord] ^ flip) & (~0ULL << (pos % 64U));
+      while (word == 0ULL) {
+        if (++iWord == nWords) return nWords * 64U;
+        word = bits[iWord] ^ flip;
+      }
+      return iWord * 64U + lowestBitSet(word);
+    };
+  
+  auto const toValue = [lower](std::size_t offset)
+    {
+      return static_cast<Data_t>
+        (static_cast<Offset_t>(lower) + static_cast<Offset_t>(offset));
+    };
+  
+  std::vector<Range_t> ranges;
+  std::size_t const nBits = nWords * 64U;
+  std::size_t pos = 0;
+  while ((pos = findNext(pos, true)) < nBits) {
+    std::size_t const endPos = findNext(pos, false);
+    ranges.emplace_back(toValue(pos), toValue(endPos));
+    pos = endPos;
+  } // while
+  
+  return ranges;
+} // icarus::details::IntegerRangesBase<>::compactWithBitmap()
+
+
+// -----------------------------------------------------------------------------
+template <typename T /* = int */>
+void icarus::details::IntegerRangesBase<T>::radixSort
+  (Data_t* b, Data_t* e, Data_t lower, Offset_t domain)
+{
+  // least significant digit first, one byte at a time;
+  // bytes above the most significant one of the domain are all the same
+  std::size_t const n = e - b;
+  std::vector<Data_t> buffer(n);
+  Data_t* from = b;
+  Data_t* to = buffer.data();
+  
+  for (unsigned int shift = 0; shift < sizeof(Offset_t) * 8U; shift += 8U) {
+    if ((domain >> shift) == 0) break;
+    
+    auto const digit = [lower, shift](Data_t value)
+      {
+        return static_cast<std::size_t>((static_cast<Offset_t>
+          (static_cast<Offset_t>(value) - static_cast<Offset_t>(lower))
+          >> shift) & 0xFFU);
+      };
+    
+    std::size_t offsets[256] = {};
+    for (Data_t const* it = from; it != from + n; ++it) ++offsets[digit(*it)];
+    std::size_t total = 0;
+    for (std::size_t& count: offsets) {
+      std::size_t const c = count;
+      count = total;
+      total += c;
+    }
+    for (Data_t const* it = from; it != from + n; ++it)
+      to[offsets[digit(*it)]++] = *it;
+    
+    std::swap(from, to);
+  } // for digits
+  
+  if (from != b) std::copy(from, from + n, b);
+  
+} // icarus::details::IntegerRangesBase<>::radixSort()
+
+
+// -----------------------------------------------------------------------------
+template <typename T /* = int */>
+auto icarus::details::IntegerRangesBase<T>::mergeRanges
+  (std::vector<std::vector<Range_t>> const& rangeLists)
+  -> std::vector<Range_t>
+{
+  std::vector<Range_t> all;
+  all.reserve(std::accumulate(
+    rangeLists.begin(), rangeLists.end(), std::size_t{},
+    [](std::size_t s, std::vector<Range_t> const& l){ return s + l.size(); }
+    ));
+  for (std::vector<Range_t> const& ranges: rangeLists)
+    all.insert(all.end(), ranges.begin(), ranges.end());
+  std::sort(all.begin(), all.end(),
+    [](Range_t const& a, Range_t const& b){ return a.lower < b.lower; });
+  
+  std::vector<Range_t> merged;
+  for (Range_t const& range: all) {
+    if (!merged.empty() && (range.lower <= merged.back().upper)) {
+      if (merged.back().upper < range.upper) merged.back().upper = range.upper;
+      continue;
+    }
+    merged.push_back(range);
+  } // for
+  
+  return merged;
+} // icarus::details::IntegerRangesBase<>::mergeRanges()
+
+
 // -----------------------------------------------------------------------------
 template <typename T /* = int */>
 constexpr auto icarus::details::IntegerRangesBase<T>::plusOne
@@ -430,6 +708,15 @@ icarus::IntegerRanges<T, CheckGrowing>::IntegerRanges
   : IntegerRanges(data.begin(), data.end()) {}
 
 
+// -----------------------------------------------------------------------------
+template <typename T /* = int */, bool CheckGrowing /* = true */>
+template <typename BIter, typename EIter>
+icarus::IntegerRanges<T, CheckGrowing>::IntegerRanges
+  (unsorted_t, BIter b, EIter e, unsigned int nThreads /* = 1U */)
+  : Base_t{ Base_t::compactUnsortedRange(b, e, nThreads) }
+  {}
+
+
 // -----------------------------------------------------------------------------
 template <typename T, bool CheckGrowing>
 std::ostream& icarus::operator<<
@@ -0,0 +1,276 @@
+/**
+ * @file   icarusalg/Utilities/InteractionTypeCode.h
+ * @brief  Compact packed encoding of interaction metadata.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Utilities/WeakCurrentType.h`
+ *
+ * This is a header-only library.
+ */
+
+#ifndef ICARUSALG_UTILITIES_INTERACTIONTYPECODE_H
+#define ICARUSALG_UTILITIES_INTERACTIONTYPECODE_H
+
+
+// ICARUS libraries
+#include "icarusalg/Utilities/WeakCurrentType.h"
+
+// C++ core guideline library
+#include "gsl/span"
+
+// C++ standard library
+#include <algorithm> // std::fill()
+#include <string_view>
+#include <cassert>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uint8_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus { class InteractionTypeCode; }
+/**
+ * @brief Interaction metadata packed into a single 32-bit integer.
+ * @see `icarus::maskCurrentType()`, `icarus::maskFieldEqual()`
+ *
+ * This object stores small enumerated information about an interaction (like
+ * its weak current type) into a bit field, so that it can be saved in columnar
+ * data (e.g. trees) as a plain integer and selected with integer mask
+ * operations.
+ *
+ * Each piece of information is described by a `Field` type, which specifies
+ * the bits it occupies in the code. Predefined fields:
+ * * `CurrentTypeField`: the `WeakCurrentType::CurrentType`.
+ *
+ * Bits starting from `FirstFreeBit` are reserved to additional user-defined
+ * fields, which can be described with further `Field` types:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * using ModeField = icarus::InteractionTypeCode::Field
+ *   <icarus::InteractionTypeCode::FirstFreeBit, 4U>;
+ *
+ * icarus::InteractionTypeCode code { icarus::ChargedCurrentType };
+ * code.set<ModeField>(3U);
+ *
+ * std::cout << code.currentType().nameView() << " interaction, mode "
+ *   << code.get<ModeField>() << std::endl;
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The default-constructed code has a current type of `WeakCurrentType::any`
+ * and all other fields set to `0`.
+ */
+class icarus::InteractionTypeCode {
+
+    public:
+
+  using Code_t = std::uint32_t; ///< Type of the packed code.
+
+  /// Number of bits available in the code.
+  static constexpr unsigned int NBits = sizeof(Code_t) * 8U;
+
+
+  /**
+   * @brief Description of a field in the packed code.
+   * @tparam Offset position of the least significant bit of the field
+   * @tparam Width number of bits of the field
+   */
+  template <unsigned int Offset, unsigned int Width>
+  struct Field {
+
+    static_assert(Width > 0U, "Fields must have at least one bit.");
+    static_assert(Offset + Width <= NBits, "Field exceeds the code size.");
+
+    static constexpr unsigned int offset = Offset; ///< First bit.
+    static constexpr unsigned int width = Width; ///< Number of bits.
+
+    /// Largest value the field can hold.
+    static constexpr Code_t maxValue
+      = (Width == NBits)? ~Code_t{ 0 }: ((Code_t{ 1 } << Width) - 1U);
+
+    /// Mask of the bits of this field within the code.
+    static constexpr Code_t mask = maxValue << Offset;
+
+    /// Returns the value of this field in the specified `code`.
+    static constexpr Code_t extract(Code_t code)
+      { return (code >> Offset) & maxValue; }
+
+    /// Returns `code` with the value of this field replaced by `value`.
+    static constexpr Code_t insert(Code_t code, Code_t value)
+      { return (code & ~mask) | ((value & maxValue) << Offset); }
+
+  }; // struct Field
+
+
+  /// Field of the weak current type.
+  using CurrentTypeField = Field<0U, 2U>;
+
+  /// First bit not used by the predefined fields.
+  static constexpr unsigned int FirstFreeBit
+    = CurrentTypeField::offset + CurrentTypeField::width;
+
+
+  // --- BEGIN -- Constructors -------------------------------------------------
+
+  /// Default constructor: any current type, all other fields `0`.
+  constexpr InteractionTypeCode(): InteractionTypeCode{ WeakCurrentType{} } {}
+
+  /// Constructor: sets the current type, leaves all other fields `0`.
+  constexpr InteractionTypeCode(WeakCurrentType current)
+    : fCode{ CurrentTypeField::insert(0U, current.type()) } {}
+
+  /// Returns an object from its packed `code`.
+  static constexpr InteractionTypeCode fromCode(Code_t code)
+    { InteractionTypeCode obj; obj.fCode = code; return obj; }
+
+  // --- END -- Constructors ---------------------------------------------------
+
+
+  // --- BEGIN -- Access -------------------------------------------------------
+  /// @name Access
+  /// @{
+
+  /// Returns the packed code.
+  constexpr Code_t code() const { return fCode; }
+
+  /// Returns the value of the field `F`.
+  template <typename F>
+  constexpr Code_t get() const { return F::extract(fCode); }
+
+  /// Returns the weak current type.
+  constexpr WeakCurrentType currentType() const
+    {
+      return static_cast<WeakCurrentType::CurrentType>
+        (get<CurrentTypeField>());
+    }
+
+  /// Returns the name of the weak current type (no allocation).
+  constexpr std::string_view currentTypeName() const
+    { return currentType().nameView(); }
+
+  /// @}
+  // --- END -- Access ---------------------------------------------------------
+
+
+  // --- BEGIN -- Modification -------------------------------------------------
+  /// @name Modification
+  /// @{
+
+  /// Sets the field `F` to `value` (extra bits are discarded).
+  template <typename F>
+  constexpr InteractionTypeCode& set(Code_t value)
+    { fCode = F::insert(fCode, value); return *this; }
+
+  /// Sets the weak current type.
+  constexpr InteractionTypeCode& setCurrentType(WeakCurrentType current)
+    { return set<CurrentTypeField>(current.type()); }
+
+  /// @}
+  // --- END -- Modification ---------------------------------------------------
+
+
+  /// Returns whether all the fields of this and `other` codes are equal.
+  constexpr bool operator== (InteractionTypeCode const& other) const
+    { return fCode == other.fCode; }
+
+  /// Returns whether any field of this and `other` codes differs.
+  constexpr bool operator!= (InteractionTypeCode const& other) const
+    { return fCode != other.fCode; }
+
+
+    private:
+
+  Code_t fCode; ///< The packed code.
+
+}; // class icarus::InteractionTypeCode
+
+
+//------------------------------------------------------------------------------
+namespace icarus {
+
+  // --- BEGIN -- Columnar selection -------------------------------------------
+  /// @name Selection of arrays of packed codes
+  /// @{
+
+  /**
+   * @brief Marks the codes with field `F` equal to `value`.
+   * @tparam F the field to be tested (an `InteractionTypeCode::Field`)
+   * @param codes the packed codes to be tested
+   * @param value the value of the field to be matched
+   * @param mask _(output)_ the result for each code (`1` if matching)
+   * @return the number of matching codes
+   *
+   * The loop is written without branches so that the compiler can vectorize
+   * it. `mask` must have at least as many elements as `codes`.
+   */
+  template <typename F>
+  std::size_t maskFieldEqual(
+    gsl::span<InteractionTypeCode::Code_t const> codes,
+    InteractionTypeCode::Code_t value,
+    gsl::span<std::uint8_t> mask
+    );
+
+  /**
+   * @brief Marks the codes with the specified `current` type.
+   * @param codes the packed codes to be tested
+   * @param current the current type to be matched
+   * @param mask _(output)_ the result for each code (`1` if matching)
+   * @return the number of matching codes
+   *
+   * If `current` is `WeakCurrentType::any`, all codes are matched.
+   * `mask` must have at least as many elements as `codes`.
+   */
+  std::size_t maskCurrentType(
+    gsl::span<InteractionTypeCode::Code_t const> codes,
+    WeakCurrentType current,
+    gsl::span<std::uint8_t> mask
+    );
+
+  /// @}
+  // --- END -- Columnar selection ---------------------------------------------
+
+} // namespace icarus
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename F>
+std::size_t icarus::maskFieldEqual(
+  gsl::span<InteractionTypeCode::Code_t const> codes,
+  InteractionTypeCode::Code_t value,
+  gsl::span<std::uint8_t> mask
+) {
+  using Code_t = InteractionTypeCode::Code_t;
+
+  assert(mask.size() >= codes.size());
+
+  Code_t const shiftedValue = (value & F::maxValue) << F::offset;
+  std::size_t const n = codes.size();
+  std::size_t nMatches = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    std::uint8_t const match = ((codes[i] & F::mask) == shiftedValue);
+    mask[i] = match;
+    nMatches += match;
+  } // for
+  return nMatches;
+
+} // icarus::maskFieldEqual()
+
+
+//------------------------------------------------------------------------------
+inline std::size_t icarus::maskCurrentType(
+  gsl::span<InteractionTypeCode::Code_t const> codes,
+  WeakCurrentType current,
+  gsl::span<std::uint8_t> mask
+) {
+  if (current == AnyWeakCurrentType) {
+    assert(mask.size() >= codes.size());
+    std::fill(mask.begin(), mask.begin() + codes.size(), std::uint8_t{ 1 });
+    return codes.size();
+  }
+  return maskFieldEqual<InteractionTypeCode::CurrentTypeField>
+    (codes, current.type(), mask);
+} // icarus::maskCurrentType()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // ICARUSALG_UTILITIES_INTERACTIONTYPECODE_H
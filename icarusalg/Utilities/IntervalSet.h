@@ -0,0 +1,429 @@
+/**
+ * @file   icarusalg/Utilities/IntervalSet.h
+ * @brief  Set of disjoint time intervals with set algebra.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Utilities/TimeInterval.h`
+ *
+ * This library is header only.
+ */
+
+#ifndef ICARUSALG_UTILITIES_INTERVALSET_H
+#define ICARUSALG_UTILITIES_INTERVALSET_H
+
+
+// ICARUS libraries
+#include "icarusalg/Utilities/TimeInterval.h"
+
+// C++ core guideline library
+#include "gsl/span"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::upper_bound(), std::lower_bound()...
+#include <initializer_list>
+#include <iterator> // std::prev()
+#include <ostream>
+#include <utility> // std::move()
+#include <vector>
+#include <cassert>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::ns::util {
+  template <typename Time> class IntervalSet;
+
+  template <typename Time>
+  std::ostream& operator<< (std::ostream& out, IntervalSet<Time> const& set);
+
+  /// Returns the union of the two sets.
+  template <typename Time>
+  IntervalSet<Time> operator|
+    (IntervalSet<Time> const& a, IntervalSet<Time> const& b);
+
+  /// Returns the intersection of the two sets.
+  template <typename Time>
+  IntervalSet<Time> operator&
+    (IntervalSet<Time> const& a, IntervalSet<Time> const& b);
+
+} // namespace icarus::ns::util
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief A union of time intervals, stored as sorted disjoint intervals.
+ * @tparam Time type of time for the intervals
+ *
+ * The set is described by a list of `TimeInterval<Time>` objects, which is
+ * kept normalized: the intervals are not empty, are sorted by start time and
+ * are disjoint and not adjacent (two intervals like `[ 0 ; 5 ]` and
+ * `[ 5 ; 8 ]` are merged into `[ 0 ; 8 ]`, since intervals exclude their
+ * `stop` time).
+ *
+ * Thanks to the normalization:
+ * * union (`unite()`, `operator|`), intersection (`intersect()`,
+ *   `operator&`) and complement (`complement()`) take linear time in the
+ *   number of intervals;
+ * * membership test of a single time (`contains()`) is logarithmic;
+ * * membership test of a sorted list of times (`containsSorted()`) requires
+ *   a binary search per interval, and the results are written in contiguous
+ *   blocks.
+ *
+ * Example:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * using Interval_t = icarus::ns::util::TimeInterval<double>;
+ * icarus::ns::util::IntervalSet<double> const gates
+ *   { Interval_t{ -2.0, 2.0 }, Interval_t{ 1.0, 5.0 }, Interval_t{ 8.0, 9.0 } };
+ * icarus::ns::util::IntervalSet<double> const vetoes
+ *   { Interval_t{ 4.0, 8.5 } };
+ *
+ * auto const open = gates & vetoes.complement(Interval_t{ -10.0, 10.0 });
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * will result in `open` being the set of `[ -2 ; 4 ]` and `[ 8.5 ; 9 ]`.
+ *
+ * The requirements on `Time` are the same as for `TimeInterval`; in addition,
+ * `Time` objects must be copy-assignable and comparable with `operator<`.
+ */
+template <typename Time>
+class icarus::ns::util::IntervalSet {
+
+    public:
+
+  using Time_t = Time; ///< Type of time used.
+
+  using Interval_t = TimeInterval<Time_t>; ///< Type of interval in the set.
+
+  /// Type of the list of intervals.
+  using Intervals_t = std::vector<Interval_t>;
+
+  using const_iterator = typename Intervals_t::const_iterator;
+
+
+  // --- BEGIN -- Constructors -------------------------------------------------
+  /// @name Constructors
+  /// @{
+
+  /// Constructor: an empty set.
+  IntervalSet() = default;
+
+  /// Constructor: the union of the specified `intervals` (any order).
+  IntervalSet(Intervals_t intervals)
+    : fIntervals{ std::move(intervals) } { normalize(); }
+
+  /// Constructor: the union of the specified `intervals` (any order).
+  IntervalSet(std::initializer_list<Interval_t> intervals)
+    : IntervalSet{ Intervals_t(intervals) } {}
+
+  /// @}
+  // --- END ---- Constructors -------------------------------------------------
+
+
+  // --- BEGIN -- Query --------------------------------------------------------
+  /// @name Query
+  /// @{
+
+  /// Returns whether the set contains no time.
+  bool empty() const noexcept { return fIntervals.empty(); }
+
+  /// Returns the number of disjoint intervals in the set.
+  std::size_t size() const noexcept { return fIntervals.size(); }
+
+  /// Returns the sorted list of the disjoint intervals.
+  Intervals_t const& intervals() const noexcept { return fIntervals; }
+
+  /// Returns an iterator to the first interval.
+  const_iterator begin() const noexcept { return fIntervals.cbegin(); }
+
+  /// Returns an iterator past the last interval.
+  const_iterator end() const noexcept { return fIntervals.cend(); }
+
+  /// Returns the smallest interval including the whole set.
+  Interval_t span() const
+    {
+      return empty()
+        ? Interval_t{}
+        : Interval_t{ fIntervals.front().start, fIntervals.back().stop };
+    }
+
+  /// @}
+  // --- END ---- Query --------------------------------------------------------
+
+
+  // --- BEGIN -- Membership ---------------------------------------------------
+  /// @name Membership
+  /// @{
+
+  /// Returns whether time `t` is in the set (logarithmic complexity).
+  bool contains(Time_t t) const;
+
+  /**
+   * @brief Tests the membership of a sorted list of times.
+   * @param times the times to be tested, sorted in non-decreasing order
+   * @param result _(output)_ `1` for each of the `times` in the set, else `0`
+   * @return the number of `times` in the set
+   *
+   * The times must be sorted (according to `operator<`). `result` must have at
+   * least as many elements as `times`.
+   * For each interval, the range of contained times is found by binary search
+   * and the `result` is filled by blocks, making this more efficient than a
+   * `contains()` call for each time.
+   */
+  std::size_t containsSorted
+    (gsl::span<Time_t const> times, gsl::span<std::uint8_t> result) const;
+
+  /// @}
+  // --- END ---- Membership ---------------------------------------------------
+
+
+  // --- BEGIN -- Set algebra --------------------------------------------------
+  /// @name Set algebra
+  /// @{
+
+  /// Adds the specified `interval` to the set (linear complexity).
+  IntervalSet<Time_t>& add(Interval_t const& interval);
+
+  /// Returns the union of this set with `other` (linear complexity).
+  IntervalSet<Time_t> unite(IntervalSet<Time_t> const& other) const;
+
+  /// Returns the intersection of this set with `other` (linear complexity).
+  IntervalSet<Time_t> intersect(IntervalSet<Time_t> const& other) const;
+
+  /**
+   * @brief Returns the complement of this set within the interval `within`.
+   * @param within the universe for the complement
+   * @return the times in `within` which are not in this set
+   */
+  IntervalSet<Time_t> complement(Interval_t const& within) const;
+
+  /// Removes all intervals.
+  void clear() noexcept { fIntervals.clear(); }
+
+  /// @}
+  // --- END ---- Set algebra --------------------------------------------------
+
+
+    private:
+
+  Intervals_t fIntervals; ///< Sorted, disjoint, non-empty intervals.
+
+  /// Creates a set from intervals already normalized.
+  static IntervalSet<Time_t> fromNormalized(Intervals_t intervals)
+    {
+      IntervalSet<Time_t> set;
+      set.fIntervals = std::move(intervals);
+      return set;
+    }
+
+  /// Sorts the intervals and merges the overlapping ones.
+  void normalize();
+
+  /// Appends `interval` to the sorted `intervals`, merging it with the last.
+  static void appendMerging(Intervals_t& intervals, Interval_t const& interval);
+
+}; // icarus::ns::util::IntervalSet
+
+
+//------------------------------------------------------------------------------
+//---  Template implementation
+//------------------------------------------------------------------------------
+template <typename Time>
+bool icarus::ns::util::IntervalSet<Time>::contains(Time_t t) const {
+
+  // first interval starting after t; the candidate is the one before it
+  auto const itNext = std::upper_bound(
+    fIntervals.begin(), fIntervals.end(), t,
+    [](Time_t const& time, Interval_t const& interval)
+      { return time < interval.start; }
+    );
+  return (itNext != fIntervals.begin()) && (t < std::prev(itNext)->stop);
+
+} // icarus::ns::util::IntervalSet<>::contains()
+
+
+//------------------------------------------------------------------------------
+template <typename Time>
+std::size_t icarus::ns::util::IntervalSet<Time>::containsSorted
+  (gsl::span<Time_t const> times, gsl::span<std::uint8_t> result) const
+{
+  assert(result.size() >= times.size());
+
+  auto const tBegin = times.begin();
+  auto const tEnd = times.end();
+  auto const rBegin = result.begin();
+
+  std::size_t nContained = 0;
+  auto itTime = tBegin;
+  for (Interval_t const& interval: fIntervals) {
+    if (itTime == tEnd) break;
+
+    auto const itStart = std::lower_bound(itTime, tEnd, interval.start);
+    auto const itStop = std::lower_bound(itStart, tEnd, interval.stop);
+
+    std::fill(rBegin + (itTime - tBegin), rBegin + (itStart - tBegin), 0);
+    std::fill(rBegin + (itStart - tBegin), rBegin + (itStop - tBegin), 1);
+    nContained += itStop - itStart;
+    itTime = itStop;
+  } // for intervals
+  std::fill(rBegin + (itTime - tBegin), rBegin + times.size(), 0);
+
+  return nContained;
+} // icarus::ns::util::IntervalSet<>::containsSorted()
+
+
+//------------------------------------------------------------------------------
+template <typename Time>
+auto icarus::ns::util::IntervalSet<Time>::add(Interval_t const& interval)
+  -> IntervalSet<Time_t>&
+{
+  if (interval.empty()) return *this;
+
+  // intervals entirely before the new one stay; the ones touching it merge
+  auto const itFirst = std::lower_bound(
+    fIntervals.begin(), fIntervals.end(), interval.start,
+    [](Interval_t const& i, Time_t const& time){ return i.stop < time; }
+    );
+  auto const itLast = std::upper_bound(
+    itFirst, fIntervals.end(), interval.stop,
+    [](Time_t const& time, Interval_t const& i){ return time < i.start; }
+    );
+
+  Interval_t merged = interval;
+  if (itFirst != itLast) {
+    if (itFirst->start < merged.start) merged.start = itFirst->start;
+    if (merged.stop < std::prev(itLast)->stop)
+      merged.stop = std::prev(itLast)->stop;
+  }
+  auto const itInsert = fIntervals.erase(itFirst, itLast);
+  fIntervals.insert(itInsert, merged);
+
+  return *this;
+} // icarus::ns::util::IntervalSet<>::add()
+
+
+//------------------------------------------------------------------------------
+template <typename Time>
+auto icarus::ns::util::IntervalSet<Time>::unite
+  (IntervalSet<Time_t> const& other) const -> IntervalSet<Time_t>
+{
+  Intervals_t merged;
+  merged.reserve(fIntervals.size() + other.fIntervals.size());
+
+  auto itA = fIntervals.begin(), itB = other.fIntervals.begin();
+  auto const endA = fIntervals.end(), endB = other.fIntervals.end();
+  while ((itA != endA) && (itB != endB)) {
+    if (itB->start < itA->start) appendMerging(merged, *itB++);
+    else                         appendMerging(merged, *itA++);
+  } // while
+  for (; itA != endA; ++itA) appendMerging(merged, *itA);
+  for (; itB != endB; ++itB) appendMerging(merged, *itB);
+
+  return fromNormalized(std::move(merged));
+} // icarus::ns::util::IntervalSet<>::unite()
+
+
+//------------------------------------------------------------------------------
+template <typename Time>
+auto icarus::ns::util::IntervalSet<Time>::intersect
+  (IntervalSet<Time_t> const& other) const -> IntervalSet<Time_t>
+{
+  Intervals_t common;
+
+  auto itA = fIntervals.begin(), itB = other.fIntervals.begin();
+  auto const endA = fIntervals.end(), endB = other.fIntervals.end();
+  while ((itA != endA) && (itB != endB)) {
+    Interval_t overlap = *itA;
+    overlap.intersect(*itB);
+    if (!overlap.empty()) common.push_back(overlap);
+    // the interval ending first can't overlap any more interval of the other
+    if (itA->stop < itB->stop) ++itA;
+    else                       ++itB;
+  } // while
+
+  return fromNormalized(std::move(common));
+} // icarus::ns::util::IntervalSet<>::intersect()
+
+
+//------------------------------------------------------------------------------
+template <typename Time>
+auto icarus::ns::util::IntervalSet<Time>::complement
+  (Interval_t const& within) const -> IntervalSet<Time_t>
+{
+  Intervals_t gaps;
+  if (within.empty()) return fromNormalized(std::move(gaps));
+
+  gaps.reserve(fIntervals.size() + 1);
+  Time_t start = within.start;
+  for (Interval_t const& interval: fIntervals) {
+    if (!(start < interval.stop)) continue; // interval before the start
+    if (!(interval.start < within.stop)) break; // interval after the end
+    if (start < interval.start) gaps.emplace_back(start, interval.start);
+    start = interval.stop;
+  } // for
+  if (start < within.stop) gaps.emplace_back(start, within.stop);
+
+  return fromNormalized(std::move(gaps));
+} // icarus::ns::util::IntervalSet<>::complement()
+
+
+//------------------------------------------------------------------------------
+template <typename Time>
+void icarus::ns::util::IntervalSet<Time>::normalize() {
+
+  Intervals_t intervals = std::move(fIntervals);
+  std::sort(intervals.begin(), intervals.end(),
+    [](Interval_t const& a, Interval_t const& b){ return a.start < b.start; });
+
+  fIntervals.clear();
+  fIntervals.reserve(intervals.size());
+  for (Interval_t const& interval: intervals) {
+    if (interval.empty()) continue;
+    appendMerging(fIntervals, interval);
+  } // for
+
+} // icarus::ns::util::IntervalSet<>::normalize()
+
+
+//------------------------------------------------------------------------------
+template <typename Time>
+void icarus::ns::util::IntervalSet<Time>::appendMerging
+  (Intervals_t& intervals, Interval_t const& interval)
+{
+  if (intervals.empty() || (intervals.back().stop < interval.start))
+    intervals.push_back(interval);
+  else if (intervals.back().stop < interval.stop)
+    intervals.back().stop = interval.stop;
+} // icarus::ns::util::IntervalSet<>::appendMerging()
+
+
+//------------------------------------------------------------------------------
+template <typename Time>
+std::ostream& icarus::ns::util::operator<<
+  (std::ostream& out, IntervalSet<Time> const& set)
+{
+  if (set.empty()) out << "{ empty }";
+  else {
+    out << "{";
+    for (auto const& interval: set) out << " " << interval;
+    out << " }";
+  }
+  return out;
+}
+
+
+//------------------------------------------------------------------------------
+template <typename Time>
+auto icarus::ns::util::operator|
+  (IntervalSet<Time> const& a, IntervalSet<Time> const& b) -> IntervalSet<Time>
+  { return a.unite(b); }
+
+
+template <typename Time>
+auto icarus::ns::util::operator&
+  (IntervalSet<Time> const& a, IntervalSet<Time> const& b) -> IntervalSet<Time>
+  { return a.intersect(b); }
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // ICARUSALG_UTILITIES_INTERVALSET_H
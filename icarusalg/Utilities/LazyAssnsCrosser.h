@@ -0,0 +1,434 @@
+/**
+ * @file icarusalg/Utilities/LazyAssnsCrosser.h
+ * @brief Multi-hop associations expanded only for the keys actually queried.
+ * @date October 18, 2026
+ * @see icarusalg/Utilities/AssnsCrosser.h
+ */
+
+#ifndef ICARUSALG_UTILITIES_LAZYASSNSCROSSER_H
+#define ICARUSALG_UTILITIES_LAZYASSNSCROSSER_H
+
+// ICARUS libraries
+#include "icarusalg/Utilities/AssnsCrosser.h"
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/DebugUtils.h" // lar::debug::demangle()
+
+// framework libraries
+#include "canvas/Persistency/Common/Ptr.h"
+#include "canvas/Persistency/Provenance/ProductID.h"
+#include "canvas/Utilities/Exception.h"
+
+// C/C++ standard libraries
+#include <memory> // std::unique_ptr
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept> // std::logic_error
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility> // std::index_sequence, std::move()
+#include <vector>
+#include <cstddef>
+
+
+namespace icarus::ns::util {
+  template <typename KeyType, typename... OtherTypes> class LazyAssnsCrosser;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Multi-hop associations, expanded on demand for each queried key.
+ * @tparam KeyType the type of the data to associate to
+ * @tparam OtherTypes intermediate types to reach the target type (the last one)
+ *
+ * This object offers the same query interface as `AssnsCrosser` (`assPtrs()`,
+ * `assPtr()` and `pathCounts()`), but while `AssnsCrosser` joins the
+ * associations for all the keys at construction, this one only reads the
+ * association data products at construction, and the targets of each key are
+ * collected, hop by hop, the first time that key is queried. The result is then
+ * kept for further queries.
+ * This is convenient when only a few keys are queried in each event (e.g. only
+ * the neutrino candidate among all the particle flow objects).
+ *
+ * The input specifications follow the same rules as `AssnsCrosser`, with the
+ * same autodetection of the unspecified hops. Start specifications are not
+ * supported, since only the keys being queried are expanded anyway.
+ * Of the `AssnsCrosserOptions`, the treatment of duplicates is honoured in the
+ * same way as `AssnsCrosser`, while the number of threads is ignored.
+ *
+ * Example:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * icarus::ns::util::LazyAssnsCrosser
+ *   <recob::PFParticle, recob::Cluster, recob::Hit> const PFOtoHits
+ *   { event, art::InputTag{ "pandora" }, art::InputTag{ "pandora" } };
+ *
+ * std::vector<art::Ptr<recob::Hit>> const& hits
+ *   = PFOtoHits.assPtrs(neutrinoPtr);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ *
+ * Thread safety
+ * --------------
+ *
+ * All the query methods can be called concurrently from different threads.
+ * The expansion of a key happens outside of any lock; if two threads query the
+ * same new key at the same time, both expand it and only one result is kept.
+ * References returned by the queries stay valid as long as this object does.
+ */
+template <typename KeyType, typename... OtherTypes>
+class icarus::ns::util::LazyAssnsCrosser
+  : public details::AssnsCrosserTypes<KeyType, OtherTypes...>
+{
+
+  using This_t = LazyAssnsCrosser<KeyType, OtherTypes...>;
+
+    public:
+
+  using KeyPtr_t = typename This_t::KeyPtr_t;
+  using TargetPtr_t = typename This_t::TargetPtr_t;
+  using TargetPtrs_t = typename This_t::TargetPtrs_t;
+  using PathCounts_t = typename This_t::PathCounts_t;
+
+  /// Type of options for the traversal.
+  using Options_t = AssnsCrosserOptions;
+
+  /**
+   * @brief Constructor: reads the specified associations.
+   * @tparam Event type to read the data from (`art::Event` interface)
+   * @param event data source
+   * @param otherInputSpecs input specifications for all the hops
+   * @throw std::logic_error if neither the first nor the last hop is specified
+   */
+  template <typename Event>
+  LazyAssnsCrosser
+    (Event const& event, InputSpecs<OtherTypes>... otherInputSpecs);
+
+  /**
+   * @brief Constructor: reads the specified associations.
+   * @tparam Event type to read the data from (`art::Event` interface)
+   * @param event data source
+   * @param options options for the traversal of the associations
+   * @param otherInputSpecs input specifications for all the hops
+   * @throw std::logic_error if neither the first nor the last hop is specified
+   */
+  template <typename Event>
+  LazyAssnsCrosser(
+    Event const& event,
+    Options_t const& options,
+    InputSpecs<OtherTypes>... otherInputSpecs
+    );
+
+  /// Returns the options used for the traversal.
+  Options_t const& options() const noexcept { return fOptions; }
+
+  /// Returns pointers to all target objects associated to `keyPtr`.
+  /// @see `AssnsCrosser::assPtrs()`
+  TargetPtrs_t const& assPtrs(KeyPtr_t const& keyPtr) const
+    { return expansion(keyPtr).targets; }
+
+  /// Returns a pointer to the target object associated to `keyPtr`.
+  /// @see `AssnsCrosser::assPtr()`
+  TargetPtr_t const& assPtr(KeyPtr_t const& keyPtr) const;
+
+  /// Returns the number of paths to each target associated to `keyPtr`.
+  /// @see `AssnsCrosser::pathCounts()`
+  PathCounts_t const& pathCounts(KeyPtr_t const& keyPtr) const
+    { return expansion(keyPtr).counts; }
+
+  /// Returns the number of keys expanded so far.
+  std::size_t nExpandedKeys() const;
+
+
+    private:
+
+  using Key_t = typename This_t::Key_t;
+  using Target_t = typename This_t::Target_t;
+
+  using MapJoiner_t = details::MapJoiner<KeyType, OtherTypes...>;
+
+  static constexpr std::size_t NHops = sizeof...(OtherTypes);
+
+  /// Type at the left of the association of hop `Hop` (`0` is the key).
+  template <std::size_t Hop>
+  using HopType_t
+    = std::tuple_element_t<Hop, std::tuple<KeyType, OtherTypes...>>;
+
+  template <std::size_t... Hops>
+  static auto hopMapsType(std::index_sequence<Hops...>)
+    -> std::tuple<details::AssnsMap<HopType_t<Hops>, HopType_t<Hops + 1>>...>;
+
+  /// All the association maps, one per hop.
+  using HopMaps_t = decltype(hopMapsType(std::make_index_sequence<NHops>()));
+
+  /// Input specifications of all the hops.
+  using HopSpecs_t = std::tuple<InputSpecs<OtherTypes>...>;
+
+  /// Working area for the expansion of a key: markers for the hop targets.
+  using Workspace_t = std::tuple<details::PtrEpochMarker<OtherTypes>...>;
+
+  /// Result of the expansion of a key.
+  struct Expansion_t {
+    TargetPtrs_t targets; ///< All the targets of the key.
+    PathCounts_t counts; ///< Path count of each target (if requested).
+  }; // Expansion_t
+
+  /// All the state changed by the queries.
+  struct Cache_t {
+    mutable std::shared_mutex mutex; ///< Protects `expansions`.
+    std::unordered_map<KeyPtr_t, Expansion_t> expansions; ///< Expanded keys.
+
+    std::mutex workspaceMutex; ///< Protects `workspaces`.
+    std::vector<std::unique_ptr<Workspace_t>> workspaces; ///< Unused areas.
+  }; // Cache_t
+
+
+  Options_t fOptions; ///< Options for the traversal.
+
+  HopMaps_t fHopMaps; ///< Association map of each hop.
+
+  /// Expanded keys and working areas (a pointer, to keep this object movable).
+  std::unique_ptr<Cache_t> fCache = std::make_unique<Cache_t>();
+
+
+  static TargetPtr_t const NullTargetPtr; ///< Used as return reference value.
+
+
+  /// Returns the expansion of `keyPtr`, expanding the key if needed.
+  Expansion_t const& expansion(KeyPtr_t const& keyPtr) const;
+
+  /// Collects all the targets of `keyPtr` hopping through all the maps.
+  Expansion_t expand(KeyPtr_t const& keyPtr) const;
+
+  /// Expands `ptrs` through the hop `Hop` and all the following ones.
+  template <std::size_t Hop, typename T>
+  void expandHop(
+    std::vector<art::Ptr<T>> const& ptrs, PathCounts_t const& counts,
+    Workspace_t& workspace, Expansion_t& result
+    ) const;
+
+  /// Reads the associations of hop `Hop` and the following ones.
+  template <std::size_t Hop, typename Event>
+  void readForward(Event const& event, HopSpecs_t& specs);
+
+  /// Reads the associations of hop `Hop` and the preceding ones.
+  template <std::size_t Hop, typename Event>
+  void readBackward(Event const& event, HopSpecs_t& specs);
+
+  /// Returns a working area (new or recycled) for the expansion of a key.
+  std::unique_ptr<Workspace_t> acquireWorkspace() const;
+
+  /// Makes the `workspace` available for other expansions.
+  void releaseWorkspace(std::unique_ptr<Workspace_t> workspace) const;
+
+}; // icarus::ns::util::LazyAssnsCrosser
+
+
+// -----------------------------------------------------------------------------
+// ---  template implementation
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+typename icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>::TargetPtr_t
+const icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>::NullTargetPtr;
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+template <typename Event>
+icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>::LazyAssnsCrosser(
+  Event const& event,
+  InputSpecs<OtherTypes>... otherInputSpecs
+)
+  : LazyAssnsCrosser{ event, Options_t{}, std::move(otherInputSpecs)... }
+{}
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+template <typename Event>
+icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>::LazyAssnsCrosser(
+  Event const& event,
+  Options_t const& options,
+  InputSpecs<OtherTypes>... otherInputSpecs
+)
+  : fOptions{ options }
+{
+  /*
+   * The hops are read starting from a specified end, so that the unspecified
+   * ones can be discovered with the same assumptions as in `AssnsCrosser`
+   * forward (if the first hop is specified) and backward traversals.
+   */
+  HopSpecs_t specs{ std::move(otherInputSpecs)... };
+  if (std::get<0>(specs).hasSpecs())
+    readForward<0U>(event, specs);
+  else if (std::get<NHops - 1>(specs).hasSpecs())
+    readBackward<NHops - 1>(event, specs);
+  else {
+    throw std::logic_error{
+      "Insufficient specifications for traversal of " + std::to_string(NHops)
+      + " associations."
+      };
+  }
+} // icarus::ns::util::LazyAssnsCrosser<>::LazyAssnsCrosser()
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+auto icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>::assPtr
+  (KeyPtr_t const& keyPtr) const -> TargetPtr_t const&
+{
+  TargetPtrs_t const& targets = assPtrs(keyPtr);
+  if (targets.size() > 1) {
+    // using LogicError because that's what art::FindOne does
+    throw art::Exception{ art::errors::LogicError }
+      << "LazyAssnsCrosser::assPtr(): there are " << targets.size() << " "
+      << lar::debug::demangle<Target_t>() << " objects associated to Ptr<"
+      << lar::debug::demangle<Key_t>() << ">=" << keyPtr << "!\n";
+  }
+  return targets.empty()? NullTargetPtr: targets.front();
+} // icarus::ns::util::LazyAssnsCrosser<>::assPtr()
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+std::size_t icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>
+  ::nExpandedKeys() const
+{
+  std::shared_lock const lock{ fCache->mutex };
+  return fCache->expansions.size();
+} // icarus::ns::util::LazyAssnsCrosser<>::nExpandedKeys()
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+auto icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>::expansion
+  (KeyPtr_t const& keyPtr) const -> Expansion_t const&
+{
+  {
+    std::shared_lock const lock{ fCache->mutex };
+    auto const it = fCache->expansions.find(keyPtr);
+    if (it != fCache->expansions.end()) return it->second;
+  }
+
+  Expansion_t expanded = expand(keyPtr); // no lock held
+
+  // if another thread got here first, its result is kept (it's the same);
+  // references to map elements survive rehashing
+  std::unique_lock const lock{ fCache->mutex };
+  return fCache->expansions.try_emplace(keyPtr, std::move(expanded))
+    .first->second;
+} // icarus::ns::util::LazyAssnsCrosser<>::expansion()
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+auto icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>::expand
+  (KeyPtr_t const& keyPtr) const -> Expansion_t
+{
+  Expansion_t result;
+  std::unique_ptr<Workspace_t> workspace = acquireWorkspace();
+  expandHop<0U>(std::vector<KeyPtr_t>{ keyPtr }, {}, *workspace, result);
+  releaseWorkspace(std::move(workspace));
+  return result;
+} // icarus::ns::util::LazyAssnsCrosser<>::expand()
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+template <std::size_t Hop, typename T>
+void icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>::expandHop(
+  std::vector<art::Ptr<T>> const& ptrs, PathCounts_t const& counts,
+  Workspace_t& workspace, Expansion_t& result
+) const {
+
+  std::vector<art::Ptr<HopType_t<Hop + 1>>> nextPtrs;
+  PathCounts_t nextCounts;
+  MapJoiner_t::expandKey(
+    ptrs, counts, std::get<Hop>(fHopMaps), fOptions,
+    std::get<Hop>(workspace), nextPtrs, nextCounts
+    );
+
+  if constexpr(Hop + 1 == NHops) {
+    result.targets = std::move(nextPtrs);
+    result.counts = std::move(nextCounts);
+  }
+  else expandHop<Hop + 1>(nextPtrs, nextCounts, workspace, result);
+
+} // icarus::ns::util::LazyAssnsCrosser<>::expandHop()
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+template <std::size_t Hop, typename Event>
+void icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>::readForward
+  (Event const& event, HopSpecs_t& specs)
+{
+  // see `details::MapJoiner::rightExtendMapWithAssns()`
+  auto& hopSpecs = std::get<Hop>(specs);
+  bool const bAutodetect = hopSpecs.hasEmptySpecs();
+  std::vector<art::InputTag> const tags
+    = MapJoiner_t::extractTagList(std::move(hopSpecs), event);
+  std::vector<art::ProductID> neededIDs;
+  if constexpr(Hop > 0) {
+    if (bAutodetect) neededIDs = std::get<Hop - 1>(fHopMaps).targetProductIDs();
+  }
+  std::get<Hop>(fHopMaps) = MapJoiner_t::template mapExtensionPreparation
+    <HopType_t<Hop>, HopType_t<Hop + 1>, 0U>(event, tags, neededIDs);
+
+  if constexpr(Hop + 1 < NHops) readForward<Hop + 1>(event, specs);
+} // icarus::ns::util::LazyAssnsCrosser<>::readForward()
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+template <std::size_t Hop, typename Event>
+void icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>::readBackward
+  (Event const& event, HopSpecs_t& specs)
+{
+  // see `details::MapJoiner::leftExtendMapWithAssns()`
+  auto& hopSpecs = std::get<Hop>(specs);
+  bool const bAutodetect = hopSpecs.hasEmptySpecs();
+  std::vector<art::InputTag> const tags
+    = MapJoiner_t::extractTagList(std::move(hopSpecs), event);
+  std::vector<art::ProductID> neededIDs;
+  if constexpr(Hop + 1 < NHops) {
+    if (bAutodetect) neededIDs = std::get<Hop + 1>(fHopMaps).keyProductIDs();
+  }
+  std::get<Hop>(fHopMaps) = MapJoiner_t::template mapExtensionPreparation
+    <HopType_t<Hop>, HopType_t<Hop + 1>, 1U>(event, tags, neededIDs);
+
+  if constexpr(Hop > 0) readBackward<Hop - 1>(event, specs);
+} // icarus::ns::util::LazyAssnsCrosser<>::readBackward()
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+auto icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>
+  ::acquireWorkspace() const -> std::unique_ptr<Workspace_t>
+{
+  {
+    std::lock_guard const lock{ fCache->workspaceMutex };
+    if (!fCache->workspaces.empty()) {
+      std::unique_ptr<Workspace_t> workspace
+        = std::move(fCache->workspaces.back());
+      fCache->workspaces.pop_back();
+      return workspace;
+    }
+  }
+  return std::make_unique<Workspace_t>();
+} // icarus::ns::util::LazyAssnsCrosser<>::acquireWorkspace()
+
+
+// -----------------------------------------------------------------------------
+template <typename KeyType, typename... OtherTypes>
+void icarus::ns::util::LazyAssnsCrosser<KeyType, OtherTypes...>
+  ::releaseWorkspace(std::unique_ptr<Workspace_t> workspace) const
+{
+  std::lock_guard const lock{ fCache->workspaceMutex };
+  fCache->workspaces.push_back(std::move(workspace));
+} // icarus::ns::util::LazyAssnsCrosser<>::releaseWorkspace()
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSALG_UTILITIES_LAZYASSNSCROSSER_H
@@ -0,0 +1,382 @@
+/**
+ * @file   icarusalg/Utilities/ROOTasyncWriter.h
+ * @brief  Writes ROOT objects into a file from a background thread.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Utilities/ROOTutils.h`
+ *
+ * This library is header-only.
+ */
+
+#ifndef ICARUSALG_UTILITIES_ROOTASYNCWRITER_H
+#define ICARUSALG_UTILITIES_ROOTASYNCWRITER_H
+
+// ICARUS libraries
+#include "icarusalg/Utilities/ROOTutils.h" // util::ROOT::TDirectoryChanger
+
+// ROOT libraries
+#include "TFile.h"
+#include "TDirectory.h"
+#include "TObject.h"
+#include "TROOT.h" // ROOT::EnableThreadSafety()
+
+// C/C++ standard libraries
+#include <condition_variable>
+#include <deque>
+#include <exception> // std::exception_ptr
+#include <memory> // std::unique_ptr<>
+#include <mutex>
+#include <optional>
+#include <stdexcept> // std::logic_error, std::runtime_error
+#include <string>
+#include <thread>
+#include <utility> // std::move()
+#include <cstddef> // std::size_t
+
+
+namespace util::ROOT {
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Writes ROOT objects into a file in a background thread.
+   *
+   * Objects are handed over to this writer with `write()` together with the
+   * path of the destination directory within the file; the writer takes their
+   * ownership, and a background thread writes them and then deletes them.
+   * Directories are created on demand, and they can be written and released
+   * from memory with `closeDirectory()`.
+   * The requests are queued and executed in order; the queue has a maximum
+   * size, beyond which `write()` waits for the background thread to catch up,
+   * so that memory usage stays bounded.
+   *
+   * While the writer is active, the output file belongs to its thread: the
+   * caller must not access the file or its directories until `finish()` is
+   * called. The current ROOT directory (`gDirectory`) of the calling thread is
+   * never changed by the writer (the background thread changes its own
+   * current directory, always via `TDirectoryChanger`).
+   * Since ROOT is used from more than one thread, its thread safety is enabled
+   * on construction (`ROOT::EnableThreadSafety()`). Because the objects are
+   * usually created in the calling thread and deleted in the writer thread,
+   * the caller should rather enable it itself before creating any ROOT object,
+   * and objects with a graphics representation (like canvases) should be
+   * created in batch mode (`gROOT->SetBatch()`). The calling thread must also
+   * not keep references to the objects it hands over, including the current
+   * pad (`gPad`), which is specific to each thread.
+   *
+   * Exceptions thrown while writing (including failures to create a
+   * directory or to write an object, reported as `std::runtime_error`) are
+   * rethrown to the caller by the next `write()`, `closeDirectory()`,
+   * `flush()` or `finish()` call.
+   *
+   * @note The content of a `icarus::ns::util::PlotSandbox` is not supported:
+   *       the sandbox objects are owned by its directory backend (which is
+   *       `art::TFileDirectory` in _art_ jobs) and they are written by it at
+   *       the end of the job, while this writer needs to be handed the
+   *       ownership of the objects and exclusive access to the file.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * TFile outputFile { "plots.root", "RECREATE" };
+   * util::ROOT::AsyncObjectWriter writer { outputFile, { 32U, 4 } };
+   *
+   * for (auto&& canvas: makeCanvases())
+   *   writer.write(std::move(canvas), "event1/cluster1");
+   * writer.closeDirectory("event1");
+   *
+   * writer.finish(); // now outputFile is ours again
+   * outputFile.Write();
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class AsyncObjectWriter {
+
+      public:
+
+    /// Writer configuration.
+    struct Config_t {
+
+      /// Maximum number of requests waiting to be executed.
+      std::size_t maxQueueSize = 16U;
+
+      /// Compression level to set to the file (if any; ROOT convention).
+      std::optional<int> compressionLevel;
+
+    }; // Config_t
+
+
+    /// Constructor: starts a writer into `file` with the specified `config`.
+    AsyncObjectWriter(TFile& file, Config_t config);
+
+    /// Constructor: starts a writer into `file` with default configuration.
+    AsyncObjectWriter(TFile& file): AsyncObjectWriter{ file, Config_t{} } {}
+
+    // the writer thread refers to this object: no copy nor move
+    AsyncObjectWriter(AsyncObjectWriter const&) = delete;
+    AsyncObjectWriter& operator= (AsyncObjectWriter const&) = delete;
+
+    /// Destructor: writes all pending objects and stops the writer thread.
+    ~AsyncObjectWriter();
+
+
+    /**
+     * @brief Queues `object` to be written in the directory `dirPath`.
+     * @param object the object to be written (ownership taken)
+     * @param dirPath path of the destination directory, relative to the file
+     * @param dirTitle title of the destination directory, if created now
+     *
+     * The directory path uses `/` as separator. Missing directories are
+     * created; if the last one of the path is created, it is given the title
+     * `dirTitle`.
+     * If the queue is full, this call waits until there is room in it.
+     */
+    void write(
+      std::unique_ptr<TObject> object,
+      std::string dirPath = "", std::string dirTitle = ""
+      );
+
+    /// Queues the creation of directory `dirPath` with the specified title.
+    void makeDirectory(std::string dirPath, std::string dirTitle = "")
+      { enqueue({ nullptr, std::move(dirPath), std::move(dirTitle), false }); }
+
+    /// Queues the writing of directory `dirPath` and its removal from memory.
+    void closeDirectory(std::string dirPath)
+      { enqueue({ nullptr, std::move(dirPath), "", true }); }
+
+    /// Waits until all the queued requests have been executed.
+    void flush();
+
+    /**
+     * @brief Executes all the queued requests and stops the writer thread.
+     *
+     * After this call, the output file can be used again by the caller.
+     * No further request is accepted.
+     */
+    void finish();
+
+    /// Returns the number of objects written so far.
+    std::size_t nWritten() const
+      { std::lock_guard lock{ fMutex }; return fNWritten; }
+
+
+      private:
+
+    /// A request to the writer thread.
+    struct Request_t {
+      std::unique_ptr<TObject> object; ///< Object to write (may be null).
+      std::string dirPath; ///< Destination directory.
+      std::string dirTitle; ///< Title of the destination directory.
+      bool closeDir = false; ///< Whether to write and release the directory.
+    }; // Request_t
+
+    TFile* fFile; ///< Destination file.
+    Config_t const fConfig; ///< Writer configuration.
+
+    mutable std::mutex fMutex; ///< Protects all the data below.
+    std::condition_variable fQueueChanged; ///< Notifies about queue changes.
+    std::deque<Request_t> fQueue; ///< Requests waiting for execution.
+    bool fBusy = false; ///< Whether the writer thread is executing a request.
+    bool fStop = false; ///< Whether the writer thread is asked to stop.
+    std::exception_ptr fError; ///< Exception from the writer thread.
+    std::size_t fNWritten = 0U; ///< Number of written objects.
+
+    std::thread fWriterThread; ///< The writer thread.
+
+
+    /// Adds a request to the queue, waiting if the queue is full.
+    void enqueue(Request_t request);
+
+    /// Rethrows a pending writer thread exception (`fMutex` must be locked).
+    void rethrowError();
+
+    /// Main loop of the writer thread.
+    void writerLoop();
+
+    /// Executes a single request (in the writer thread).
+    void execute(Request_t& request);
+
+    /// Returns the directory at `path`, creating it if needed.
+    TDirectory* getDirectory(std::string const& path, std::string const& title);
+
+  }; // class AsyncObjectWriter
+
+
+} // namespace util::ROOT
+
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline util::ROOT::AsyncObjectWriter::AsyncObjectWriter
+  (TFile& file, Config_t config)
+  : fFile{ &file }, fConfig{ std::move(config) }
+{
+  ::ROOT::EnableThreadSafety();
+  if (fConfig.compressionLevel)
+    fFile->SetCompressionLevel(*fConfig.compressionLevel);
+  fWriterThread = std::thread{ &AsyncObjectWriter::writerLoop, this };
+} // util::ROOT::AsyncObjectWriter::AsyncObjectWriter()
+
+
+//------------------------------------------------------------------------------
+inline util::ROOT::AsyncObjectWriter::~AsyncObjectWriter() {
+  try { finish(); }
+  catch (...) {} // nowhere to report to
+} // util::ROOT::AsyncObjectWriter::~AsyncObjectWriter()
+
+
+//------------------------------------------------------------------------------
+inline void util::ROOT::AsyncObjectWriter::write(
+  std::unique_ptr<TObject> object, std::string dirPath, std::string dirTitle
+) {
+  if (!object) return;
+  enqueue({ std::move(object), std::move(dirPath), std::move(dirTitle), false });
+} // util::ROOT::AsyncObjectWriter::write()
+
+
+//------------------------------------------------------------------------------
+inline void util::ROOT::AsyncObjectWriter::flush() {
+  std::unique_lock lock{ fMutex };
+  fQueueChanged.wait(lock, [this](){ return (fQueue.empty() && !fBusy); });
+  rethrowError();
+} // util::ROOT::AsyncObjectWriter::flush()
+
+
+//------------------------------------------------------------------------------
+inline void util::ROOT::AsyncObjectWriter::finish() {
+
+  if (!fWriterThread.joinable()) return;
+
+  {
+    std::lock_guard lock{ fMutex };
+    fStop = true;
+  }
+  fQueueChanged.notify_all();
+  fWriterThread.join();
+
+  std::lock_guard lock{ fMutex };
+  rethrowError();
+
+} // util::ROOT::AsyncObjectWriter::finish()
+
+
+//------------------------------------------------------------------------------
+inline void util::ROOT::AsyncObjectWriter::enqueue(Request_t request) {
+
+  {
+    std::unique_lock lock{ fMutex };
+    fQueueChanged.wait(lock,
+      [this](){ return (fQueue.size() < fConfig.maxQueueSize) || fStop; }
+      );
+    rethrowError();
+    if (fStop) {
+      throw std::logic_error
+        { "util::ROOT::AsyncObjectWriter: request after finish()" };
+    }
+    fQueue.push_back(std::move(request));
+  }
+  fQueueChanged.notify_all();
+
+} // util::ROOT::AsyncObjectWriter::enqueue()
+
+
+//------------------------------------------------------------------------------
+inline void util::ROOT::AsyncObjectWriter::rethrowError() {
+  if (!fError) return;
+  std::exception_ptr error;
+  std::swap(error, fError);
+  std::rethrow_exception(error);
+} // util::ROOT::AsyncObjectWriter::rethrowError()
+
+
+//------------------------------------------------------------------------------
+inline void util::ROOT::AsyncObjectWriter::writerLoop() {
+
+  while (true) {
+    Request_t request;
+    {
+      std::unique_lock lock{ fMutex };
+      fQueueChanged.wait(lock, [this](){ return !fQueue.empty() || fStop; });
+      if (fQueue.empty()) break; // stop requested and nothing left to do
+      request = std::move(fQueue.front());
+      fQueue.pop_front();
+      fBusy = true;
+    }
+    fQueueChanged.notify_all(); // there is room in the queue now
+
+    bool const hasObject = bool(request.object);
+    std::exception_ptr error;
+    try { execute(request); }
+    catch (...) { error = std::current_exception(); }
+    request.object.reset(); // delete the object outside the lock
+
+    {
+      std::lock_guard lock{ fMutex };
+      fBusy = false;
+      if (error) { if (!fError) fError = error; }
+      else if (hasObject) ++fNWritten;
+    }
+    fQueueChanged.notify_all();
+
+  } // while
+
+} // util::ROOT::AsyncObjectWriter::writerLoop()
+
+
+//------------------------------------------------------------------------------
+inline void util::ROOT::AsyncObjectWriter::execute(Request_t& request) {
+
+  if (request.closeDir) {
+    TDirectory* dir = fFile->GetDirectory(request.dirPath.c_str());
+    if (!dir || (dir == fFile)) return;
+    dir->Write();
+    delete dir;
+    return;
+  }
+
+  TDirectory* dir = getDirectory(request.dirPath, request.dirTitle);
+  if (!request.object) return; // just the directory was requested
+
+  TDirectoryChanger dirGuard { dir };
+  if (request.object->Write() == 0) {
+    throw std::runtime_error{
+      "util::ROOT::AsyncObjectWriter: failed to write '"
+      + std::string{ request.object->GetName() } + "' into '"
+      + request.dirPath + "'"
+      };
+  }
+
+} // util::ROOT::AsyncObjectWriter::execute()
+
+
+//------------------------------------------------------------------------------
+inline TDirectory* util::ROOT::AsyncObjectWriter::getDirectory
+  (std::string const& path, std::string const& title)
+{
+  TDirectory* dir = fFile;
+  std::size_t start = 0;
+  while (start < path.length()) {
+    std::size_t stop = path.find('/', start);
+    if (stop == std::string::npos) stop = path.length();
+    if (stop > start) {
+      std::string const name = path.substr(start, stop - start);
+      TDirectory* subdir = dir->GetDirectory(name.c_str());
+      if (!subdir) {
+        bool const isLast = (stop == path.length());
+        subdir = dir->mkdir(name.c_str(), isLast? title.c_str(): "");
+        if (!subdir) {
+          throw std::runtime_error{
+            "util::ROOT::AsyncObjectWriter: failed to create directory '"
+            + path.substr(0, stop) + "'"
+            };
+        }
+      }
+      dir = subdir;
+    }
+    start = stop + 1;
+  } // while
+  return dir;
+} // util::ROOT::AsyncObjectWriter::getDirectory()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // ICARUSALG_UTILITIES_ROOTASYNCWRITER_H
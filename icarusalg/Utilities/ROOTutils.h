@@ -16,12 +16,17 @@
 #include "TStyle.h"
 #include "TDirectory.h"
 #include "TAxis.h"
+#include "TH1.h"
+
+// C++ core guideline library
+#include "gsl/span"
 
 // C/C++ libraries
 #include <utility> // std::pair<>
 #include <vector>
 #include <string>
 #include <cassert>
+#include <cstddef> // std::size_t
 
 namespace util::detail {
   // 'gDirectory' is defined as a ROOT macro that, when preprocessed, expands to
@@ -227,6 +232,150 @@ namespace util::ROOT {
   makeVariableBinningAndLabels(Coll const& centralPoints);
   
   
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Constant time bin lookup for a variable size binning.
+   * @see `makeVariableBinningAndLabels()`, `VariableBinFiller`
+   * 
+   * This object is built from the bin edges of a variable size binning (e.g.
+   * the first element returned by `makeVariableBinningAndLabels()`) and it
+   * returns the bin a value belongs to with the same convention as
+   * `TAxis::FindBin()`: bin `0` is the underflow, bins `1` to `nBins()` are the
+   * regular bins, and bin `nBins() + 1` is the overflow (which also collects
+   * not-a-number values).
+   * 
+   * While `TAxis` uses a binary search on the bin edges, this object
+   * superimposes to the binning an auxiliary grid of uniform cells, each
+   * storing the first bin it overlaps with. The lookup of a value is then the
+   * computation of the cell it falls into, followed by a short linear scan of
+   * the bin edges, which is empty most of the times, since the cells are
+   * chosen not wider than the narrowest bin (within a limit of `MaxCellRatio`
+   * cells per bin).
+   * 
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * auto const [ edges, labels ]
+   *   = util::ROOT::makeVariableBinningAndLabels(channels);
+   * util::ROOT::VariableBinLookup const lookup { edges };
+   * util::ROOT::VariableBinFiller filler { lookup };
+   * 
+   * for (double const x: values) filler.fill(x);
+   * 
+   * TH1F hist{ "H", "H", lookup.nBins(), edges.data() };
+   * filler.addTo(hist);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class VariableBinLookup {
+    
+      public:
+    
+    /// Maximum number of auxiliary cells per bin.
+    static constexpr std::size_t MaxCellRatio = 16U;
+    
+    /**
+     * @brief Constructor: uses the specified bin edges.
+     * @param edges the bin edges (number of bins plus one), strictly growing
+     */
+    VariableBinLookup(std::vector<double> edges);
+    
+    /// Returns the number of regular bins (excluding underflow and overflow).
+    int nBins() const { return static_cast<int>(fEdges.size()) - 1; }
+    
+    /// Returns the bin edges.
+    std::vector<double> const& edges() const { return fEdges; }
+    
+    /// Returns the number of auxiliary cells.
+    std::size_t nCells() const { return fCellFirstBin.size(); }
+    
+    /// Returns the bin `x` falls into (see `TAxis::FindBin()`).
+    int findBin(double x) const;
+    
+    /**
+     * @brief Finds the bin of each of the `values`.
+     * @param values the values to find the bins of
+     * @param bins _(output)_ the bin of each value (see `findBin()`)
+     * 
+     * `bins` must have at least as many elements as `values`.
+     */
+    void findBins(gsl::span<double const> values, gsl::span<int> bins) const;
+    
+      private:
+    
+    std::vector<double> fEdges; ///< Bin edges.
+    
+    /// For each cell, the regular bin containing its lower edge.
+    std::vector<int> fCellFirstBin;
+    
+    double fCellScale = 0.0; ///< Inverse of the cell width.
+    
+  }; // class VariableBinLookup
+  
+  
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Accumulates entries in a plain array, to fill a histogram once.
+   * @see `VariableBinLookup`
+   * 
+   * The content of each bin, including underflow and overflow, and the sum of
+   * the squares of the weights are accumulated in plain arrays, using
+   * `VariableBinLookup` to find the bins. When done, the content can be added
+   * to a ROOT histogram with the same binning with `addTo()`, which updates
+   * bin contents, their errors and the number of entries. If any entry was
+   * added with a weight other than `1`, `addTo()` enables the storage of the
+   * sum of weight squares in the histogram (`TH1::Sumw2()`) before adding to
+   * it, as `TH1::Fill()` would do. Statistics like the mean are then computed
+   * by ROOT from the bin content.
+   * 
+   * The lookup object must remain valid for the whole lifetime of the filler.
+   */
+  class VariableBinFiller {
+    
+      public:
+    
+    /// Constructor: uses the binning from `lookup`, all bins empty.
+    explicit VariableBinFiller(VariableBinLookup const& lookup)
+      : fLookup{ &lookup }
+      , fContent(lookup.nBins() + 2, 0.0)
+      , fSumw2(lookup.nBins() + 2, 0.0)
+      {}
+    
+    /// A temporary lookup would not outlive the filler.
+    VariableBinFiller(VariableBinLookup&&) = delete;
+    
+    /// Adds an entry with value `x` and the specified `weight`.
+    void fill(double x, double weight = 1.0);
+    
+    /// Adds one entry with unit weight for each of the `values`.
+    void fill(gsl::span<double const> values);
+    
+    /// Adds one entry for each of the `values`, with the matching `weights`.
+    void fill(gsl::span<double const> values, gsl::span<double const> weights);
+    
+    /// Returns the content of all bins (`0` is underflow, last is overflow).
+    std::vector<double> const& content() const { return fContent; }
+    
+    /// Returns the number of entries added so far.
+    std::size_t entries() const { return fEntries; }
+    
+    /// Adds the accumulated content to `hist`, which must have same binning.
+    void addTo(TH1& hist) const;
+    
+    /// Empties all the bins.
+    void reset();
+    
+      private:
+    
+    VariableBinLookup const* fLookup; ///< Binning lookup.
+    
+    std::vector<double> fContent; ///< Content of each bin.
+    std::vector<double> fSumw2; ///< Sum of the weight squares in each bin.
+    std::size_t fEntries = 0U; ///< Number of entries.
+    
+    std::vector<int> fBinBuffer; ///< Buffer for bulk bin lookups.
+    
+  }; // class VariableBinFiller
+  
+  
   //----------------------------------------------------------------------------
   
 } // namespace util::ROOT
@@ -25,9 +25,11 @@
 #include "cetlib_except/exception.h"
 
 // C/C++ libraries
+#include <algorithm> // std::min(), std::fill()
 #include <iterator> // std::next()
 #include <vector>
 #include <string>
+#include <cmath> // std::ceil()
 #include <cassert>
 
 
@@ -82,6 +84,148 @@ util::ROOT::makeVariableBinningAndLabels(Coll const& centralPoints) {
 } // util::ROOT::makeVariableBinningAndLabels()
 
 
+// -----------------------------------------------------------------------------
+// ---  util::ROOT::VariableBinLookup
+// -----------------------------------------------------------------------------
+inline util::ROOT::VariableBinLookup::VariableBinLookup
+  (std::vector<double> edges)
+  : fEdges{ std::move(edges) }
+{
+  assert(fEdges.size() > 1U);
+  
+  std::size_t const nBins = fEdges.size() - 1U;
+  double const lower = fEdges.front();
+  double const range = fEdges.back() - lower;
+  assert(range > 0.0);
+  
+  // cells as narrow as the narrowest bin, within MaxCellRatio cells per bin
+  double minWidth = range;
+  for (std::size_t iBin = 0; iBin < nBins; ++iBin)
+    minWidth = std::min(minWidth, fEdges[iBin + 1] - fEdges[iBin]);
+  std::size_t const nCells = std::min(
+    nBins * MaxCellRatio,
+    static_cast<std::size_t>(std::ceil(range / minWidth))
+    );
+  
+  fCellScale = nCells / range;
+  fCellFirstBin.resize(nCells);
+  int bin = 1;
+  for (std::size_t iCell = 0; iCell < nCells; ++iCell) {
+    double const cellLower = lower + iCell / fCellScale;
+    while ((bin < static_cast<int>(nBins)) && (cellLower >= fEdges[bin]))
+      ++bin;
+    fCellFirstBin[iCell] = bin;
+  } // for cells
+  
+} // util::ROOT::VariableBinLookup::VariableBinLookup()
+
+
+// -----------------------------------------------------------------------------
+inline int util::ROOT::VariableBinLookup::findBin(double x) const {
+  
+  int const overflow = nBins() + 1;
+  if (x < fEdges.front()) return 0;
+  if (!(x < fEdges.back())) return overflow; // also NaN
+  
+  // the cell is only a first guess: rounding may bring us to a neighbour bin
+  std::size_t const iCell = std::min(
+    static_cast<std::size_t>((x - fEdges.front()) * fCellScale),
+    fCellFirstBin.size() - 1U
+    );
+  int bin = fCellFirstBin[iCell];
+  while (x >= fEdges[bin]) ++bin; // fEdges[bin] is the upper edge
+  while (x < fEdges[bin - 1]) --bin;
+  return bin;
+  
+} // util::ROOT::VariableBinLookup::findBin()
+
+
+// -----------------------------------------------------------------------------
+inline void util::ROOT::VariableBinLookup::findBins
+  (gsl::span<double const> values, gsl::span<int> bins) const
+{
+  assert(bins.size() >= values.size());
+  std::size_t const n = values.size();
+  for (std::size_t i = 0; i < n; ++i) bins[i] = findBin(values[i]);
+} // util::ROOT::VariableBinLookup::findBins()
+
+
+// -----------------------------------------------------------------------------
+// ---  util::ROOT::VariableBinFiller
+// -----------------------------------------------------------------------------
+inline void util::ROOT::VariableBinFiller::fill(double x, double weight) {
+  int const bin = fLookup->findBin(x);
+  fContent[bin] += weight;
+  fSumw2[bin] += weight * weight;
+  ++fEntries;
+} // util::ROOT::VariableBinFiller::fill()
+
+
+// -----------------------------------------------------------------------------
+inline void util::ROOT::VariableBinFiller::fill
+  (gsl::span<double const> values)
+{
+  fBinBuffer.resize(values.size());
+  fLookup->findBins(values, fBinBuffer);
+  for (int const bin: fBinBuffer) {
+    fContent[bin] += 1.0;
+    fSumw2[bin] += 1.0;
+  }
+  fEntries += values.size();
+} // util::ROOT::VariableBinFiller::fill(values)
+
+
+// -----------------------------------------------------------------------------
+inline void util::ROOT::VariableBinFiller::fill
+  (gsl::span<double const> values, gsl::span<double const> weights)
+{
+  assert(weights.size() >= values.size());
+  fBinBuffer.resize(values.size());
+  fLookup->findBins(values, fBinBuffer);
+  for (std::size_t i = 0; i < fBinBuffer.size(); ++i) {
+    int const bin = fBinBuffer[i];
+    fContent[bin] += weights[i];
+    fSumw2[bin] += weights[i] * weights[i];
+  }
+  fEntries += values.size();
+} // util::ROOT::VariableBinFiller::fill(values, weights)
+
+
+// -----------------------------------------------------------------------------
+inline void util::ROOT::VariableBinFiller::addTo(TH1& hist) const {
+  
+  assert(hist.GetNbinsX() == fLookup->nBins());
+  
+  double const entries = hist.GetEntries() + fEntries;
+  
+  // with any weight other than 1 the errors are not the square root of the
+  // content any more, and ROOT needs to track the sum of weight squares
+  // (`TH1::Sumw2()` initializes it from the content already in `hist`)
+  bool const weighted = (fSumw2 != fContent);
+  if (weighted && (hist.GetSumw2N() == 0)) hist.Sumw2();
+  bool const hasSumw2 = hist.GetSumw2N() > 0;
+  for (std::size_t bin = 0; bin < fContent.size(); ++bin) {
+    if (fSumw2[bin] == 0.0) continue; // nothing was added here
+    hist.AddBinContent(static_cast<int>(bin), fContent[bin]);
+    if (hasSumw2) {
+      TArrayD& sumw2 = *(hist.GetSumw2());
+      sumw2[bin] += fSumw2[bin];
+    }
+  } // for
+  hist.ResetStats(); // statistics from bin content
+  hist.SetEntries(entries);
+  
+} // util::ROOT::VariableBinFiller::addTo()
+
+
+// -----------------------------------------------------------------------------
+inline void util::ROOT::VariableBinFiller::reset() {
+  std::fill(fContent.begin(), fContent.end(), 0.0);
+  std::fill(fSumw2.begin(), fSumw2.end(), 0.0);
+  fEntries = 0U;
+} // util::ROOT::VariableBinFiller::reset()
+
+
 // -----------------------------------------------------------------------------
 
 
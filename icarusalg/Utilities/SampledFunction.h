@@ -20,14 +20,32 @@
 
 // C++ standard library
 #include <vector>
+#include <thread>
+#include <exception> // std::exception_ptr, std::rethrow_exception()
 #include <functional> // std::function<>
 #include <limits> // std::numeric_limits<>
+#include <algorithm> // std::max(), std::min()
 #include <cmath> // std::isnormal()
 #include <cassert>
 
 
 // ---------------------------------------------------------------------------
 namespace util {
+  
+  /// Options for the construction of `util::SampledFunction`.
+  struct SampledFunctionOptions {
+    
+    /**
+     * @brief Number of threads used to compute the subsamples.
+     * 
+     * With more than one thread, the sampled function is called concurrently
+     * from different threads, and it must support that. The value `0` stands
+     * for as many threads as the hardware supports.
+     */
+    unsigned int nThreads = 1U;
+    
+  }; // SampledFunctionOptions
+  
   template <typename XType, typename YType> class SampledFunction;
 } // namespace util
 
@@ -55,6 +73,14 @@ namespace util {
  * The function must be unary.
  *
  *
+ * Construction options
+ * ---------------------
+ *
+ * The constructors accept a `util::SampledFunctionOptions` object as optional
+ * last argument. Its `nThreads` member allows the subsamples to be computed
+ * in parallel, at the condition that the function can be called concurrently.
+ *
+ *
  * Technical note
  * ---------------
  *
@@ -95,6 +121,7 @@ class util::SampledFunction {
   using X_t = XType; ///< Type of value accepted by the function.
   using Y_t = YType; ///< Type of value returned by the function.
   using Function_t = std::function<Y_t(X_t)>; ///< Type of sampled function.
+  using Options_t = SampledFunctionOptions; ///< Construction options.
 
   /// Invalid index of sample, returned in case of error.
   static constexpr auto npos = std::numeric_limits<gsl::index>::max();
@@ -102,6 +129,12 @@ class util::SampledFunction {
   /// Span of subsample data. Can be forward iterated.
   using SubsampleData_t = gsl::span<Y_t const>;
 
+  /// A copy of the function, placed at `time` and scaled by `amplitude`.
+  struct Pulse_t {
+    X_t time; ///< Where the function is placed.
+    Y_t amplitude; ///< Scaling factor of the function.
+  }; // Pulse_t
+
   SampledFunction() = default; // FIXME remove this
   
   /**
@@ -113,6 +146,7 @@ class util::SampledFunction {
    * @param nSamples the number (_N_) of samples to be computed
    * @param subsamples (default: `1`) the number (_M_) of subsamples to be
    *                   computed
+   * @param options (default: serial computation) construction options
    *
    * The sampling of `function` is performed on `nSamples` points from `lower`
    * to `upper` (excluded).
@@ -128,7 +162,8 @@ class util::SampledFunction {
   SampledFunction(Func const& function,
     X_t lower, X_t upper,
     gsl::index nSamples,
-    gsl::index subsamples = 1
+    gsl::index subsamples = 1,
+    Options_t const& options = {}
     );
 
 
@@ -143,6 +178,7 @@ class util::SampledFunction {
    * @param subsamples (default: `1`) the number (_M_) of subsamples to be
    *                   computed
    * @param min_upper (default: none) minimum value covered by the sampling
+   * @param options (default: serial computation) construction options
    *
    * The sampling of `function` is performed from `lower`, advancing by `step`
    * at each following sample, until the `until` functor returns `true`.
@@ -158,12 +194,16 @@ class util::SampledFunction {
    * is ignored).
    *
    * Subsampling is performed based on the `subsamples` argument.
+   *
+   * The values computed while looking for the end of the range are kept and
+   * used as samples, so that `function` is evaluated only once per point.
    */
   template <typename Func, typename UntilFunc>
   SampledFunction(Func const& function,
     X_t lower, X_t step, UntilFunc&& until,
     gsl::index subsamples,
-    X_t min_upper
+    X_t min_upper,
+    Options_t const& options = {}
     );
   template <typename Func, typename UntilFunc>
   SampledFunction(Func const& function,
@@ -282,6 +322,58 @@ class util::SampledFunction {
   /// @}
   // --- END --- Access --------------------------------------------------------
 
+
+  // --- BEGIN --- Operations --------------------------------------------------
+  /// @name Operations on the sampled data
+  /// @{
+
+  /**
+   * @brief Adds scaled copies of the sampled function into a buffer.
+   * @tparam T type of the values in the destination buffer
+   * @param pulses the placement and scale of each copy, sorted by time
+   * @param dest the buffer to add the copies into
+   * @param mergeCoincident (default: `false`) add up first the amplitudes of
+   *                        pulses with the same placement
+   *
+   * Each pulse adds the subsample closest to its time, scaled by its
+   * amplitude, to `dest`, starting from the index of the step including the
+   * pulse time. The result is the same as of the loop:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * for (auto const& pulse: pulses) {
+   *   gsl::index const iSub = sf.closestSubsampleIndex(pulse.time);
+   *   gsl::index const start = sf.stepIndex(pulse.time, iSub);
+   *   auto const& shape = sf.subsample(iSub);
+   *   for (gsl::index i = 0; i < sf.size(); ++i) {
+   *     gsl::index const iDest = start + i;
+   *     if ((iDest >= 0) && (iDest < dest.size()))
+   *       dest[iDest] += pulse.amplitude * shape[i];
+   *   }
+   * }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Samples falling outside `dest` are ignored. The loop on each pulse runs
+   * on the overlapping range of contiguous data with no further checks, which
+   * lets the compiler vectorize it.
+   *
+   * If `mergeCoincident` is set, consecutive pulses which are placed on the
+   * same subsample and step are added as a single pulse with the sum of their
+   * amplitudes. This saves time when many pulses are coincident (e.g.
+   * photoelectrons in the same subtick), but since the amplitudes are summed
+   * before scaling, the result may differ from the loop above by rounding
+   * (it does not if the amplitudes and their products with the samples are
+   * exactly representable, e.g. small integral amplitudes).
+   *
+   * The pulses are required to be sorted by time for the coincident ones to
+   * be adjacent; sorting also makes the access to `dest` sequential.
+   */
+  template <typename T>
+  void addPulses(
+    gsl::span<Pulse_t const> pulses, gsl::span<T> dest,
+    bool mergeCoincident = false
+    ) const;
+
+  /// @}
+  // --- END --- Operations ----------------------------------------------------
+
   /// Dumps the full content of the sampling into `out` stream.
   template <typename Stream>
   void dump
@@ -301,6 +393,10 @@ class util::SampledFunction {
     X_t lower, upper;
     X_t step;
     gsl::index nSamples;
+    
+    /// Values of the first subsample already computed, from `firstKnown` on.
+    std::vector<Y_t> knownValues = {};
+    gsl::index firstKnown = 0; ///< Sample index of `knownValues[0]`.
   }; // Range_t
 
   X_t fLower; ///< Lower limit of sampled range.
@@ -314,8 +410,10 @@ class util::SampledFunction {
   std::vector<Y_t> fAllSamples;
 
   /// Constructor implementation.
-  SampledFunction
-    (Function_t const& function, Range_t const& range, gsl::index subsamples);
+  SampledFunction(
+    Function_t const& function, Range_t const& range, gsl::index subsamples,
+    Options_t const& options
+    );
 
   /// Returns the starting point of the subsample `n`.
   X_t subsampleOffset(gsl::index n) const
@@ -329,13 +427,19 @@ class util::SampledFunction {
   Y_t* subsampleData(gsl::index n) { return fAllSamples.data() + fNSamples * n; }
   // @}
 
+  /// Adds `amplitude` times subsample `iSub` into `dest` from index `start`.
+  template <typename T>
+  void addScaledSubsample(
+    gsl::index iSub, gsl::index start, Y_t amplitude, gsl::span<T> dest
+    ) const;
+
   /// Computes the total size of the data.
   std::size_t computeTotalSize() const { return nSubsamples() * size(); }
 
 
   /// Returns a range including at least from `lower` to `min_upper`,
   /// extended enough that `until(upper, f(upper))` is `true`, and with an
-  /// integral number of steps.
+  /// integral number of steps; the computed function values are included.
   template <typename UntilFunc>
   static Range_t extendRange(
     Function_t const& function, X_t lower, X_t min_upper, X_t step,
@@ -343,7 +447,14 @@ class util::SampledFunction {
     );
 
   /// Samples the `function` and fills the internal caches.
-  void fillSamples(Function_t const& function);
+  void fillSamples(
+    Function_t const& function, Range_t const& range, unsigned int nThreads
+    );
+
+  /// Samples the `function` for subsample `iSubsample`.
+  void fillSubsample(
+    Function_t const& function, gsl::index iSubsample, Range_t const& range
+    );
 
 
   /// Returns `value` made non-negative by adding multiples of `range`.
@@ -361,10 +472,24 @@ namespace util {
   SampledFunction(Func const&, XType, XType, UntilFunc&&, gsl::index, XType)
     -> SampledFunction<XType, XType>;
   
+  template <typename XType, typename Func, typename UntilFunc>
+  SampledFunction(
+    Func const&, XType, XType, UntilFunc&&, gsl::index, XType,
+    SampledFunctionOptions const&
+    )
+    -> SampledFunction<XType, XType>;
+  
   template <typename XType, typename Func>
   SampledFunction(Func const&, XType, XType, gsl::index, gsl::index = 1)
     -> SampledFunction<XType, XType>;
   
+  template <typename XType, typename Func>
+  SampledFunction(
+    Func const&, XType, XType, gsl::index, gsl::index,
+    SampledFunctionOptions const&
+    )
+    -> SampledFunction<XType, XType>;
+  
   template <typename XType, typename Func, typename UntilFunc>
   SampledFunction(Func const&, XType, XType, UntilFunc&&, gsl::index = 1)
     -> SampledFunction<XType, XType>;
@@ -381,12 +506,13 @@ util::SampledFunction<XType, YType>::SampledFunction(
   Func const& function,
   X_t lower, X_t upper,
   gsl::index nSamples,
-  gsl::index subsamples
+  gsl::index subsamples /* = 1 */,
+  Options_t const& options /* = {} */
   )
   : SampledFunction(
       Function_t(function),
       Range_t{ lower, upper, (upper - lower) / nSamples, nSamples },
-      subsamples
+      subsamples, options
     )
 {}
 
@@ -398,13 +524,28 @@ util::SampledFunction<XType, YType>::SampledFunction(
   Func const& function,
   X_t lower, X_t step, UntilFunc&& until,
   gsl::index subsamples,
-  X_t min_upper
+  X_t min_upper,
+  Options_t const& options /* = {} */
   )
   : SampledFunction(
       Function_t(function),
       extendRange
         (function, lower, min_upper, step, std::forward<UntilFunc>(until)),
-      subsamples
+      subsamples, options
+    )
+{}
+
+
+// -----------------------------------------------------------------------------
+template <typename XType, typename YType>
+template <typename Func, typename UntilFunc>
+util::SampledFunction<XType, YType>::SampledFunction(
+  Func const& function,
+  X_t lower, X_t step, UntilFunc&& until,
+  gsl::index subsamples /* = 1 */
+  )
+  : SampledFunction(
+      function, lower, step, std::forward<UntilFunc>(until), subsamples, lower
     )
 {}
 
@@ -431,6 +572,61 @@ gsl::index util::SampledFunction<XType, YType>::closestSubsampleIndex
 } // gsl::index util::SampledFunction<XType, YType>::stepIndex()
 
 
+// -----------------------------------------------------------------------------
+template <typename XType, typename YType>
+template <typename T>
+void util::SampledFunction<XType, YType>::addPulses(
+  gsl::span<Pulse_t const> pulses, gsl::span<T> dest,
+  bool mergeCoincident /* = false */
+) const {
+
+  auto iPulse = pulses.begin();
+  auto const pend = pulses.end();
+  while (iPulse != pend) {
+
+    gsl::index const iSub = closestSubsampleIndex(iPulse->time);
+    gsl::index const start = stepIndex(iPulse->time, iSub);
+    Y_t amplitude = iPulse->amplitude;
+    assert((iPulse + 1 == pend) || (iPulse[0].time <= iPulse[1].time));
+    ++iPulse;
+
+    if (mergeCoincident) {
+      for (; iPulse != pend; ++iPulse) {
+        gsl::index const iNextSub = closestSubsampleIndex(iPulse->time);
+        if (iNextSub != iSub) break;
+        if (stepIndex(iPulse->time, iNextSub) != start) break;
+        amplitude += iPulse->amplitude;
+      } // for
+    } // if merge
+
+    addScaledSubsample(iSub, start, amplitude, dest);
+
+  } // while
+
+} // util::SampledFunction<>::addPulses()
+
+
+// -----------------------------------------------------------------------------
+template <typename XType, typename YType>
+template <typename T>
+void util::SampledFunction<XType, YType>::addScaledSubsample(
+  gsl::index iSub, gsl::index start, Y_t amplitude, gsl::span<T> dest
+) const {
+
+  // overlap of the subsample [ 0, size() ) with dest [ -start, dsize - start )
+  auto const destSize = static_cast<gsl::index>(dest.size());
+  gsl::index const first = std::max(gsl::index{ 0 }, -start);
+  gsl::index const last = std::min(size(), destSize - start);
+  if (first >= last) return;
+
+  Y_t const* const shape = subsampleData(iSub) + first;
+  T* const d = dest.data() + (start + first);
+  gsl::index const n = last - first;
+  for (gsl::index i = 0; i < n; ++i) d[i] += amplitude * shape[i];
+
+} // util::SampledFunction<>::addScaledSubsample()
+
+
 // -----------------------------------------------------------------------------
 template <typename XType, typename YType>
 template <typename Stream>
@@ -460,7 +656,8 @@ template <typename XType, typename YType>
 util::SampledFunction<XType, YType>::SampledFunction(
   Function_t const& function,
   Range_t const& range,
-  gsl::index subsamples
+  gsl::index subsamples,
+  Options_t const& options
   )
   : fLower(range.lower)
   , fUpper(range.upper)
@@ -471,7 +668,7 @@ util::SampledFunction<XType, YType>::SampledFunction(
 {
   assert(fNSamples > 0);
   assert(subsamples > 0);
-  fillSamples(function);
+  fillSamples(function, range, options.nThreads);
 } // util::SampledFunction<>::SampledFunction(range)
 
 
@@ -492,8 +689,15 @@ auto util::SampledFunction<XType, YType>::extendRange(
 
   Range_t r { lower, endStep(startSamples), step, startSamples };
 
-  while (!until(r.upper + r.step, function(r.upper + r.step))) {
+  // the values computed here are samples of the first subsample, and they are
+  // kept; the points are computed exactly as in `fillSubsample()`
+  r.firstKnown = startSamples + 1;
+  while (true) {
+    X_t const x = endStep(r.nSamples + 1);
+    Y_t const y = function(x);
+    if (until(x, y)) break;
     // upper + step is not too much: extend to there
+    r.knownValues.push_back(y);
     ++r.nSamples;
     r.upper = endStep(r.nSamples);
   } // while
@@ -505,14 +709,14 @@ auto util::SampledFunction<XType, YType>::extendRange(
 // -----------------------------------------------------------------------------
 template <typename XType, typename YType>
 void util::SampledFunction<XType, YType>::fillSamples
-  (Function_t const& function)
+  (Function_t const& function, Range_t const& range, unsigned int nThreads)
 {
 
   /*
    * Plan:
    * 0. rely on the currently stored size specifications (range and samples)
    * 1. resize the data structure to the required size
-   * 2. fill all the subsamples, in sequence
+   * 2. fill all the subsamples, in sequence or in parallel
    *
    */
 
@@ -530,21 +734,68 @@ void util::SampledFunction<XType, YType>::fillSamples
   fAllSamples.resize(dataSize);
 
   //
-  // 2. fill all the subsamples, in sequence
+  // 2. fill all the subsamples, in sequence or in parallel
   //
-  auto iValue = fAllSamples.begin();
-  for (gsl::index const iSubsample: util::counter(nSubsamples())) {
-    X_t const offset = subsampleOffset(iSubsample);
-    for (gsl::index const iStep: util::counter(size())) {
-      X_t const x = offset + iStep * stepSize();
-      Y_t const y = function(x);
-      *iValue++ = y;
-    } // for steps
-  } // for subsamples
+  if (nThreads == 0) nThreads = std::max(std::thread::hardware_concurrency(), 1U);
+  auto const nWorkers = static_cast<gsl::index>
+    (std::min<gsl::index>(nThreads, nSubsamples()));
+
+  if (nWorkers <= 1) {
+    for (gsl::index const iSubsample: util::counter(nSubsamples()))
+      fillSubsample(function, iSubsample, range);
+    return;
+  }
+
+  // each worker fills every `nWorkers`-th subsample (they do not overlap)
+  std::vector<std::exception_ptr> errors(nWorkers);
+  std::vector<std::thread> workers;
+  for (gsl::index const iWorker: util::counter(nWorkers)) {
+    workers.emplace_back([this, &function, &range, &errors, iWorker, nWorkers]()
+      {
+        try {
+          for (gsl::index iSub = iWorker; iSub < nSubsamples(); iSub += nWorkers)
+            fillSubsample(function, iSub, range);
+        }
+        catch (...) { errors[iWorker] = std::current_exception(); }
+      });
+  } // for
+  for (std::thread& worker: workers) worker.join();
+
+  for (std::exception_ptr const& error: errors)
+    if (error) std::rethrow_exception(error);
 
 } // util::SampledFunction<>::fillSamples()
 
 
+// -----------------------------------------------------------------------------
+template <typename XType, typename YType>
+void util::SampledFunction<XType, YType>::fillSubsample
+  (Function_t const& function, gsl::index iSubsample, Range_t const& range)
+{
+  // values already computed for the first subsample are used as they are
+  gsl::index firstKnown = size(), endKnown = size();
+  if (iSubsample == 0) {
+    firstKnown = std::min(range.firstKnown, size());
+    endKnown = std::min(
+      size(),
+      firstKnown + static_cast<gsl::index>(range.knownValues.size())
+      );
+  }
+
+  X_t const offset = subsampleOffset(iSubsample);
+  Y_t* const values = subsampleData(iSubsample);
+  for (gsl::index const iStep: util::counter(size())) {
+    if ((iStep >= firstKnown) && (iStep < endKnown)) {
+      values[iStep] = range.knownValues[iStep - firstKnown];
+      continue;
+    }
+    X_t const x = offset + iStep * stepSize();
+    values[iStep] = function(x);
+  } // for steps
+
+} // util::SampledFunction<>::fillSubsample()
+
+
 // -----------------------------------------------------------------------------
 template <typename XType, typename YType>
 template <typename T>
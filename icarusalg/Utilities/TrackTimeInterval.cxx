@@ -16,11 +16,65 @@
 
 // C/C++ standard libraries
 #include <ostream>
+#include <algorithm> // std::min(), std::max()
 #include <utility> // std::move()
 #include <cmath> // std::abs()
 #include <cassert>
 
 
+// -----------------------------------------------------------------------------
+namespace {
+  
+  /**
+   * @brief Merges cathode ranges of many tracks, and intersects the result.
+   * @param n number of tracks
+   * @param start1 start times of the tracks on one side of the cathode
+   * @param stop1 stop times of the tracks on one side of the cathode
+   * @param start2 start times on the other side (`nullptr` if no such side)
+   * @param stop2 stop times on the other side (`nullptr` if no such side)
+   * @param start (in/out) start times of the ranges to be intersected
+   * @param stop (in/out) stop times of the ranges to be intersected
+   * @param undefined value of undefined times
+   * 
+   * This is the flat array version of `mergeCathodeRanges()` followed by
+   * `TimeRange::intersect()`. Since the undefined time is the lowest value,
+   * the intersection of the starts is just their maximum, while for the stops
+   * the undefined times must be skipped.
+   */
+  void mergeCathodeArrays(
+    std::size_t n,
+    double const* start1, double const* stop1,
+    double const* start2, double const* stop2,
+    double* start, double* stop,
+    double undefined
+  ) {
+    
+    for (std::size_t i = 0; i < n; ++i) {
+      
+      // mergeCathodeRanges()
+      double mergedStart = start1[i], mergedStop = stop1[i];
+      if (start2) {
+        bool const valid1 = (start1[i] != undefined) || (stop1[i] != undefined);
+        bool const valid2 = (start2[i] != undefined) || (stop2[i] != undefined);
+        double const lower = std::min(start1[i], start2[i]);
+        double const upper = std::max(start1[i], start2[i]);
+        mergedStart = !valid2? start1[i]: !valid1? start2[i]: lower;
+        mergedStop = !valid2? stop1[i]: !valid1? stop2[i]: upper;
+      }
+      
+      // TimeRange::intersect()
+      start[i] = std::max(start[i], mergedStart);
+      stop[i] = ((stop[i] == undefined)
+        || ((mergedStop != undefined) && (mergedStop < stop[i])))
+        ? mergedStop: stop[i];
+      
+    } // for
+    
+  } // mergeCathodeArrays()
+  
+} // local namespace
+
+
 // -----------------------------------------------------------------------------
 lar::util::TrackTimeInterval::TrackTimeInterval(
   geo::GeometryCore const& geom,
@@ -175,17 +229,16 @@ auto lar::util::TrackTimeInterval::extractTPCtoSetMap
 
 // -----------------------------------------------------------------------------
 auto lar::util::TrackTimeInterval::mergeTPCsetRanges_SBN
-  (readout::TPCsetDataContainer<TimeRange> const& TPCsetRanges) const
-  -> TimeRange
+  (readout::TPCsetDataContainer<TimeRange> const& TPCsetRanges) -> TimeRange
 {
   // reduce to each cryostat
-  std::vector<TimeRange> cryoRanges{ fGeomCache.Ncryostats() };
+  std::vector<TimeRange> cryoRanges{ TPCsetRanges.dimSize<0U>() };
   for (readout::CryostatID::CryostatID_t const cryoNo
     : ::util::counter(cryoRanges.size())
   ) {
     readout::CryostatID const cryoID{ cryoNo };
     
-    unsigned int const NTPCsets = fGeomCache.TPCsetDims[1];
+    unsigned int const NTPCsets = TPCsetRanges.dimSize<1U>();
     
     TimeRange& cryoRange = cryoRanges[cryoNo];
     
@@ -225,7 +278,7 @@ auto lar::util::TrackTimeInterval::mergeTPCsetRanges_SBN
 
 // -----------------------------------------------------------------------------
 auto lar::util::TrackTimeInterval::mergeCathodeRanges
-  (TimeRange const& range1, TimeRange const& range2) const -> TimeRange
+  (TimeRange const& range1, TimeRange const& range2) -> TimeRange
 {
 
   if (!range2.isValid()) return range1; // even if range1 is itself invalid
@@ -244,6 +297,56 @@ auto lar::util::TrackTimeInterval::mergeCathodeRanges
 } // lar::util::TrackTimeInterval::mergeCathodeRanges()
 
 
+// -----------------------------------------------------------------------------
+auto lar::util::TrackTimeInterval::makeTPCsetRangeTable
+  (std::size_t nTracks) const -> TPCsetRangeTable
+{
+  return { nTracks, fGeomCache.TPCsetDims[0], fGeomCache.TPCsetDims[1] };
+}
+
+
+// -----------------------------------------------------------------------------
+auto lar::util::TrackTimeInterval::timeRangesOfTracks
+  (TPCsetRangeTable const& table) -> TimeRangeArrays
+{
+  // same logic as mergeTPCsetRanges_SBN(): since intersection does not depend
+  // on the order, the merged cathode ranges are intersected directly into
+  // the result instead of going through each cryostat first
+  std::size_t const nTracks = table.nTracks();
+  TimeRangeArrays merged;
+  merged.start.assign(nTracks, UndefinedTimeValue);
+  merged.stop.assign(nTracks, UndefinedTimeValue);
+  
+  unsigned int const NTPCsets = table.nTPCsets();
+  unsigned int const nCathodes = (NTPCsets + 1) / 2;
+  assert((nCathodes == 1) || (table.nCryostats() == 0));
+  
+  for (readout::CryostatID::CryostatID_t const cryoNo
+    : ::util::counter(table.nCryostats())
+  ) {
+    readout::CryostatID const cryoID{ cryoNo };
+    
+    for (unsigned int const TPCsetNo: ::util::counter(nCathodes)) {
+      
+      readout::TPCsetID const tpcsetID1(cryoID, TPCsetNo);
+      readout::TPCsetID const tpcsetID2(cryoID, TPCsetNo + 1);
+      bool const hasTPCset2 = table.hasTPCset(tpcsetID2);
+      mergeCathodeArrays(nTracks,
+        table.startTimes(tpcsetID1), table.stopTimes(tpcsetID1),
+        hasTPCset2? table.startTimes(tpcsetID2): nullptr,
+        hasTPCset2? table.stopTimes(tpcsetID2): nullptr,
+        merged.start.data(), merged.stop.data(),
+        UndefinedTimeValue
+        );
+      
+    } // for cathodes
+    
+  } // for cryostats
+  
+  return merged;
+} // lar::util::TrackTimeInterval::timeRangesOfTracks()
+
+
 // -----------------------------------------------------------------------------
 geo::WireID lar::util::TrackTimeInterval::hitWire(recob::Hit const& hit)
   { return hit.WireID(); }
@@ -271,6 +374,50 @@ auto lar::util::TrackTimeInterval::TimeRange::intersect(TimeRange const& other)
 } // lar::util::TrackTimeInterval::TimeRange::intersect(TimeRange)
 
 
+// -----------------------------------------------------------------------------
+// --- lar::util::TrackTimeInterval::TPCsetRangeTable implementation
+// -----------------------------------------------------------------------------
+lar::util::TrackTimeInterval::TPCsetRangeTable::TPCsetRangeTable
+  (std::size_t nTracks, unsigned int nCryostats, unsigned int nTPCsets)
+  : fNTracks{ nTracks }
+  , fNCryostats{ nCryostats }
+  , fNTPCsets{ nTPCsets }
+  , fStart(nTracks * nCryostats * nTPCsets, UndefinedTimeValue)
+  , fStop(nTracks * nCryostats * nTPCsets, UndefinedTimeValue)
+  {}
+
+
+// -----------------------------------------------------------------------------
+bool lar::util::TrackTimeInterval::TPCsetRangeTable::hasTPCset
+  (readout::TPCsetID const& tpcsetID) const
+{
+  return tpcsetID.isValid
+    && (tpcsetID.Cryostat < fNCryostats) && (tpcsetID.TPCset < fNTPCsets);
+}
+
+
+// -----------------------------------------------------------------------------
+auto lar::util::TrackTimeInterval::TPCsetRangeTable::range
+  (std::size_t track, readout::TPCsetID const& tpcsetID) const -> TimeRange
+{
+  std::size_t const i = blockOffset(tpcsetID) + track;
+  return { electronics_time{ fStart[i] }, electronics_time{ fStop[i] } };
+}
+
+
+// -----------------------------------------------------------------------------
+void lar::util::TrackTimeInterval::TPCsetRangeTable::intersect(
+  std::size_t track, readout::TPCsetID const& tpcsetID,
+  TimeRange const& range
+) {
+  std::size_t const i = blockOffset(tpcsetID) + track;
+  TimeRange const merged
+    = this->range(track, tpcsetID).intersect(range);
+  fStart[i] = merged.start.value();
+  fStop[i] = merged.stop.value();
+} // lar::util::TrackTimeInterval::TPCsetRangeTable::intersect()
+
+
 // -----------------------------------------------------------------------------
 lar::util::TrackTimeInterval::TimeRange::operator std::string() const {
   using namespace std::string_literals;
@@ -24,8 +24,10 @@
 
 // C/C++ standard libraries
 #include <string>
+#include <vector>
 #include <iterator> // std::cbegin(), std::cend()
 #include <iosfwd>
+#include <cstddef> // std::size_t
 
 
 // -----------------------------------------------------------------------------
@@ -93,6 +95,27 @@ namespace lar::util {
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * 
  * 
+ * Processing many tracks at once
+ * -------------------------------
+ * 
+ * When the time ranges of many tracks are needed together (for example, to
+ * compare each of them with all the flashes in the event), the per-TPC set
+ * ranges of all the tracks can be collected in a `TPCsetRangeTable`, and then
+ * merged in a single pass with `timeRangesOfTracks()`:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * lar::util::TrackTimeInterval::TPCsetRangeTable table
+ *   = chargeTime.makeTPCsetRangeTable(nTracks);
+ * for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack)
+ *   chargeTime.addHitsToTable(table, iTrack, trackHits[iTrack]);
+ * 
+ * lar::util::TrackTimeInterval::TimeRangeArrays const ranges
+ *   = chargeTime.timeRangesOfTracks(table);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The result is the same as from `timeRangeOfHits()` on each track, but the
+ * times are stored in flat arrays, one per TPC set with one entry per track,
+ * and the merge runs on all the tracks in loops that the compiler can
+ * vectorize.
+ * 
  */
 class lar::util::TrackTimeInterval {
   
@@ -169,6 +192,103 @@ class lar::util::TrackTimeInterval {
     
   }; // TimeRange
   
+  
+  /// Value of the times in the flat arrays standing for `UndefinedTime`.
+  static constexpr double UndefinedTimeValue = TimeRange::UndefinedTime.value();
+  
+  
+  /**
+   * @brief Time ranges of many tracks, stored as separate arrays of times.
+   * 
+   * The times are in microseconds, on the electronics time scale.
+   * Undefined times have the value `UndefinedTimeValue`.
+   */
+  struct TimeRangeArrays {
+    
+    std::vector<double> start; ///< Start time of each range.
+    std::vector<double> stop; ///< Stop time of each range.
+    
+    /// Returns the number of ranges.
+    std::size_t size() const { return start.size(); }
+    
+    /// Returns the range at position `i`.
+    TimeRange operator[] (std::size_t i) const
+      { return { electronics_time{ start[i] }, electronics_time{ stop[i] } }; }
+    
+  }; // TimeRangeArrays
+  
+  
+  /**
+   * @brief Allowed time ranges of many tracks in each TPC set.
+   * 
+   * The start and stop times are stored in two flat arrays, in blocks by TPC
+   * set, each block holding the times of all the tracks.
+   * The times are in microseconds, on the electronics time scale.
+   * All ranges start invalid.
+   * 
+   * This table is usually created by
+   * `TrackTimeInterval::makeTPCsetRangeTable()` and filled by
+   * `TrackTimeInterval::addHitsToTable()`.
+   */
+  class TPCsetRangeTable {
+    
+      public:
+    
+    /// Constructor: an empty table.
+    TPCsetRangeTable() = default;
+    
+    /// Constructor: table of invalid ranges for `nTracks` tracks.
+    TPCsetRangeTable
+      (std::size_t nTracks, unsigned int nCryostats, unsigned int nTPCsets);
+    
+    /// Returns the number of tracks in the table.
+    std::size_t nTracks() const { return fNTracks; }
+    
+    /// Returns the number of cryostats in the table.
+    unsigned int nCryostats() const { return fNCryostats; }
+    
+    /// Returns the number of TPC sets per cryostat in the table.
+    unsigned int nTPCsets() const { return fNTPCsets; }
+    
+    /// Returns whether the table has a block for the specified TPC set.
+    bool hasTPCset(readout::TPCsetID const& tpcsetID) const;
+    
+    /// Returns the range of `track` in the TPC set `tpcsetID`.
+    TimeRange range
+      (std::size_t track, readout::TPCsetID const& tpcsetID) const;
+    
+    /// Contracts the range of `track` in `tpcsetID` to intersect `range`.
+    void intersect(
+      std::size_t track, readout::TPCsetID const& tpcsetID,
+      TimeRange const& range
+      );
+    
+    /// Returns the start times of all the tracks in TPC set `tpcsetID`.
+    double const* startTimes(readout::TPCsetID const& tpcsetID) const
+      { return fStart.data() + blockOffset(tpcsetID); }
+    
+    /// Returns the stop times of all the tracks in TPC set `tpcsetID`.
+    double const* stopTimes(readout::TPCsetID const& tpcsetID) const
+      { return fStop.data() + blockOffset(tpcsetID); }
+    
+      private:
+    
+    std::size_t fNTracks = 0U; ///< Number of tracks.
+    unsigned int fNCryostats = 0U; ///< Number of cryostats.
+    unsigned int fNTPCsets = 0U; ///< Number of TPC sets per cryostat.
+    
+    std::vector<double> fStart; ///< Start times, by TPC set, then by track.
+    std::vector<double> fStop; ///< Stop times, by TPC set, then by track.
+    
+    /// Returns the position of the first track of `tpcsetID` in the arrays.
+    std::size_t blockOffset(readout::TPCsetID const& tpcsetID) const
+      {
+        return
+          (tpcsetID.Cryostat * fNTPCsets + tpcsetID.TPCset) * fNTracks;
+      }
+    
+  }; // TPCsetRangeTable
+  
   // ---  END  ----- data structures -------------------------------------------
   
   
@@ -259,6 +379,91 @@ class lar::util::TrackTimeInterval {
   TimeRange timeRangeOfHits(HitColl const& hits) const;
   
   
+  // --- BEGIN --- Processing many tracks --------------------------------------
+  /// @name Processing many tracks
+  /// @{
+  
+  /// Returns a table of (invalid) TPC set ranges for `nTracks` tracks.
+  TPCsetRangeTable makeTPCsetRangeTable(std::size_t nTracks) const;
+  
+  /**
+   * @brief Includes a sequence of hits into the ranges of `track` in `table`.
+   * @tparam BIter type of begin iterator
+   * @tparam EIter type of end iterator
+   * @param table the table to be updated
+   * @param track the index of the track the hits belong to
+   * @param begin iterator to the sequence
+   * @param end iterator past the end of the sequence
+   * @see `timeRangeOfHits(BIter, EIter) const`
+   * 
+   * All objects in the sequence must be acceptable arguments for a
+   * `timeRange()` call. Each of them restricts the range of `track` in the
+   * TPC set it belongs to.
+   */
+  template <typename BIter, typename EIter>
+  void addHitsToTable
+    (TPCsetRangeTable& table, std::size_t track, BIter begin, EIter end) const;
+  
+  /// Includes all the hits in `hits` into the ranges of `track` in `table`.
+  /// @see `addHitsToTable(TPCsetRangeTable&, std::size_t, BIter, EIter) const`
+  template <typename HitColl>
+  void addHitsToTable
+    (TPCsetRangeTable& table, std::size_t track, HitColl const& hits) const;
+  
+  /**
+   * @brief Returns the time ranges of all the tracks in `table`.
+   * @param table the ranges of each track in each TPC set
+   * @return the combined time range of each track
+   * 
+   * The ranges of each track are combined as in `mergeTPCsetRanges_SBN()`.
+   * The result for each track is the same as `timeRangeOfHits()` would return
+   * for the hits of that track.
+   */
+  static TimeRangeArrays timeRangesOfTracks(TPCsetRangeTable const& table);
+  
+  /// @}
+  // --- END ----- Processing many tracks --------------------------------------
+  
+  
+  // --- BEGIN --- Combination of ranges ---------------------------------------
+  /// @name Combination of ranges
+  /// @{
+  
+  /**
+   * @brief Merges two ranges from the opposite sides of a cathode.
+   * @param range1 allowed time range from one side of the cathode
+   * @param range2 allowed time range from the other side of the cathode
+   * @return a single allowed time range
+   * 
+   * If both ranges are valid, the combination assumes that the actual time is
+   * locked and it is the time bringing both sides on the cathode (may result
+   * in a range of times).
+   * Otherwise, the range that is valid is returned as is.
+   */
+  static TimeRange mergeCathodeRanges
+    (TimeRange const& range1, TimeRange const& range2);
+  
+  /**
+   * @brief Merges the ranges from all the TPC sets in the detector.
+   * @param TPCsetRanges container of allowed range from each TPC set
+   * @return a combined range
+   * 
+   * As an input, each TPC set contributes its hypothesis of allowed time range;
+   * that hypothesis is invalid (`!isValid()`) if there was no information in
+   * the TPC set.
+   * The combination assumes that all the hits belong to the same activity and
+   * that the time of all that activity is only one.
+   * Contributions from different cryostats are intersected, and within each
+   * cryostat the combination of the two TPC sets is also intersection of the
+   * two (see `mergeCathodeRanges()`).
+   */
+  static TimeRange mergeTPCsetRanges_SBN
+    (readout::TPCsetDataContainer<TimeRange> const& TPCsetRanges);
+  
+  /// @}
+  // --- END ----- Combination of ranges ---------------------------------------
+  
+  
     private:
   friend class TrackTimeIntervalMaker;
   
@@ -316,38 +521,6 @@ class lar::util::TrackTimeInterval {
     (geo::GeometryCore const& geom);
   
   
-  /**
-   * @brief Merges two ranges from the opposite sides of a cathode.
-   * @param range1 allowed time range from one side of the cathode
-   * @param range2 allowed time range from the other side of the cathode
-   * @return a single allowed time range
-   * 
-   * If both ranges are valid, the combination assumes that the actual time is
-   * locked and it is the time bringing both sides on the cathode (may result
-   * in a range of times).
-   * Otherwise, the range that is valid is returned as is.
-   */
-  TimeRange mergeCathodeRanges
-    (TimeRange const& range1, TimeRange const& range2) const;
-  
-  /**
-   * @brief Merges the ranges from all the TPC sets in the detector.
-   * @param TPCsetRanges container of allowed range from each TPC set
-   * @return a combined range
-   * 
-   * As an input, each TPC set contributes its hypothesis of allowed time range;
-   * that hypothesis is invalid (`!isValid()`) if there was no information in
-   * the TPC set.
-   * The combination assumes that all the hits belong to the same activity and
-   * that the time of all that activity is only one.
-   * Contributions from different cryostats are intersected, and within each
-   * cryostat the combination of the two TPC sets is also intersection of the
-   * two (see `mergeCathodeRanges()`).
-   */
-  TimeRange mergeTPCsetRanges_SBN
-    (readout::TPCsetDataContainer<TimeRange> const& TPCsetRanges) const;
-  
-  
   /// Returns a copy of the wire ID of a `hit`.
   static geo::WireID hitWire(recob::Hit const& hit);
   
@@ -544,6 +717,28 @@ auto lar::util::TrackTimeInterval::timeRangeOfHits(HitColl const& hits) const
 } // lar::util::TrackTimeInterval::timeRangeOfHits(HitColl)
 
 
+// -----------------------------------------------------------------------------
+template <typename BIter, typename EIter>
+void lar::util::TrackTimeInterval::addHitsToTable
+  (TPCsetRangeTable& table, std::size_t track, BIter begin, EIter end) const
+{
+  while (begin != end) {
+    readout::TPCsetID const tpcsetID = fGeomCache.TPCtoSet.at(hitWire(*begin));
+    table.intersect(track, tpcsetID, timeRange(*begin++));
+  }
+} // lar::util::TrackTimeInterval::addHitsToTable(Iter)
+
+
+// -----------------------------------------------------------------------------
+template <typename HitColl>
+void lar::util::TrackTimeInterval::addHitsToTable
+  (TPCsetRangeTable& table, std::size_t track, HitColl const& hits) const
+{
+  using std::cbegin, std::cend;
+  addHitsToTable(table, track, cbegin(hits), cend(hits));
+} // lar::util::TrackTimeInterval::addHitsToTable(HitColl)
+
+
 // -----------------------------------------------------------------------------
 template <typename T>
 readout::TPCsetDataContainer<T> lar::util::TrackTimeInterval::makeTPCsetData
@@ -11,71 +11,34 @@
 #include "icarusalg/Utilities/WeakCurrentType.h"
 
 // C/C++ standard library
-#include <algorithm> // std::transform()
-#include <iterator> // std::back_inserter()
-#include <stdexcept> // std::logic_error
-#include <cctype>
+#include <algorithm> // std::equal()
+#include <cctype> // std::toupper()
+#include <initializer_list>
 
 
 //------------------------------------------------------------------------------
-namespace {
-  
-  // ---------------------------------------------------------------------------
-  bool anyOf(std::string const& value, std::initializer_list<std::string> keys)
-    { return std::find(keys.begin(), keys.end(), value) != keys.end(); }
-  
-  
-  // ---------------------------------------------------------------------------
-  
-} // local namespace
-
-
-//------------------------------------------------------------------------------
-std::string icarus::WeakCurrentType::name() const {
-  
-  switch (fType) {
-    case CC:  return "charged";
-    case NC:  return "neutral";
-    case any: return "any";
-  } // switch
-  throw std::logic_error("icarus::WeakCurrentType::name()");
-} // icarus::WeakCurrentType::name()
-
-
-//------------------------------------------------------------------------------
-std::string icarus::WeakCurrentType::shortName() const {
-  
-  switch (fType) {
-    case CC:  return "CC";
-    case NC:  return "NC";
-    case any: return "any";
-  } // switch
-  throw std::logic_error("icarus::WeakCurrentType::shortName()");
-  
-} // icarus::WeakCurrentType::shortName()
-
-
-//------------------------------------------------------------------------------
-std::string icarus::WeakCurrentType::to_upper(std::string const& s) {
-  
-  std::string S;
-  S.reserve(s.size());
+bool icarus::WeakCurrentType::equal_nocase
+  (std::string_view a, std::string_view b)
+{
   
   auto char_toupper = [](unsigned char c){ return std::toupper(c); };
-  std::transform(s.begin(), s.end(), std::back_inserter(S), char_toupper);
+  auto const char_equal = [char_toupper](char c1, char c2)
+    { return char_toupper(c1) == char_toupper(c2); };
+  
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(), char_equal);
   
-  return S;
-} // icarus::WeakCurrentType::to_upper()
+} // icarus::WeakCurrentType::equal_nocase()
 
 
 //------------------------------------------------------------------------------
-auto icarus::WeakCurrentType::parse(std::string const& spec) -> CurrentType {
+auto icarus::WeakCurrentType::parse(std::string_view spec) -> CurrentType {
   
-  std::string const SPEC = to_upper(spec);
+  if (spec.empty()) return any;
   
-  if (anyOf(SPEC, { "CHARGED", "CC" })) return CC;
-  if (anyOf(SPEC, { "NEUTRAL", "NC" })) return NC;
-  if (anyOf(SPEC, { "", "ANY" }))       return any;
+  for (CurrentType const type: { CC, NC, any }) {
+    if (equal_nocase(spec, nameOf(type))) return type;
+    if (equal_nocase(spec, shortNameOf(type))) return type;
+  } // for
   
   throw cet::exception("WeakCurrentType")
     << "Invalid weak current specification: '" << spec << "'\n";
@@ -14,7 +14,10 @@
 #include "cetlib_except/exception.h"
 
 // C/C++ standard library
+#include <array>
+#include <cstddef> // std::size_t
 #include <string>
+#include <string_view>
 
 
 // --- BEGIN -- Weak current types ---------------------------------------------
@@ -73,28 +76,66 @@ class icarus::WeakCurrentType {
   
   /// Constructor: assigns the value interpreting the specification `spec`.
   /// @see `WeakCurrentType::parse()`
-  explicit WeakCurrentType(std::string const& spec)
+  explicit WeakCurrentType(std::string_view spec)
     : WeakCurrentType(parse(spec)) {}
   
   // --- END -- Constructors ---------------------------------------------------
   
   
   
+  /// Number of current types (including `any`).
+  static constexpr std::size_t NTypes = static_cast<std::size_t>(any) + 1;
+  
+  /// Names of the current types (see `name()`), indexed by `CurrentType`.
+  static constexpr std::array<std::string_view, NTypes> Names
+    { "charged", "neutral", "any" };
+  
+  /// Short names of the current types (see `shortName()`), indexed by
+  /// `CurrentType`.
+  static constexpr std::array<std::string_view, NTypes> ShortNames
+    { "CC", "NC", "any" };
+  
+  
+  // --- BEGIN -- Access -------------------------------------------------------
+  
+  /// Returns the stored current type.
+  constexpr CurrentType type() const { return fType; }
+  
+  // --- END -- Access ---------------------------------------------------------
+  
+  
   // --- BEGIN -- String operations --------------------------------------------
   /// @name String operations
   /// @{
   
   /// Returns a string with the name of the current (`"charged"`, `"neutral"`,
   /// `"any"`).
-  std::string name() const;
+  std::string name() const { return std::string{ nameView() }; }
   
   /// Returns a string with the short name of the current
   /// (`"CC"`, `"NC"`, `"any"`).
-  std::string shortName() const;
+  std::string shortName() const { return std::string{ shortNameView() }; }
+  
+  /// Returns a view of the name of the current (no allocation involved).
+  /// @see `name()`
+  constexpr std::string_view nameView() const { return nameOf(fType); }
+  
+  /// Returns a view of the short name of the current (no allocation).
+  /// @see `shortName()`
+  constexpr std::string_view shortNameView() const
+    { return shortNameOf(fType); }
   
   /// Converts to the `name()` of the current.
   operator std::string() const { return name(); }
   
+  /// Returns a view of the name of the current `type`.
+  static constexpr std::string_view nameOf(CurrentType type)
+    { return Names[static_cast<std::size_t>(type)]; }
+  
+  /// Returns a view of the short name of the current `type`.
+  static constexpr std::string_view shortNameOf(CurrentType type)
+    { return ShortNames[static_cast<std::size_t>(type)]; }
+  
   /// @}
   // --- END -- String operations ----------------------------------------------
   
@@ -129,16 +170,17 @@ class icarus::WeakCurrentType {
    * Accepted values include the shortened name (`"CC"`; see `shortName()`),
    * and the full name (`"charged"`; see `name()`).
    * Also the empty string is converted to a `CurrentType` of `any`.
+   * No memory allocation is performed unless an exception is thrown.
    */
-  static CurrentType parse(std::string const& spec);
+  static CurrentType parse(std::string_view spec);
   
   
     private:
   
   CurrentType fType = any; ///< Type of current stored.
   
-  /// Returns a upper-case copy of `s`.
-  static std::string to_upper(std::string const& s);
+  /// Returns whether `a` and `b` are equal, irrespective of their case.
+  static bool equal_nocase(std::string_view a, std::string_view b);
   
 }; // class icarus::WeakCurrentType
 
@@ -31,8 +31,14 @@ namespace truth
 {
 
 MCTruthAssociations::MCTruthAssociations(const fhicl::ParameterSet& config)
+    : fParticleList(&fNodePool)
+    , fMCTruthSet(&fNodePool)
+    , fTrackIDToMCTruthIndex(&fNodePool)
 {
     fMinHitEnergyFraction = config.get<float>("MinHitEnergyFraction", 0.);
+    
+    // The eve id calculator is created once, and reset on each event
+    fParticleList.AdoptEveIdCalculator(new MCTruthEmEveIdCalculator);
 }
 
 void MCTruthAssociations::setup(const HitParticleAssociationsVec&  partToHitAssnsVec,
@@ -43,16 +49,17 @@ void MCTruthAssociations::setup(const HitParticleAssociationsVec&  partToHitAssn
     // Keep track of input services
     fGeometry           = &geometry;
     
-    fHitPartAssnsVec.clear();
+    // Keep the containers of the previous event, as many as needed;
+    // their nodes go back to the pool when they are cleared
+    while(fHitPartAssnsVec.size() > partToHitAssnsVec.size()) fHitPartAssnsVec.pop_back();
+    while(fHitPartAssnsVec.size() < partToHitAssnsVec.size()) fHitPartAssnsVec.emplace_back(&fNodePool);
+    
+    auto hitPartAssnsItr = fHitPartAssnsVec.begin();
     
     // Loop through the input vector of associations
     for(const HitParticleAssociations* partToHitAssns : partToHitAssnsVec)
     {
-        // Note that one element of our struct is non copiable which means
-        // we need to construct in place before filling
-        fHitPartAssnsVec.emplace_back();
-    
-        HitPartAssnsStruct& hitPartAssns = fHitPartAssnsVec.back();
+        HitPartAssnsStruct& hitPartAssns = *(hitPartAssnsItr++);
     
         // Clear the maps in case they were previously filled
         hitPartAssns.fHitToPartVecMap.clear();
@@ -75,8 +82,11 @@ void MCTruthAssociations::setup(const HitParticleAssociationsVec&  partToHitAssn
     // Note that there is only one instance of MCTruth <--> MCParticle associations so we do this external to the above loop
     fParticleList.clear();
     fMCTruthVec.clear();
+    fMCTruthSet.clear();
     fTrackIDToMCTruthIndex.clear();
     
+    fTrackIDToMCTruthIndex.reserve(mcPartVec.size());
+    
     for(const auto& mcParticle : mcPartVec)
     {
         fParticleList.Add(mcParticle.get());
@@ -85,8 +95,8 @@ void MCTruthAssociations::setup(const HitParticleAssociationsVec&  partToHitAssn
         {
             art::Ptr<simb::MCTruth> mcTruth = truthToPartAssns.at(mcParticle.key());
             
-            // Add to the list
-            if (std::find(fMCTruthVec.begin(),fMCTruthVec.end(),mcTruth) == fMCTruthVec.end())
+            // Add to the list, if not there yet
+            if (fMCTruthSet.insert(mcTruth).second)
                 fMCTruthVec.push_back(mcTruth);
             
             fTrackIDToMCTruthIndex[mcParticle->TrackId()] = mcTruth;
@@ -98,8 +108,8 @@ void MCTruthAssociations::setup(const HitParticleAssociationsVec&  partToHitAssn
     }
 
     // Follow former backtracker convention of resetting the eve id calculator each event...
-    // Note that the calculator is stored as a unique_ptr (mutable) so memory ok
-    fParticleList.AdoptEveIdCalculator(new MCTruthEmEveIdCalculator);
+    // The calculator is kept, and only forgets the particles of the previous event
+    fParticleList.ResetEveIdCalculator();
 
     return;
 }
@@ -34,7 +34,12 @@ namespace detinfo {
 
 // C/C++ standard libraries
 #include <vector>
+#include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
 #include <memory> // std::unique_ptr<>
+#include <memory_resource>
 
 namespace truth
 {
@@ -57,6 +62,12 @@ struct TrackIDE{
 /**
  * @brief Obtains truth matching by using hit <--> MCParticle associations
  * 
+ * The object is meant to be reused event after event, calling `setup()` on
+ * each. The containers are cleared rather than recreated, and the nodes of
+ * most of them are allocated from a memory pool owned by this object, so that
+ * after the first few events `setup()` reuses the memory of the previous ones.
+ * For the same reason, the object can be neither copied nor moved.
+ * 
  * Configuration
  * --------------
  * 
@@ -66,6 +77,9 @@ class MCTruthAssociations
 public:
   
     MCTruthAssociations(fhicl::ParameterSet const& config);
+    
+    MCTruthAssociations(MCTruthAssociations const&) = delete;
+    MCTruthAssociations& operator=(MCTruthAssociations const&) = delete;
   
     void setup(const HitParticleAssociationsVec&,
                const MCParticleVec&,
@@ -143,15 +157,20 @@ private:
     // Declare the containers for the basic maps
     using HitMatchDataPair  = std::pair<const recob::Hit*,const anab::BackTrackerHitMatchingData*>;
     using PartMatchDataPair = std::pair<const simb::MCParticle*,const anab::BackTrackerHitMatchingData*>;
-    using HitToPartVecMap   = std::map<const recob::Hit*,std::set<PartMatchDataPair>>;
-    using PartToHitVecMap   = std::map<const simb::MCParticle*, std::set<HitMatchDataPair>>;
-    using MCTruthTrackIDMap = std::unordered_map<int, art::Ptr<simb::MCTruth>>;
+    using HitToPartVecMap   = std::pmr::map<const recob::Hit*,std::pmr::set<PartMatchDataPair>>;
+    using PartToHitVecMap   = std::pmr::map<const simb::MCParticle*, std::pmr::set<HitMatchDataPair>>;
+    using MCTruthTrackIDMap = std::pmr::unordered_map<int, art::Ptr<simb::MCTruth>>;
+    using MCTruthSet        = std::pmr::set<art::Ptr<simb::MCTruth>>;
 
     // Must allow for the case of multiple instances of hit <--> MCParticle associations
     // You ask "why do it this way? Can't these all be in a single set of containers?"
     // The answer is no because you want to avoid multiple counting
     struct HitPartAssnsStruct
     {
+        explicit HitPartAssnsStruct(std::pmr::memory_resource* resource)
+            : fHitToPartVecMap(resource), fPartToHitVecMap(resource)
+        {}
+        
         // Declare containers as member variables
         HitToPartVecMap     fHitToPartVecMap;       ///< Mapping from hits to associated MCParticle/data pairs
         PartToHitVecMap     fPartToHitVecMap;       ///< Mapping from MCParticle to associated hit/data pairs
@@ -166,9 +185,12 @@ private:
                   TVector3& start, TVector3& end, TVector3& startmom, TVector3& endmom,
                   unsigned int tpc = 0, unsigned int cstat = 0) const;
     
+    std::pmr::unsynchronized_pool_resource fNodePool;          ///< Memory for the per-event container nodes
+    
     HitPartAssnsList                   fHitPartAssnsVec;       ///< Container for the (multiple) associations
     MCTruthParticleList                fParticleList;          ///< ParticleList to map track ID to
     MCTruthTruthVec                    fMCTruthVec;            ///< all the MCTruths for the event
+    MCTruthSet                         fMCTruthSet;            ///< the MCTruths already in fMCTruthVec
     MCTruthTrackIDMap                  fTrackIDToMCTruthIndex; ///< map of track ids to MCTruthList entry
 
     float                              fMinHitEnergyFraction;  ///< minimum fraction of energy a track id has to
@@ -15,9 +15,10 @@
 
 #include "icarusalg/gallery/MCTruthBase/MCTruthEmEveIdCalculator.h"
 #include "icarusalg/gallery/MCTruthBase/MCTruthParticleList.h"
-#include "icarusalg/gallery/MCTruthBase/MCTruthParticleHistory.h"
+#include "nusimdata/SimulationBase/MCParticle.h"
 
-#include <TString.h>
+#include <algorithm>
+#include <limits>
 
 namespace truth {
 
@@ -28,52 +29,131 @@ namespace truth {
   // was not produced by a "trivial" e-m process.
   int MCTruthEmEveIdCalculator::DoCalculateEveId( const int trackID )
   {
-    // Almost any eve ID calculation will use this: Get the entire
-    // history of the particle and its ancestors in the simulated
-    // event. (m_particleList is defined in EveIdCalculator.h)
-    const MCTruthParticleHistory particleHistory( m_particleList, trackID );
-
-    // You can treat particleHistory like an array, and do something
-    // like:
-
-    // for ( int i = particleHistory.size(); i >= 0; --i ) 
-    // { const simb::MCParticle* particle = particleHistory[i]; ... }
-
-    // But we know how to use the Standard Template Library (Yes, you
-    // do! Don't doubt yourself!) so let's treat particleHistory in
-    // the most efficient manner, as an STL container. We want to scan
-    // the container from its last element to its first, from the base
-    // of the particle production chain towards the primary particle.
-
-    for(auto i = particleHistory.rbegin(); i != particleHistory.rend(); ++i){
-      // Get the text string that describes the process that created
-      // the particle.
-      std::string process = (*i)->Process();
-
-      // Skip it if it was created by pair production, compton
-      // scattering, photoelectric effect, bremstrahlung,
-      // annihilation, or any ionization. (The ultimate source of
-      // the process names are the physics lists used in Geant4.)
-      
-      if ( process.find("conv")              != std::string::npos ||
-	   process.find("LowEnConversion")   != std::string::npos ||
-	   process.find("Pair")              != std::string::npos ||
-	   process.find("compt")             != std::string::npos ||
-	   process.find("Compt")             != std::string::npos ||
-	   process.find("Brem")              != std::string::npos ||
-	   process.find("phot")              != std::string::npos ||
-	   process.find("Photo")             != std::string::npos ||
-	   process.find("Ion")               != std::string::npos ||
-	   process.find("annihil")           != std::string::npos) continue;         
-
-      // If we get here, the particle wasn't created by any of the
-      // above processes. Return its ID.
-      return (*i)->TrackId();
+    // The eve IDs of all the particles in the list are computed at
+    // the first request (and again if particles were added since),
+    // and then just looked up.
+    if ( !m_eveIDsReady || m_trackIDs.size() != m_particleList->size() )
+      BuildEveIDs();
+
+    auto const search
+      = std::lower_bound( m_trackIDs.begin(), m_trackIDs.end(), trackID );
+
+    // If the track ID is not in the list, there is no chain at all.
+    if ( search == m_trackIDs.end() || *search != trackID ) return 0;
+
+    return m_eveIDs[ search - m_trackIDs.begin() ];
+  }
+
+  //----------------------------------------------------------------------------
+  void MCTruthEmEveIdCalculator::DoInit()
+  {
+    // The process codes do not depend on the list and are kept.
+    m_trackIDs.clear();
+    m_eveIDs.clear();
+    m_eveIDsReady = false;
+  }
+
+  //----------------------------------------------------------------------------
+  bool MCTruthEmEveIdCalculator::IsTrivialEmProcess( const std::string& process )
+  {
+    // Pair production, compton scattering, photoelectric effect,
+    // bremstrahlung, annihilation, or any ionization. (The ultimate
+    // source of the process names are the physics lists used in Geant4.)
+    return process.find("conv")              != std::string::npos ||
+           process.find("LowEnConversion")   != std::string::npos ||
+           process.find("Pair")              != std::string::npos ||
+           process.find("compt")             != std::string::npos ||
+           process.find("Compt")             != std::string::npos ||
+           process.find("Brem")              != std::string::npos ||
+           process.find("phot")              != std::string::npos ||
+           process.find("Photo")             != std::string::npos ||
+           process.find("Ion")               != std::string::npos ||
+           process.find("annihil")           != std::string::npos;
+  }
+
+  //----------------------------------------------------------------------------
+  MCTruthEmEveIdCalculator::ProcessCode_t MCTruthEmEveIdCalculator::ProcessCode
+    ( const std::string& process )
+  {
+    auto const search = m_processCodes.find( process );
+    if ( search != m_processCodes.end() ) return search->second;
+
+    // A new process: the substring searches happen only here.
+    ProcessCode_t const code = m_trivialProcess.size();
+    m_trivialProcess.push_back( IsTrivialEmProcess( process ) );
+    m_processCodes.emplace( process, code );
+    return code;
+  }
+
+  //----------------------------------------------------------------------------
+  void MCTruthEmEveIdCalculator::BuildEveIDs()
+  {
+    constexpr std::size_t NoMother = std::numeric_limits<std::size_t>::max();
+
+    m_trackIDs.clear();
+    m_eveIDs.clear();
+
+    // First pass: the track ID of all the particles (the list is sorted
+    // by track ID), and whether they were created by a trivial process.
+    // Archived particles have no information, and they end the chain.
+    std::size_t const nParticles = m_particleList->size();
+    m_trackIDs.reserve( nParticles );
+    // The work vectors are members, so that their memory is reused.
+    std::vector<bool>& trivial = m_trivial;
+    trivial.clear();
+    trivial.reserve( nParticles );
+    for ( auto const& [ trackID, particle ]: *m_particleList ) {
+      m_trackIDs.push_back( trackID );
+      trivial.push_back
+        ( !particle || m_trivialProcess[ ProcessCode( particle->Process() ) ] );
+    }
+
+    // Second pass: the position of the mother of each particle created by a
+    // trivial process; the chain stops at primary particles, and at mothers
+    // which are not in the list.
+    std::vector<std::size_t>& mother = m_mothers;
+    mother.assign( nParticles, NoMother );
+    std::size_t iParticle = 0;
+    for ( auto const& [ trackID, particle ]: *m_particleList ) {
+      std::size_t const i = iParticle++;
+      if ( !trivial[i] || !particle ) continue;
+      if ( m_particleList->IsPrimary( trackID ) ) continue;
+      auto const search = std::lower_bound
+        ( m_trackIDs.begin(), m_trackIDs.end(), particle->Mother() );
+      if ( search == m_trackIDs.end() || *search != particle->Mother() ) continue;
+      mother[i] = search - m_trackIDs.begin();
+    }
+
+    // Third pass: going up from each particle, stop at the first particle
+    // with a known eve ID or not created by a trivial process, and assign
+    // that eve ID to all the particles met on the way. Each particle is
+    // assigned only once.
+    enum : char { Unknown, InChain, Known };
+    std::vector<char>& state = m_states;
+    state.assign( nParticles, Unknown );
+    m_eveIDs.assign( nParticles, 0 );
+    std::vector<std::size_t>& chain = m_chain;
+    chain.clear();
+    for ( std::size_t i = 0; i < nParticles; ++i ) {
+      int eveID = 0;
+      std::size_t j = i;
+      while ( true ) {
+        if ( state[j] == Known ) { eveID = m_eveIDs[j]; break; }
+        if ( state[j] == InChain ) break; // a loop in the ancestry: give up
+        if ( !trivial[j] ) { eveID = m_trackIDs[j]; chain.push_back( j ); break; }
+        chain.push_back( j );
+        state[j] = InChain;
+        if ( mother[j] == NoMother ) break; // all the chain was skipped
+        j = mother[j];
+      }
+      for ( std::size_t k: chain ) {
+        m_eveIDs[k] = eveID;
+        state[k] = Known;
+      }
+      chain.clear();
     }
 
-    // If we get here, we've skipped every particle in the
-    // chain. Perhaps it was empty.
-    return 0;
+    m_eveIDsReady = true;
   }
 
 } // namespace sim
@@ -63,6 +63,11 @@
 
 #include "icarusalg/gallery/MCTruthBase/MCTruthEveIdCalculator.h"
 
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstddef> // std::size_t
+
 ///Monte Carlo Simulation
 namespace truth {
 
@@ -75,9 +80,51 @@ namespace truth {
     {}
     virtual ~MCTruthEmEveIdCalculator() {}
 
+    /// Returns whether the named process is a "trivial" e-m process.
+    static bool IsTrivialEmProcess( const std::string& process );
+
   private:
-    // This is the method that does the actual eve ID calculation.
+    typedef unsigned int ProcessCode_t; ///< Type of interned process code.
+
+    /// This is the method that does the actual eve ID calculation.
+    ///
+    /// It does not walk the chain of each particle on request. On the
+    /// first query for a ParticleList, the process name of each particle
+    /// is converted ("interned") into a small integer code, and whether
+    /// each code is a "trivial" e-m process is decided once. Then the eve
+    /// IDs of all the particles are computed in a single pass, each
+    /// particle reusing the eve ID of its mother.
     virtual int DoCalculateEveId( const int trackID );
+
+    /// Forgets the eve IDs of the previous ParticleList.
+    virtual void DoInit();
+
+    /// Returns the code of the named process, interning it if new.
+    ProcessCode_t ProcessCode( const std::string& process );
+
+    /// Computes the eve IDs of all the particles in the list.
+    void BuildEveIDs();
+
+    /// Codes of the process names seen so far.
+    std::unordered_map<std::string, ProcessCode_t> m_processCodes;
+
+    /// Whether each process code is a trivial e-m process.
+    std::vector<bool> m_trivialProcess;
+
+    /// Track IDs of all the particles in the list, sorted.
+    std::vector<int> m_trackIDs;
+
+    /// Eve ID of each particle in `m_trackIDs`.
+    std::vector<int> m_eveIDs;
+
+    /// Whether `m_trackIDs` and `m_eveIDs` describe the current list.
+    bool m_eveIDsReady = false;
+
+    // Work space of BuildEveIDs(), kept to reuse its memory.
+    std::vector<bool> m_trivial;          ///< Particle from trivial process.
+    std::vector<std::size_t> m_mothers;   ///< Position of the mother.
+    std::vector<char> m_states;           ///< Eve ID resolution state.
+    std::vector<std::size_t> m_chain;     ///< Particles being resolved.
   };
 
 } // namespace sim
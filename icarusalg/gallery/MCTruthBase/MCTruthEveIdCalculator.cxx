@@ -43,6 +43,9 @@ namespace truth {
 
     // Reset the results of previous calculations.
     m_previousList.clear();
+
+    // Let the derived calculators reset their own data.
+    DoInit();
   }
 
   //----------------------------------------------------------------------------
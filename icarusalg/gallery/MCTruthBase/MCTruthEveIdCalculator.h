@@ -121,6 +121,11 @@ namespace truth {
     /// method that must be implemented.
     virtual int DoCalculateEveId( const int trackID );
 
+    /// Hook called by Init() after the new ParticleList has been
+    /// recorded. Calculators which keep their own per-list data
+    /// should reset them here. The default does nothing.
+    virtual void DoInit() {}
+
     const MCTruthParticleList* m_particleList; ///> The ParticleList associated with the eve ID calculation.
 
   private:
@@ -26,10 +26,26 @@
 #include <TLorentzVector.h>
 
 #include <set>
+#include <utility> // std::move()
 // #include <iterator>
 //#include <cmath>
 // #include <memory>
 
+namespace {
+  
+  // Swaps the content of two containers, which may use different memory
+  // resources (in which case the elements are moved between them).
+  template <typename Cont>
+  void swapContent( Cont& a, Cont& b )
+  {
+    if ( a.get_allocator() == b.get_allocator() ) { a.swap( b ); return; }
+    Cont tmp( std::move( a ), a.get_allocator() );
+    a = std::move( b );
+    b = std::move( tmp );
+  }
+  
+} // local namespace
+
 namespace truth {
 
 //----------------------------------------------------------------------------
@@ -38,6 +54,14 @@ MCTruthParticleList::MCTruthParticleList()
 {
 }
 
+//----------------------------------------------------------------------------
+// Constructor with the memory resource for the primaries and the archive.
+MCTruthParticleList::MCTruthParticleList( std::pmr::memory_resource* resource )
+    : m_primaries( resource )
+    , m_archive( resource )
+{
+}
+
 //----------------------------------------------------------------------------
 // Destructor
 MCTruthParticleList::~MCTruthParticleList()
@@ -307,6 +331,14 @@ int MCTruthParticleList::GetMotherOf( const key_type& key ) const
      return part? part->Mother(): m_archive.at(key).Mother();
 } // MCTruthParticleList::GetMotherOf()
   
+//----------------------------------------------------------------------------
+void MCTruthParticleList::swap( MCTruthParticleList& other )
+{
+    m_MCTruthParticleList.swap( other.m_MCTruthParticleList );
+    swapContent( m_archive, other.m_archive );
+    swapContent( m_primaries, other.m_primaries );
+}
+  
 //----------------------------------------------------------------------------
 void MCTruthParticleList::clear()
 {
@@ -400,6 +432,13 @@ void MCTruthParticleList::AdoptEveIdCalculator( MCTruthEveIdCalculator* calc ) c
     m_eveIdCalculator.reset(calc);
 }
 
+//----------------------------------------------------------------------------
+// Reinitialize the current eve ID calculator for this list.
+void MCTruthParticleList::ResetEveIdCalculator() const
+{
+    if ( m_eveIdCalculator ) m_eveIdCalculator->Init( this );
+}
+
 //----------------------------------------------------------------------------
 std::ostream& operator<<
     ( std::ostream& output, const MCTruthParticleList::archived_info_type& info )
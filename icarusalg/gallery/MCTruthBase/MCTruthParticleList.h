@@ -109,6 +109,14 @@
 ///
 /// - Print() and operator<< methods for ROOT display and ease of
 ///   debugging.
+///
+/// - The nodes of the internal containers of primaries and archived
+///   particles can be allocated from a memory resource supplied on
+///   construction. A pool resource which outlives the list lets a list which
+///   is cleared and refilled every event reuse the memory of the previous
+///   events instead of going back to the heap. The particle list itself
+///   (`list_type`) keeps the standard allocator, as part of the public
+///   interface.
 
 #ifndef SIM_MCTruthParticleList_H
 #define SIM_MCTruthParticleList_H
@@ -116,8 +124,10 @@
 #include "nusimdata/SimulationBase/MCParticle.h"
 
 #include <memory>
+#include <memory_resource>
 #include <ostream>
 #include <map>
+#include <set>
 #include <cstdlib> // std::abs()
 
 namespace truth {
@@ -146,6 +156,9 @@ public:
 
     // Standard constructor, let compiler default the detector
     MCTruthParticleList();
+    
+    /// Constructor: allocates the primary and archive nodes from `resource`.
+    explicit MCTruthParticleList( std::pmr::memory_resource* resource );
     virtual ~MCTruthParticleList();
 
 private:
@@ -169,8 +182,8 @@ private:
     }; // archived_info_type
     
     
-    typedef std::set< int >                   primaries_type;
-    typedef std::map<int, archived_info_type> archive_type;
+    typedef std::pmr::set< int >                   primaries_type;
+    typedef std::pmr::map<int, archived_info_type> archive_type;
     typedef primaries_type::iterator          primaries_iterator;
     typedef primaries_type::const_iterator    primaries_const_iterator;
 
@@ -305,6 +318,9 @@ public:
     // begins with "Adopt" because it accepts control of the ponters;
     // do NOT delete the pointer yourself if you use this method.
     void AdoptEveIdCalculator( MCTruthEveIdCalculator* ) const;
+    // Makes the current eve ID calculator forget its previous results.
+    // Call this after refilling the list to keep the same calculator.
+    void ResetEveIdCalculator() const;
 
 #endif
   };
@@ -323,8 +339,6 @@ inline    truth::MCTruthParticleList::const_reverse_iterator truth::MCTruthParti
 inline    truth::MCTruthParticleList::size_type              truth::MCTruthParticleList::size()   const { return m_MCTruthParticleList.size();   }
 inline    bool truth::MCTruthParticleList::empty()                                       const { return m_MCTruthParticleList.empty();  }
 inline    void truth::MCTruthParticleList::Add(const simb::MCParticle* value)                  { insert(value);                  }
-inline    void truth::MCTruthParticleList::swap( truth::MCTruthParticleList& other )                         
-{ m_MCTruthParticleList.swap( other.m_MCTruthParticleList ); m_archive.swap( other.m_archive ); m_primaries.swap( other.m_primaries); }
 inline    truth::MCTruthParticleList::iterator       truth::MCTruthParticleList::find(const truth::MCTruthParticleList::key_type& key)              
 { return m_MCTruthParticleList.find(abs(key));        }
 inline    truth::MCTruthParticleList::const_iterator truth::MCTruthParticleList::find(const truth::MCTruthParticleList::key_type& key)        const 
@@ -13,6 +13,7 @@
 
 // SBN code
 #include "icarusalg/Utilities/ROOTutils.h" // util::ROOT::TDirectoryChanger
+#include "icarusalg/Utilities/ROOTasyncWriter.h"
 #include "icarusalg/gallery/helpers/C++/expandInputFiles.h"
 
 // LArSoft
@@ -48,11 +49,10 @@
 #include "TCanvas.h"
 #include "TFile.h"
 #include "TDirectory.h"
-#include "TDirectoryFile.h"
 #include "TH1.h"
 #include "TGraph.h"
 #include "TLine.h"
-#include "TROOT.h" // gROOT
+#include "TROOT.h" // gROOT, ROOT::EnableThreadSafety()
 
 // C/C++ standard libraries
 #include <string>
@@ -65,6 +65,8 @@
 #include <limits>
 #include <type_traits> // std::void_t
 #include <cmath> // std::round()
+#include <algorithm> // std::minmax_element(), std::min(), std::max()
+#include <cassert>
 
 
 #if !defined(__CLING__)
@@ -351,6 +353,9 @@ class DrawPMTwaveforms {
     
     nanoseconds tickDuration;
     
+    /// Largest number of points in a waveform graph (`0`: no limit).
+    unsigned int maxPlotPoints = 0U;
+    
   }; // AlgorithmConfiguration
   
   
@@ -366,6 +371,9 @@ class DrawPMTwaveforms {
   // ----- BEGIN -- Setup ------------------------------------------------------
   TDirectory* fDestDir = nullptr; ///< ROOT directory where to write the plots.
   
+  /// Background writer of the plots (if any, it replaces `fDestDir`).
+  util::ROOT::AsyncObjectWriter* fWriter = nullptr;
+  
   // ----- END -- Setup --------------------------------------------------------
 
   
@@ -488,6 +496,16 @@ class DrawPMTwaveforms {
       2_ns
       };
     
+    fhicl::Atom<unsigned int> MaxPlotPoints {
+      Name{ "MaxPlotPoints" },
+      Comment{
+        "longer waveforms are plotted with only the minimum and maximum sample"
+        " of each group of samples, with at most this many points"
+        " (at least 2) [0: no limit]"
+        },
+      0U // default
+      };
+    
   }; // FHiCLconfig
   
   using Parameters = fhicl::Table<FHiCLconfig>;
@@ -504,10 +522,13 @@ class DrawPMTwaveforms {
   /**
    * @brief Sets the algorithm up.
    * @param pDestDir ROOT output directory for the plots
-   * @param clocksData detector clocks information (event-independent)
-   * @param propsData detector properties information (event-independent)
+   * @param writer (optional) background writer to hand the plots over to
+   * 
+   * If a `writer` is specified, all the plots are written through it, in the
+   * top directory of its file, and `pDestDir` is not used.
    */
-  void setup(TDirectory* pDestDir);
+  void setup
+    (TDirectory* pDestDir, util::ROOT::AsyncObjectWriter* writer = nullptr);
   
   /// Performs the initialization of the algorithm.
   void prepare();
@@ -557,6 +578,13 @@ class DrawPMTwaveforms {
   
   using Cluster_t = std::vector<WaveformInfo_t>;
   
+  /// The plots of a cluster, and the name of the directory they belong to.
+  struct ClusterPlots_t {
+    std::string dirName; ///< Name of the directory for the plots.
+    std::string dirTitle; ///< Title of the directory for the plots.
+    std::vector<std::unique_ptr<TCanvas>> canvases; ///< The plots.
+  }; // ClusterPlots_t
+  
   // --- BEGIN -- Configuration ------------------------------------------------
   
   AlgorithmConfiguration parseValidatedAlgorithmConfiguration
@@ -605,7 +633,13 @@ class DrawPMTwaveforms {
   
   // --- END ---- Analysis -----------------------------------------------------
 
-  /// Produces a graph with the full content of the waveform.
+  /**
+   * @brief Produces a graph with the content of the waveform.
+   * 
+   * If the waveform is longer than the configured maximum number of points,
+   * the samples are split in groups and only the lowest and highest sample of
+   * each group are included in the graph, in their original order.
+   */
   std::unique_ptr<TGraph> drawWaveform
     (WaveformInfo_t const& wf, art::EventID const& id) const;
   
@@ -615,9 +649,9 @@ class DrawPMTwaveforms {
   /// Returns the representative time of the cluster.
   optical_time clusterTime(Cluster_t const& waveforms) const;
   
-  std::unique_ptr<TDirectory> plotWaveformCluster(
-    Cluster_t const& cluster, art::EventID const& id, TDirectory& eventOutputDir
-    ) const;
+  /// Plots all the waveforms of the cluster, in groups.
+  ClusterPlots_t plotWaveformCluster
+    (Cluster_t const& cluster, art::EventID const& id) const;
   
   /// Prints the average baselines of an event on screen.
   void printBaselines(BaselineEstimates_t const& baselines) const;
@@ -627,10 +661,8 @@ class DrawPMTwaveforms {
   std::vector<Cluster_t> groupWaveformCluster(Cluster_t const& waveforms) const;
 
   /// Plots the full group of waveforms in a single canvas.
-  std::unique_ptr<TCanvas> plotWaveformGroup(
-    Cluster_t const& group, art::EventID const& id, optical_time time,
-    TDirectory& clusterOutputDir
-    ) const;
+  std::unique_ptr<TCanvas> plotWaveformGroup
+    (Cluster_t const& group, art::EventID const& id, optical_time time) const;
 
   /// Returns the lowest and highest channel number among the `waveforms`.
   static std::pair<raw::Channel_t, raw::Channel_t> channelRange
@@ -704,6 +736,14 @@ auto DrawPMTwaveforms::parseValidatedAlgorithmConfiguration
   algConfig.sharedADCrange = config.SharedADCrange();
   
   algConfig.tickDuration = config.TickDuration();
+  algConfig.maxPlotPoints = config.MaxPlotPoints();
+  if (algConfig.maxPlotPoints == 1U) {
+    // each group of samples needs two points (minimum and maximum)
+    throw std::runtime_error{
+      "MaxPlotPoints must be either 0 (no limit) or at least 2 (got "
+      + std::to_string(algConfig.maxPlotPoints) + ")."
+      };
+  }
   return algConfig;
 } // DrawPMTwaveforms::parseValidatedAlgorithmConfiguration()
 
@@ -719,9 +759,12 @@ void DrawPMTwaveforms::printConfigurationHelp(std::ostream& out) {
 } // DrawPMTwaveforms::printConfigurationHelp()
 
 
-void DrawPMTwaveforms::setup(TDirectory* pDestDir) {
+void DrawPMTwaveforms::setup
+  (TDirectory* pDestDir, util::ROOT::AsyncObjectWriter* writer /* = nullptr */)
+{
   
   fDestDir = pDestDir;
+  fWriter = writer;
   
 } // DrawPMTwaveforms::setup()
 
@@ -839,19 +882,42 @@ void DrawPMTwaveforms::analyze(Event const& event, art::EventID const& id) {
   //
   // draw each cluster
   //
-  TDirectory* eventOutputDir = fDestDir->mkdir(
-    ("R" + std::to_string(id.run()) + "E" + std::to_string(id.event())).c_str(),
-    ("Run " + std::to_string(id.run()) + " event " + std::to_string(id.event()))
-      .c_str()
-    );
+  std::string const eventDirName
+    = "R" + std::to_string(id.run()) + "E" + std::to_string(id.event());
+  std::string const eventDirTitle
+    = "Run " + std::to_string(id.run()) + " event " + std::to_string(id.event());
+  
+  if (fWriter) {
+    // the writer thread owns the output file: just hand the plots over
+    fWriter->makeDirectory(eventDirName, eventDirTitle);
+    for (Cluster_t const& cluster: waveformClusters) {
+      
+      ClusterPlots_t plots = plotWaveformCluster(cluster, id);
+      
+      std::string const dirPath = eventDirName + "/" + plots.dirName;
+      for (std::unique_ptr<TCanvas>& canvas: plots.canvases) {
+        // the canvas will be deleted in the writer thread: forget about it
+        if (gPad && (gPad->GetCanvas() == canvas.get())) gPad = nullptr;
+        fWriter->write(std::move(canvas), dirPath, plots.dirTitle);
+      }
+      
+    } // for clusters
+    fWriter->closeDirectory(eventDirName);
+    return;
+  } // if writer
+  
+  TDirectory* eventOutputDir
+    = fDestDir->mkdir(eventDirName.c_str(), eventDirTitle.c_str());
   
   for (Cluster_t const& cluster: waveformClusters) {
     
-    std::unique_ptr<TDirectory> plots
-      = plotWaveformCluster(cluster, id, *eventOutputDir);
+    ClusterPlots_t const plots = plotWaveformCluster(cluster, id);
     
-    util::ROOT::TDirectoryChanger dg { eventOutputDir };
-    plots->Write();
+    TDirectory* clusterOutputDir = eventOutputDir->mkdir
+      (plots.dirName.c_str(), plots.dirTitle.c_str());
+    util::ROOT::TDirectoryChanger dg { clusterOutputDir };
+    for (std::unique_ptr<TCanvas> const& canvas: plots.canvases)
+      canvas->Write();
     
   } // for clusters
   
@@ -913,23 +979,18 @@ auto DrawPMTwaveforms::clusterTime
 } // DrawPMTwaveforms::clusterTime()
 
 
-std::unique_ptr<TDirectory> DrawPMTwaveforms::plotWaveformCluster
-  (Cluster_t const& cluster, art::EventID const& id, TDirectory& eventOutputDir)
-  const
+auto DrawPMTwaveforms::plotWaveformCluster
+  (Cluster_t const& cluster, art::EventID const& id) const -> ClusterPlots_t
 {
   
   optical_time const time = clusterTime(cluster);
   using std::to_string;
-  auto outDir = std::make_unique<TDirectoryFile>(
-    ("R" + to_string(id.run()) + "E" + to_string(id.event())
-      + "TS" + to_string
-        (static_cast<int>(std::round(time.convertInto<microsecond>().value())))
-    ).c_str(),
-    ("Run " + to_string(id.run()) + " event " + to_string(id.event())
-      + " cluster at time " + to_string(time.convertInto<microsecond>())
-    ).c_str(),
-    "TDirectoryFile", &eventOutputDir
-    );
+  ClusterPlots_t plots;
+  plots.dirName = "R" + to_string(id.run()) + "E" + to_string(id.event())
+    + "TS" + to_string
+      (static_cast<int>(std::round(time.convertInto<microsecond>().value())));
+  plots.dirTitle = "Run " + to_string(id.run()) + " event " + to_string(id.event())
+    + " cluster at time " + to_string(time.convertInto<microsecond>());
   
   std::vector<Cluster_t> groups = groupWaveformCluster(cluster);
   
@@ -940,21 +1001,19 @@ std::unique_ptr<TDirectory> DrawPMTwaveforms::plotWaveformCluster
   for (Cluster_t const& group: groups) {
     if (group.empty()) continue;
     
-    std::unique_ptr<TCanvas> canvas
-      = plotWaveformGroup(group, id, time, *outDir);
+    std::unique_ptr<TCanvas> canvas = plotWaveformGroup(group, id, time);
     if (!canvas) continue;
     
     auto const [ firstChannel, lastChannel ] = channelRange(group);
     log << "  " << firstChannel;
     if (lastChannel != firstChannel) log << "-" << lastChannel;
     
-    util::ROOT::TDirectoryChanger dg { outDir.get() };
-    canvas->Write();
+    plots.canvases.push_back(std::move(canvas));
     gPad = nullptr; // just in case
     
   } // for groups
   
-  return outDir;
+  return plots;
 } // DrawPMTwaveforms::plotWaveformCluster()
 
 
@@ -987,10 +1046,8 @@ auto DrawPMTwaveforms::groupWaveformCluster(Cluster_t const& waveforms) const
 } // DrawPMTwaveforms::groupWaveformCluster()
 
 
-std::unique_ptr<TCanvas> DrawPMTwaveforms::plotWaveformGroup(
-  Cluster_t const& group, art::EventID const& id, optical_time time,
-  TDirectory& clusterOutputDir
-  ) const
+std::unique_ptr<TCanvas> DrawPMTwaveforms::plotWaveformGroup
+  (Cluster_t const& group, art::EventID const& id, optical_time time) const
 {
   /*
    * index of the pad:
@@ -1060,7 +1117,6 @@ std::unique_ptr<TCanvas> DrawPMTwaveforms::plotWaveformGroup(
     = [](optical_time t){ return t.convertInto<microsecond>().value(); };
   
   using std::to_string;
-  util::ROOT::TDirectoryChanger dg { &clusterOutputDir };
   auto canvas = std::make_unique<TCanvas>(
     ("R" + to_string(id.run()) + "E" + to_string(id.event())
       + "TS" + to_string(static_cast<int>(std::round(opticalToUS(time))))
@@ -1094,11 +1150,13 @@ std::unique_ptr<TCanvas> DrawPMTwaveforms::plotWaveformGroup(
       0.05, 0.00  // bottom, top
       ); // reduced margins
     
-    // clone the graph, let TCanvas manage that one
-    TGraph* clone = static_cast<TGraph*>(graph->DrawClone("AL"));
-    graphs[subpad - 1] = clone;
-    clone->SetLineWidth(2);
-    clone->SetLineColor(kBlue - 7); // tradition demands waveforms to be blue
+    // hand the graph over to the pad, which will delete it
+    TGraph* const padGraph = graph.release();
+    padGraph->SetBit(kCanDelete);
+    padGraph->SetLineWidth(2);
+    padGraph->SetLineColor(kBlue - 7); // tradition demands waveforms to be blue
+    padGraph->Draw("AL");
+    graphs[subpad - 1] = padGraph;
     
     pad->SetGrid();
     pad->SetTicks();
@@ -1116,8 +1174,8 @@ std::unique_ptr<TCanvas> DrawPMTwaveforms::plotWaveformGroup(
     }
     
     // extend to include the added "level" lines in the range, if present
-    if (clone->GetYaxis()) {
-      clone->GetYaxis()->SetRangeUser(localRange.min(), localRange.max());
+    if (padGraph->GetYaxis()) {
+      padGraph->GetYaxis()->SetRangeUser(localRange.min(), localRange.max());
       pad->Update();
     }
     
@@ -1264,6 +1322,8 @@ void DrawPMTwaveforms::printBaselines(BaselineEstimates_t const& baselines) cons
 
 void DrawPMTwaveforms::finish() {
   
+  if (fWriter) fWriter->finish(); // all the plots are in the file after this
+  
   if (fConfig.baseline.doPrint) printBaselines(fBestBaselineEstimates);
   
 } // DrawPMTwaveforms::finish()
@@ -1291,6 +1351,10 @@ void DrawPMTwaveforms::printConfig(Stream&& out) const {
   }
   if (fConfig.baseline.subtract)
     out << "\n * subtract baseline in each plot";
+  if (fConfig.maxPlotPoints > 0) {
+    out << "\n * waveforms decimated to at most " << fConfig.maxPlotPoints
+      << " points (minimum and maximum of each group of samples)";
+  }
   
   out << "\n";
 } // DrawPMTwaveforms::printConfig()
@@ -1350,7 +1414,21 @@ std::unique_ptr<TGraph> DrawPMTwaveforms::drawWaveform
   (WaveformInfo_t const& wf, art::EventID const& id) const
 {
   optical_time const startTime { microsecond{ wf->TimeStamp() } };
-  auto shape = std::make_unique<TGraph>(wf->size());
+  
+  //
+  // the samples are grouped in "columns" yielding two points each
+  // (lowest and highest sample; just one if they are the same sample)
+  // if there are more than the allowed points
+  //
+  std::size_t const nSamples = wf->size();
+  std::size_t const maxColumns = fConfig.maxPlotPoints / 2U;
+  std::size_t const columnSize
+    = ((maxColumns > 0U) && (nSamples > fConfig.maxPlotPoints))
+    ? (nSamples + maxColumns - 1U) / maxColumns: 1U;
+  std::size_t const nPoints = (columnSize == 1U)
+    ? nSamples: 2U * ((nSamples + columnSize - 1U) / columnSize);
+  
+  auto shape = std::make_unique<TGraph>(static_cast<Int_t>(nPoints));
   using std::to_string;
   shape->SetNameTitle(
     ("WaveformR" + to_string(id.run()) + "E" + to_string(id.event())
@@ -1365,10 +1443,44 @@ std::unique_ptr<TGraph> DrawPMTwaveforms::drawWaveform
     ).c_str()
     );
   
-  for (auto [ iSample, sample ]: util::enumerate(*(wf.waveform))) {
-    optical_time const time = startTime + iSample * fConfig.tickDuration;
-    shape->SetPoint(iSample, time.value(), sample - wf.baseline);
+  //
+  // fill the point arrays of the graph directly, in a single pass
+  //
+  raw::ADC_Count_t const* const samples = wf->data();
+  double const baseline = wf.baseline;
+  double const t0 = startTime.value();
+  double const dt = (startTime + fConfig.tickDuration).value() - t0;
+  double* const x = shape->GetX();
+  double* const y = shape->GetY();
+  
+  if (columnSize == 1U) {
+    for (std::size_t iSample = 0; iSample < nSamples; ++iSample) {
+      x[iSample] = t0 + iSample * dt;
+      y[iSample] = samples[iSample] - baseline;
+    }
   }
+  else {
+    std::size_t iPoint = 0;
+    for (std::size_t first = 0; first < nSamples; first += columnSize) {
+      raw::ADC_Count_t const* const begin = samples + first;
+      raw::ADC_Count_t const* const end
+        = samples + std::min(first + columnSize, nSamples);
+      auto const [ iMin, iMax ] = std::minmax_element(begin, end);
+      // the two points are added in time order, a single one if they match
+      raw::ADC_Count_t const* const extremes[2]
+        = { std::min(iMin, iMax), std::max(iMin, iMax) };
+      std::size_t const nExtremes = (iMin == iMax)? 1U: 2U;
+      for (std::size_t iExtreme = 0; iExtreme < nExtremes; ++iExtreme) {
+        raw::ADC_Count_t const* const it = extremes[iExtreme];
+        x[iPoint] = t0 + (it - samples) * dt;
+        y[iPoint] = *it - baseline;
+        ++iPoint;
+      }
+    } // for columns
+    assert(iPoint <= nPoints);
+    shape->Set(static_cast<Int_t>(iPoint)); // drop the unused points
+  }
+  
   MF_LOG_TRACE("test") << "Waveform for channel " << wf->ChannelNumber()
     << " plotted: '" << shape->GetName()
     << "' (\"" << shape->GetTitle() << "\")";
@@ -1430,6 +1542,17 @@ int runAnalysis
   /*
    * preparation of histogram output file
    */
+  unsigned int const writerQueueSize
+    = analysisConfig.get("asyncOutputQueueSize", 0U);
+  bool const asyncOutput
+    = (writerQueueSize > 0) && analysisConfig.has_key("histogramFile");
+  if (asyncOutput) {
+    // plots are created here and deleted by the writer thread:
+    // ROOT must be thread safe before any object is created, and no graphics
+    ::ROOT::EnableThreadSafety();
+    gROOT->SetBatch(kTRUE);
+  }
+  
   std::unique_ptr<TFile> pHistFile;
   if (analysisConfig.has_key("histogramFile")) {
     std::string fileName = analysisConfig.get<std::string>("histogramFile");
@@ -1437,6 +1560,24 @@ int runAnalysis
       << "Creating output file: '" << fileName << "'" << std::endl;
     pHistFile = std::make_unique<TFile>(fileName.c_str(), "RECREATE");
   }
+  
+  // plots are written by a background thread if a queue size is specified
+  std::unique_ptr<util::ROOT::AsyncObjectWriter> pWriter;
+  if (asyncOutput) {
+    util::ROOT::AsyncObjectWriter::Config_t writerConfig;
+    writerConfig.maxQueueSize = writerQueueSize;
+    if (analysisConfig.has_key("compressionLevel")) {
+      writerConfig.compressionLevel
+        = analysisConfig.get<int>("compressionLevel");
+    }
+    mf::LogVerbatim("runAnalysis")
+      << "Plots written in background (queue of " << writerQueueSize << ")";
+    pWriter = std::make_unique<util::ROOT::AsyncObjectWriter>
+      (*pHistFile, std::move(writerConfig));
+  }
+  else if (pHistFile && analysisConfig.has_key("compressionLevel")) {
+    pHistFile->SetCompressionLevel(analysisConfig.get<int>("compressionLevel"));
+  }
 
   /*
    * preparation of the algorithm class
@@ -1450,7 +1591,7 @@ int runAnalysis
   
   plotAlg.printConfig(mf::LogVerbatim{"runAnalysis"});
   
-  plotAlg.setup(pHistFile.get());
+  plotAlg.setup(pHistFile.get(), pWriter.get());
   
   plotAlg.prepare();
   
@@ -342,7 +342,7 @@ void HitAnalysisAlg::fillHistograms(const HitVec& hitVec) const
 }
     
 // Useful for normalizing histograms
-void HitAnalysisAlg::endJob(int numEvents)
+void HitAnalysisAlg::endJob(unsigned long long numEvents)
 {
     // Normalize wire profiles to be hits/event
     double normFactor(1./numEvents);
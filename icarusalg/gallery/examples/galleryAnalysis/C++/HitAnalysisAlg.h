@@ -48,7 +48,7 @@ public:
     // provide for initialization
     void reconfigure(fhicl::ParameterSet const & pset);
     void setup(const geo::GeometryCore&, TDirectory*);
-    void endJob(int numEvents);
+    void endJob(unsigned long long numEvents);
     
     void fillHistograms(const TrackPlaneHitMap&) const;
     void fillHistograms(const HitVec&)           const;
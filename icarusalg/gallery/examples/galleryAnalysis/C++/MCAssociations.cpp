@@ -115,7 +115,7 @@ void MCAssociations::prepare()
     return;
 } // MCAssociations::prepare()
 
-void MCAssociations::doTrackHitMCAssociations(gallery::Event& event)
+void MCAssociations::doTrackHitMCAssociations(gallery::Event const& event)
 {
     // First step is to recover the MCTruth object vector...
     const auto& mcParticleHandle = event.getValidHandle<std::vector<simb::MCParticle>>(fMCTruthProducerLabel);
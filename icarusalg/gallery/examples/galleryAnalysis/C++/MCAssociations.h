@@ -52,7 +52,7 @@ public:
   
     void prepare();
   
-    void doTrackHitMCAssociations(gallery::Event&);
+    void doTrackHitMCAssociations(gallery::Event const&);
   
     void finish();
     
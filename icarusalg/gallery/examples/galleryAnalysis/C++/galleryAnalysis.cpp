@@ -23,10 +23,12 @@
 
 // ICARUS code
 #include "icarusalg/gallery/helpers/C++/expandInputFiles.h"
+#include "icarusalg/gallery/helpers/C++/PipelinedEventRunner.h"
 
 // LArSoft
 // - data products
 #include "lardataobj/RecoBase/Track.h"
+#include "lardataobj/RecoBase/Hit.h"
 // - DetectorProperties
 #include "lardataalg/DetectorInfo/DetectorPropertiesStandardTestHelpers.h"
 #include "lardataalg/DetectorInfo/DetectorPropertiesStandard.h"
@@ -51,6 +53,7 @@
 
 // ROOT
 #include "TFile.h"
+#include "TROOT.h" // ROOT::EnableThreadSafety()
 
 // C/C++ standard libraries
 #include <string>
@@ -86,6 +89,14 @@ int galleryAnalysis(std::string const& configFile, std::vector<std::string> cons
     // configuration from the "analysis" table of the FHiCL configuration file:
     auto const& analysisConfig = config.get<fhicl::ParameterSet>("analysis");
   
+    // number of events read ahead of the analysis (0: serial processing)
+    unsigned int pipelineDepth = analysisConfig.get<unsigned int>("pipelineDepth", 2U);
+  
+    // the analysis tasks fill their histograms from their own threads,
+    // while gallery reads the next events: ROOT must be ready for that
+    // before any of its objects (including the geometry) is created
+    if (pipelineDepth > 0) ROOT::EnableThreadSafety();
+  
     // ***************************************************************************
     // ***  SERVICE PROVIDER SETUP BEGIN  ****************************************
     // ***************************************************************************
@@ -151,32 +162,44 @@ int galleryAnalysis(std::string const& configFile, std::vector<std::string> cons
     mcAssociations.setup(*geom, detProp, pHistFile.get());
     mcAssociations.prepare();
     
-    int numEvents(0);
-  
     /*
      * the event loop
      */
-    for (gallery::Event event(allInputFiles); !event.atEnd(); event.next())
-    {
-        // *************************************************************************
-        // ***  SINGLE EVENT PROCESSING BEGIN  *************************************
-        // *************************************************************************
+    // the track and hit analyses only read their data products, and they run
+    // concurrently on their own threads, while the next events are read;
+    // the MC associations need the event itself and run on the reading thread
+    icarus::PipelinedEventRunner<gallery::Event> runner(pipelineDepth);
     
-        mf::LogVerbatim("galleryAnalysis") << "This is event " << event.fileEntry() << "-" << event.eventEntry();
+    // *************************************************************************
+    // ***  SINGLE EVENT PROCESSING BEGIN  *************************************
+    // *************************************************************************
     
-        trackAnalysis.processTracks(*(event.getValidHandle<std::vector<recob::Track>>(trackTag)));
-        
-        hitAnalysisAlg.fillHistograms(*(event.getValidHandle<std::vector<recob::Hit>>(hitsTag)));
-        
-        mcAssociations.doTrackHitMCAssociations(event);
-
-        numEvents++;
+    runner.addEventCallback([](gallery::Event const& event)
+        {
+            mf::LogVerbatim("galleryAnalysis") << "This is event " << event.fileEntry() << "-" << event.eventEntry();
+        });
+    
+    runner.addTask<std::vector<recob::Track>>(
+        [&trackAnalysis](std::vector<recob::Track> const& tracks){ trackAnalysis.processTracks(tracks); },
+        trackTag
+        );
+    
+    runner.addTask<std::vector<recob::Hit>>(
+        [&hitAnalysisAlg](std::vector<recob::Hit> const& hits){ hitAnalysisAlg.fillHistograms(hits); },
+        hitsTag
+        );
+    
+    runner.addEventCallback([&mcAssociations](gallery::Event const& event)
+        {
+            mcAssociations.doTrackHitMCAssociations(event);
+        });
     
-        // *************************************************************************
-        // ***  SINGLE EVENT PROCESSING END    *************************************
-        // *************************************************************************
+    // *************************************************************************
+    // ***  SINGLE EVENT PROCESSING END    *************************************
+    // *************************************************************************
     
-    } // for
+    gallery::Event event(allInputFiles);
+    unsigned long long const numEvents = runner.run(event);
   
     trackAnalysis.finish();
     mcAssociations.finish();
@@ -0,0 +1,324 @@
+/**
+ * @file   icarusalg/gallery/helpers/C++/ParallelEventLoop.cxx
+ * @brief  Event loop running compiled code over events in worker processes.
+ * @date   October 18, 2026
+ * @see    `icarusalg/gallery/helpers/C++/ParallelEventLoop.h`
+ */
+
+
+// library header
+#include "icarusalg/gallery/helpers/C++/ParallelEventLoop.h"
+
+// POSIX libraries
+#include <sys/types.h>
+#include <sys/wait.h> // waitpid()
+#include <unistd.h> // fork(), pipe(), read(), write(), close(), _exit()
+
+// C/C++ libraries
+#include <sstream>
+#include <istream>
+#include <ostream>
+#include <stdexcept> // std::runtime_error
+#include <cerrno>
+#include <limits>
+#include <cstdint> // std::uint64_t
+#include <cstring> // std::strerror()
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  // --- BEGIN -- Binary I/O ---------------------------------------------------
+  void writeU64(std::ostream& out, std::uint64_t value)
+    { out.write(reinterpret_cast<char const*>(&value), sizeof(value)); }
+
+  void writeDouble(std::ostream& out, double value)
+    { out.write(reinterpret_cast<char const*>(&value), sizeof(value)); }
+
+  void writeString(std::ostream& out, std::string const& s)
+    { writeU64(out, s.size()); out.write(s.data(), s.size()); }
+
+  [[noreturn]] void throwCorruptedInput() {
+    throw std::runtime_error
+      { "icarus::EventLoopResults: corrupted input data." };
+  } // throwCorruptedInput()
+
+  /// Returns the number of bytes left in `in` (very large if unknown).
+  std::uint64_t bytesLeft(std::istream& in) {
+    std::istream::pos_type const pos = in.tellg();
+    if (pos < 0) return std::numeric_limits<std::uint64_t>::max();
+    in.seekg(0, std::ios::end);
+    std::istream::pos_type const end = in.tellg();
+    in.seekg(pos);
+    if (!in || (end < pos)) throwCorruptedInput();
+    return static_cast<std::uint64_t>(end - pos);
+  } // bytesLeft()
+
+  std::uint64_t readU64(std::istream& in) {
+    std::uint64_t value = 0;
+    if (!in.read(reinterpret_cast<char*>(&value), sizeof(value)))
+      throwCorruptedInput();
+    return value;
+  } // readU64()
+
+  /// Reads a number of elements, each taking at least `minSize` bytes.
+  std::uint64_t readSize(std::istream& in, std::uint64_t minSize) {
+    std::uint64_t const n = readU64(in);
+    if (n > bytesLeft(in) / minSize) throwCorruptedInput();
+    return n;
+  } // readSize()
+
+  double readDouble(std::istream& in) {
+    double value = 0.0;
+    if (!in.read(reinterpret_cast<char*>(&value), sizeof(value)))
+      throwCorruptedInput();
+    return value;
+  } // readDouble()
+
+  std::string readString(std::istream& in) {
+    std::string s(readSize(in, 1U), '\0');
+    if (!in.read(s.data(), s.size())) throwCorruptedInput();
+    return s;
+  } // readString()
+  // --- END ---- Binary I/O ---------------------------------------------------
+
+
+  // --- BEGIN -- Pipe I/O -----------------------------------------------------
+  /// Writes all of `data` into the file descriptor `fd`.
+  bool writeAll(int fd, std::string const& data) {
+    char const* p = data.data();
+    std::size_t left = data.size();
+    while (left > 0) {
+      ssize_t const n = ::write(fd, p, left);
+      if (n < 0) {
+        if (errno == EINTR) continue;
+        return false;
+      }
+      p += n;
+      left -= n;
+    } // while
+    return true;
+  } // writeAll()
+
+
+  /// Reads all the content from file descriptor `fd` until closed.
+  std::string readAll(int fd) {
+    std::string data;
+    char buffer[65536];
+    while (true) {
+      ssize_t const n = ::read(fd, buffer, sizeof(buffer));
+      if (n < 0) {
+        if (errno == EINTR) continue;
+        throw std::runtime_error{
+          std::string{ "icarus::ParallelEventLoop: error reading from worker: " }
+          + std::strerror(errno)
+          };
+      }
+      if (n == 0) break;
+      data.append(buffer, n);
+    } // while
+    return data;
+  } // readAll()
+  // --- END ---- Pipe I/O -----------------------------------------------------
+
+
+  /// Status codes sent by the workers before their payload.
+  enum WorkerStatus: char { Success = 'S', Failure = 'F' };
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+// ---  icarus::EventLoopResults
+// -----------------------------------------------------------------------------
+double icarus::EventLoopResults::sum(std::string const& key) const {
+  auto const it = fSums.find(key);
+  return (it == fSums.end())? 0.0: it->second;
+} // icarus::EventLoopResults::sum()
+
+
+// -----------------------------------------------------------------------------
+std::vector<double> const& icarus::EventLoopResults::values
+  (std::string const& key) const
+{
+  static std::vector<double> const NoValues;
+  auto const it = fValues.find(key);
+  return (it == fValues.end())? NoValues: it->second;
+} // icarus::EventLoopResults::values()
+
+
+// -----------------------------------------------------------------------------
+auto icarus::EventLoopResults::merge(EventLoopResults const& other)
+  -> EventLoopResults&
+{
+  for (auto const& [ key, sum ]: other.fSums) fSums[key] += sum;
+  for (auto const& [ key, values ]: other.fValues) {
+    std::vector<double>& dest = fValues[key];
+    dest.insert(dest.end(), values.begin(), values.end());
+  }
+  fNEvents += other.fNEvents;
+  return *this;
+} // icarus::EventLoopResults::merge()
+
+
+// -----------------------------------------------------------------------------
+void icarus::EventLoopResults::writeTo(std::ostream& out) const {
+
+  writeU64(out, fNEvents);
+
+  writeU64(out, fSums.size());
+  for (auto const& [ key, sum ]: fSums) {
+    writeString(out, key);
+    writeDouble(out, sum);
+  }
+
+  writeU64(out, fValues.size());
+  for (auto const& [ key, values ]: fValues) {
+    writeString(out, key);
+    writeU64(out, values.size());
+    out.write(reinterpret_cast<char const*>(values.data()),
+      values.size() * sizeof(double));
+  }
+
+} // icarus::EventLoopResults::writeTo()
+
+
+// -----------------------------------------------------------------------------
+auto icarus::EventLoopResults::readFrom(std::istream& in) -> EventLoopResults {
+
+  EventLoopResults results;
+
+  results.fNEvents = readU64(in);
+
+  // each sum takes at least a key size and a value
+  for (std::uint64_t n = readSize(in, 2 * sizeof(std::uint64_t)); n > 0; --n) {
+    std::string key = readString(in);
+    results.fSums[std::move(key)] = readDouble(in);
+  }
+
+  // each list takes at least a key size and a value count
+  for (std::uint64_t n = readSize(in, 2 * sizeof(std::uint64_t)); n > 0; --n) {
+    std::vector<double>& values = results.fValues[readString(in)];
+    values.resize(readSize(in, sizeof(double)));
+    if (!in.read(reinterpret_cast<char*>(values.data()),
+      values.size() * sizeof(double))
+    ) {
+      throwCorruptedInput();
+    }
+  }
+
+  return results;
+} // icarus::EventLoopResults::readFrom()
+
+
+// -----------------------------------------------------------------------------
+// ---  icarus::details::runInWorkers()
+// -----------------------------------------------------------------------------
+icarus::EventLoopResults icarus::details::runInWorkers
+  (unsigned int nWorkers, std::function<EventLoopResults(unsigned int)> work)
+{
+  if (nWorkers <= 1) return work(0U);
+
+  struct Worker_t { pid_t pid = -1; int fd = -1; };
+  std::vector<Worker_t> workers;
+
+  //
+  // start the workers
+  //
+  for (unsigned int iWorker = 0; iWorker < nWorkers; ++iWorker) {
+    int fds[2];
+    if (::pipe(fds) != 0) {
+      throw std::runtime_error{
+        std::string{ "icarus::ParallelEventLoop: can't create pipe: " }
+        + std::strerror(errno)
+        };
+    }
+
+    pid_t const pid = ::fork();
+    if (pid < 0) {
+      throw std::runtime_error{
+        std::string{ "icarus::ParallelEventLoop: can't start worker: " }
+        + std::strerror(errno)
+        };
+    }
+
+    if (pid == 0) { // worker process
+      ::close(fds[0]);
+      for (Worker_t const& other: workers) ::close(other.fd);
+
+      std::ostringstream out;
+      bool success = false;
+      try {
+        EventLoopResults const results = work(iWorker);
+        out.put(Success);
+        results.writeTo(out);
+        success = true;
+      }
+      catch (std::exception const& e) {
+        out.str("");
+        out.put(Failure);
+        out << e.what();
+      }
+      catch (...) {
+        out.str("");
+        out.put(Failure);
+        out << "unknown exception";
+      }
+      bool const sent = writeAll(fds[1], out.str());
+      ::close(fds[1]);
+      ::_exit((success && sent)? 0: 1); // skip all exit handlers
+    } // if worker
+
+    ::close(fds[1]);
+    workers.push_back({ pid, fds[0] });
+  } // for workers
+
+  //
+  // collect the results
+  //
+  EventLoopResults merged;
+  std::string errors;
+  for (std::size_t iWorker = 0; iWorker < workers.size(); ++iWorker) {
+    Worker_t const& worker = workers[iWorker];
+
+    std::string data;
+    try { data = readAll(worker.fd); }
+    catch (std::exception const& e) { errors += "\n  "; errors += e.what(); }
+    ::close(worker.fd);
+
+    int status = 0;
+    while ((::waitpid(worker.pid, &status, 0) < 0) && (errno == EINTR));
+
+    // a worker killed while sending its results may have sent only part of
+    // them: the results are accepted only from workers which exited cleanly
+    bool const exitedCleanly
+      = WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+    std::string failure;
+    if (exitedCleanly && !data.empty() && (data.front() == Success)) {
+      try {
+        std::istringstream in{ data.substr(1) };
+        merged.merge(EventLoopResults::readFrom(in));
+        continue;
+      }
+      catch (std::exception const& e) { failure = e.what(); }
+    }
+    else if (!data.empty() && (data.front() == Failure))
+      failure = data.substr(1);
+    else if (WIFSIGNALED(status))
+      failure = "killed by signal " + std::to_string(WTERMSIG(status));
+    else
+      failure = "no results, exit code " + std::to_string(WEXITSTATUS(status));
+
+    errors += "\n  worker #" + std::to_string(iWorker) + ": " + failure;
+  } // for workers
+
+  if (!errors.empty()) {
+    throw std::runtime_error
+      { "icarus::ParallelEventLoop: workers failed:" + errors };
+  }
+
+  return merged;
+} // icarus::details::runInWorkers()
+
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,284 @@
+/**
+ * @file   icarusalg/gallery/helpers/C++/ParallelEventLoop.h
+ * @brief  Event loop running compiled code over events in worker processes.
+ * @date   October 18, 2026
+ * @see    `icarusalg/gallery/helpers/C++/ParallelEventLoop.cxx`,
+ *         `icarusalg/gallery/helpers/python/galleryUtils.py`
+ *
+ * The event loop class is a template on the event type, so that this library
+ * does not need to link to _gallery_: `icarus::ParallelEventLoop` is meant to
+ * be instantiated with `gallery::Event`, either by compiled code or, from
+ * Python, by ROOT (`galleryUtils.parallelEventLoop()` does that).
+ */
+
+#ifndef ICARUSALG_GALLERY_HELPERS_Cxx_PARALLELEVENTLOOP_H
+#define ICARUSALG_GALLERY_HELPERS_Cxx_PARALLELEVENTLOOP_H
+
+// framework libraries
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ libraries
+#include <functional> // std::function<>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <utility> // std::move()
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus {
+  class EventLoopResults;
+  template <typename Event> class ParallelEventLoop;
+
+  namespace details {
+
+    /**
+     * @brief Runs `work` in `nWorkers` forked processes and merges the results.
+     * @param nWorkers number of worker processes
+     * @param work the function to run, with the worker index as argument
+     * @return the merged results from all workers
+     * @throw std::runtime_error if any worker fails
+     *
+     * If `nWorkers` is `1`, `work` is run in this same process.
+     * Results are accepted only from workers which exited cleanly; a worker
+     * which throws, crashes or sends corrupted results is a failure.
+     */
+    EventLoopResults runInWorkers
+      (unsigned int nWorkers, std::function<EventLoopResults(unsigned int)> work);
+
+  } // namespace details
+
+} // namespace icarus
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Named results from an event loop, which can be merged.
+ *
+ * Two kinds of results are supported:
+ * * _sums_ (`add()`): a single number per key, merged by addition;
+ * * _values_ (`append()`): a list of numbers per key, merged by concatenation
+ *   (the order of the values from different workers is not defined).
+ *
+ * The number of processed events is also kept (`nEvents()`).
+ */
+class icarus::EventLoopResults {
+
+    public:
+
+  using Sums_t = std::map<std::string, double>;
+  using Values_t = std::map<std::string, std::vector<double>>;
+
+  /// Adds `value` to the sum with the specified `key`.
+  void add(std::string const& key, double value = 1.0) { fSums[key] += value; }
+
+  /// Appends `value` to the list with the specified `key`.
+  void append(std::string const& key, double value)
+    { fValues[key].push_back(value); }
+
+  /// Records that one more event was processed.
+  void countEvent() { ++fNEvents; }
+
+  /// Returns the number of processed events.
+  unsigned long long nEvents() const { return fNEvents; }
+
+  /// Returns all the sums.
+  Sums_t const& sums() const { return fSums; }
+
+  /// Returns all the value lists.
+  Values_t const& values() const { return fValues; }
+
+  /// Returns the sum with the specified `key` (`0` if not present).
+  double sum(std::string const& key) const;
+
+  /// Returns the values with the specified `key` (empty if not present).
+  std::vector<double> const& values(std::string const& key) const;
+
+  /// Adds the content of `other` to these results.
+  EventLoopResults& merge(EventLoopResults const& other);
+
+  /// Writes the results into `out` in a binary format (see `readFrom()`).
+  void writeTo(std::ostream& out) const;
+
+  /// Returns results read from `in` (written by `writeTo()`).
+  /// @throw std::runtime_error if the data is truncated or corrupted
+  static EventLoopResults readFrom(std::istream& in);
+
+    private:
+
+  Sums_t fSums; ///< All sums.
+  Values_t fValues; ///< All value lists.
+  unsigned long long fNEvents = 0; ///< Number of processed events.
+
+}; // icarus::EventLoopResults
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Runs compiled per-event code on events from multiple processes.
+ * @tparam Event type of event (e.g. `gallery::Event`)
+ *
+ * This object collects per-event actions and runs them on all the events from
+ * a list of input files, splitting the events among a number of worker
+ * processes. Each worker opens all the input files and processes one event
+ * every `nWorkers()` (skipping the others does not read their data products).
+ * The results of each worker, `EventLoopResults` objects, are sent back to
+ * the calling process and merged.
+ *
+ * The actions can be:
+ * * generic callbacks (`addCallback()`) receiving the event and the results
+ *   of the current worker;
+ * * built-in reductions on a data product of a given type and input tag:
+ *   `addProductSizeSum()` (total number of elements in a collection) and
+ *   `addProductSizes()` (list of the number of elements in each event).
+ *
+ * Example with `gallery::Event` in C++:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * icarus::ParallelEventLoop<gallery::Event> loop { inputFiles, 8U };
+ * loop.addProductSizeSum<std::vector<recob::Hit>>
+ *   (art::InputTag{ "gaushit" }, "hits");
+ * loop.addCallback([](gallery::Event const& event, icarus::EventLoopResults& r)
+ *   { r.append("run", event.eventAuxiliary().run()); });
+ *
+ * icarus::EventLoopResults const results = loop.run();
+ * std::cout << results.sum("hits") << " hits in " << results.nEvents()
+ *   << " events" << std::endl;
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The workers are created by `fork()`: the actions (and anything they refer
+ * to) are copied into the workers, and any change they make to the state of
+ * the caller is lost, except for what is stored in the results.
+ *
+ * Requirements on `Event`:
+ * * constructor from a `std::vector<std::string>` of input file paths;
+ * * `bool atEnd() const` and `void next()` for iteration;
+ * * `getValidHandle<T>(art::InputTag)`, for the built-in reductions.
+ */
+template <typename Event>
+class icarus::ParallelEventLoop {
+
+    public:
+
+  using Event_t = Event; ///< Type of event being processed.
+
+  /// Type of per-event action.
+  using Callback_t = std::function<void(Event_t const&, EventLoopResults&)>;
+
+  /// Constructor: processes `inputFiles` with `nWorkers` processes.
+  ParallelEventLoop(std::vector<std::string> inputFiles, unsigned int nWorkers)
+    : fInputFiles{ std::move(inputFiles) }
+    , fNWorkers{ (nWorkers > 0)? nWorkers: 1U }
+    {}
+
+  /// Returns the number of worker processes.
+  unsigned int nWorkers() const { return fNWorkers; }
+
+  /// Adds an action to be executed on each event.
+  void addCallback(Callback_t callback)
+    { fCallbacks.push_back(std::move(callback)); }
+
+  /// Adds the total number of elements of the `tag` collection to `key` sum.
+  template <typename Coll>
+  void addProductSizeSum(art::InputTag const& tag, std::string const& key);
+
+  /// Appends the number of elements of the `tag` collection to `key` values.
+  template <typename Coll>
+  void addProductSizes(art::InputTag const& tag, std::string const& key);
+
+  /**
+   * @brief Runs all actions on the events and returns the merged results.
+   * @param nEvents (default: all) process at most this many events
+   * @param nSkip (default: none) skip this many events from the start
+   * @return the merged results from all workers
+   * @throw std::runtime_error if any of the workers fails
+   */
+  EventLoopResults run
+    (unsigned long long nEvents = NoLimit, unsigned long long nSkip = 0U) const;
+
+  /// Value for no limit on the number of events.
+  static constexpr unsigned long long NoLimit = ~0ULL;
+
+    private:
+
+  std::vector<std::string> fInputFiles; ///< Input files.
+  unsigned int fNWorkers; ///< Number of worker processes.
+  std::vector<Callback_t> fCallbacks; ///< Actions on each event.
+
+  /// Processes the share of events of worker `iWorker`.
+  EventLoopResults runWorker
+    (unsigned int iWorker, unsigned long long nEvents, unsigned long long nSkip)
+    const;
+
+}; // icarus::ParallelEventLoop
+
+
+// -----------------------------------------------------------------------------
+// ---  template implementation
+// -----------------------------------------------------------------------------
+template <typename Event>
+template <typename Coll>
+void icarus::ParallelEventLoop<Event>::addProductSizeSum
+  (art::InputTag const& tag, std::string const& key)
+{
+  addCallback([tag, key](Event_t const& event, EventLoopResults& results)
+    {
+      auto const handle = event.template getValidHandle<Coll>(tag);
+      results.add(key, static_cast<double>(handle->size()));
+    });
+} // icarus::ParallelEventLoop<>::addProductSizeSum()
+
+
+// -----------------------------------------------------------------------------
+template <typename Event>
+template <typename Coll>
+void icarus::ParallelEventLoop<Event>::addProductSizes
+  (art::InputTag const& tag, std::string const& key)
+{
+  addCallback([tag, key](Event_t const& event, EventLoopResults& results)
+    {
+      auto const handle = event.template getValidHandle<Coll>(tag);
+      results.append(key, static_cast<double>(handle->size()));
+    });
+} // icarus::ParallelEventLoop<>::addProductSizes()
+
+
+// -----------------------------------------------------------------------------
+template <typename Event>
+icarus::EventLoopResults icarus::ParallelEventLoop<Event>::run
+  (unsigned long long nEvents /* = NoLimit */, unsigned long long nSkip /* = 0 */)
+  const
+{
+  return details::runInWorkers(fNWorkers,
+    [this, nEvents, nSkip](unsigned int iWorker)
+      { return runWorker(iWorker, nEvents, nSkip); }
+    );
+} // icarus::ParallelEventLoop<>::run()
+
+
+// -----------------------------------------------------------------------------
+template <typename Event>
+icarus::EventLoopResults icarus::ParallelEventLoop<Event>::runWorker
+  (unsigned int iWorker, unsigned long long nEvents, unsigned long long nSkip)
+  const
+{
+  EventLoopResults results;
+
+  unsigned long long iEvent = 0; // index among the events to process
+  for (Event_t event{ fInputFiles }; !event.atEnd(); event.next()) {
+    if (nSkip > 0) { --nSkip; continue; }
+    if (iEvent >= nEvents) break;
+    if (iEvent++ % fNWorkers != iWorker) continue; // some other worker's
+
+    for (Callback_t const& callback: fCallbacks) callback(event, results);
+    results.countEvent();
+  } // for events
+
+  return results;
+} // icarus::ParallelEventLoop<>::runWorker()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // ICARUSALG_GALLERY_HELPERS_Cxx_PARALLELEVENTLOOP_H
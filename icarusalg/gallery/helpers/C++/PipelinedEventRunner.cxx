@@ -0,0 +1,161 @@
+/**
+ * @file   icarusalg/gallery/helpers/C++/PipelinedEventRunner.cxx
+ * @brief  Event loop running analysis tasks concurrently on a pipeline.
+ * @date   October 18, 2026
+ * @see    `icarusalg/gallery/helpers/C++/PipelinedEventRunner.h`
+ */
+
+
+// library header
+#include "icarusalg/gallery/helpers/C++/PipelinedEventRunner.h"
+
+// C/C++ libraries
+#include <algorithm> // std::min_element()
+
+
+// -----------------------------------------------------------------------------
+// ---  icarus::details::TaskPipeline
+// -----------------------------------------------------------------------------
+icarus::details::TaskPipeline::TaskPipeline
+  (std::vector<Task_t> const& tasks, unsigned int depth)
+  : fTasks{ tasks }
+  , fDepth{ depth }
+  , fProcessed(tasks.size(), 0ULL)
+{
+  if (fDepth == 0) return; // synchronous mode
+
+  fThreads.reserve(fTasks.size());
+  for (std::size_t iTask = 0; iTask < fTasks.size(); ++iTask)
+    fThreads.emplace_back(&TaskPipeline::runTask, this, iTask);
+
+} // icarus::details::TaskPipeline::TaskPipeline()
+
+
+// -----------------------------------------------------------------------------
+icarus::details::TaskPipeline::~TaskPipeline() { stop(); }
+
+
+// -----------------------------------------------------------------------------
+void icarus::details::TaskPipeline::push
+  (std::shared_ptr<EventProducts const> products)
+{
+  if (fThreads.empty()) { // synchronous mode
+    for (Task_t const& task: fTasks) task(*products);
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock{ fMutex };
+    fSpaceReady.wait
+      (lock, [this](){ return fStop || (fEvents.size() < fDepth); });
+    if (!fStop) {
+      fEvents.push_back(std::move(products));
+      lock.unlock();
+      fEventReady.notify_all();
+      return;
+    }
+  }
+
+  // a task failed
+  stop();
+  joinAndRethrow();
+
+} // icarus::details::TaskPipeline::push()
+
+
+// -----------------------------------------------------------------------------
+void icarus::details::TaskPipeline::finish() {
+
+  {
+    std::lock_guard<std::mutex> lock{ fMutex };
+    fNoMoreEvents = true;
+  }
+  fEventReady.notify_all();
+
+  joinAndRethrow();
+
+} // icarus::details::TaskPipeline::finish()
+
+
+// -----------------------------------------------------------------------------
+void icarus::details::TaskPipeline::runTask(std::size_t iTask) {
+
+  Task_t const& task = fTasks[iTask];
+
+  for (unsigned long long iEvent = 0; ; ++iEvent) {
+
+    std::shared_ptr<EventProducts const> products;
+    {
+      std::unique_lock<std::mutex> lock{ fMutex };
+      fEventReady.wait(lock, [this, iEvent]()
+        {
+          return fStop || fNoMoreEvents
+            || (iEvent < fFirstEvent + fEvents.size());
+        });
+      if (fStop) return;
+      if (iEvent >= fFirstEvent + fEvents.size()) return; // all done
+      products = fEvents[iEvent - fFirstEvent];
+    }
+
+    try {
+      task(*products);
+    }
+    catch (...) {
+      {
+        std::lock_guard<std::mutex> lock{ fMutex };
+        if (!fError) fError = std::current_exception();
+        fStop = true;
+      }
+      fEventReady.notify_all();
+      fSpaceReady.notify_all();
+      return;
+    }
+
+    //
+    // the events processed by all the tasks leave the pipeline
+    //
+    bool freed = false;
+    {
+      std::lock_guard<std::mutex> lock{ fMutex };
+      fProcessed[iTask] = iEvent + 1;
+      unsigned long long const allDone
+        = *std::min_element(fProcessed.begin(), fProcessed.end());
+      while (fFirstEvent < allDone) {
+        fEvents.pop_front();
+        ++fFirstEvent;
+        freed = true;
+      }
+    }
+    if (freed) fSpaceReady.notify_all();
+
+  } // for events
+
+} // icarus::details::TaskPipeline::runTask()
+
+
+// -----------------------------------------------------------------------------
+void icarus::details::TaskPipeline::stop() {
+
+  {
+    std::lock_guard<std::mutex> lock{ fMutex };
+    fStop = true;
+  }
+  fEventReady.notify_all();
+  fSpaceReady.notify_all();
+
+  for (std::thread& thread: fThreads) if (thread.joinable()) thread.join();
+
+} // icarus::details::TaskPipeline::stop()
+
+
+// -----------------------------------------------------------------------------
+void icarus::details::TaskPipeline::joinAndRethrow() {
+
+  for (std::thread& thread: fThreads) if (thread.joinable()) thread.join();
+
+  if (fError) std::rethrow_exception(fError);
+
+} // icarus::details::TaskPipeline::joinAndRethrow()
+
+
+// -----------------------------------------------------------------------------
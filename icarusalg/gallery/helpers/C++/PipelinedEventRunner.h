@@ -0,0 +1,358 @@
+/**
+ * @file   icarusalg/gallery/helpers/C++/PipelinedEventRunner.h
+ * @brief  Event loop running analysis tasks concurrently on a pipeline.
+ * @date   October 18, 2026
+ * @see    `icarusalg/gallery/helpers/C++/PipelinedEventRunner.cxx`
+ *
+ * As for `icarus::ParallelEventLoop`, the runner is a template on the event
+ * type, so that this library does not need to link to _gallery_:
+ * `icarus::PipelinedEventRunner` is meant to be instantiated with
+ * `gallery::Event`.
+ */
+
+#ifndef ICARUSALG_GALLERY_HELPERS_Cxx_PIPELINEDEVENTRUNNER_H
+#define ICARUSALG_GALLERY_HELPERS_Cxx_PIPELINEDEVENTRUNNER_H
+
+// framework libraries
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ libraries
+#include <array>
+#include <condition_variable>
+#include <cstddef> // std::size_t
+#include <deque>
+#include <exception> // std::exception_ptr
+#include <functional> // std::function<>
+#include <memory> // std::shared_ptr<>
+#include <mutex>
+#include <thread>
+#include <typeindex>
+#include <utility> // std::move(), std::index_sequence
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus {
+  class EventProducts;
+  template <typename Event> class PipelinedEventRunner;
+
+  namespace details { class TaskPipeline; }
+} // namespace icarus
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Data products of one event, detached from the event they come from.
+ *
+ * The products are stored in the order they were added, and they are looked up
+ * by that position (`icarus::PipelinedEventRunner` takes care of that).
+ */
+class icarus::EventProducts {
+
+    public:
+
+  /// Constructor: products of the event with the specified sequence number.
+  explicit EventProducts(unsigned long long eventNumber)
+    : fEventNumber{ eventNumber }
+    {}
+
+  /// Returns the sequence number of the event in the loop (first is `0`).
+  unsigned long long eventNumber() const { return fEventNumber; }
+
+  /// Returns the number of stored products.
+  std::size_t size() const { return fProducts.size(); }
+
+  /// Adds a product; its index is the current `size()`.
+  void add(std::shared_ptr<void const> product)
+    { fProducts.push_back(std::move(product)); }
+
+  /// Returns the product at `index`, which must be of type `T`.
+  template <typename T>
+  T const& get(std::size_t index) const
+    { return *static_cast<T const*>(fProducts[index].get()); }
+
+    private:
+
+  unsigned long long fEventNumber; ///< Sequence number of the event.
+  std::vector<std::shared_ptr<void const>> fProducts; ///< All the products.
+
+}; // icarus::EventProducts
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Runs tasks on the products of each event on dedicated threads.
+ *
+ * Each task runs on its own thread and processes the events in order.
+ * Up to `depth` events, already pushed but not yet processed by all the
+ * tasks, are kept in memory; `push()` waits while the pipeline is full.
+ * With `depth` `0` (or no task), the tasks are run synchronously in `push()`.
+ *
+ * The first exception thrown by a task stops the pipeline and it is rethrown
+ * by the next `push()` or by `finish()`.
+ */
+class icarus::details::TaskPipeline {
+
+    public:
+
+  /// Type of task.
+  using Task_t = std::function<void(EventProducts const&)>;
+
+  /// Constructor: starts a thread for each of `tasks` (which must outlive us).
+  TaskPipeline(std::vector<Task_t> const& tasks, unsigned int depth);
+
+  /// Destructor: stops and waits for the threads if `finish()` was not called.
+  ~TaskPipeline();
+
+  TaskPipeline(TaskPipeline const&) = delete;
+  TaskPipeline& operator= (TaskPipeline const&) = delete;
+
+  /// Adds the products of the next event to the pipeline.
+  void push(std::shared_ptr<EventProducts const> products);
+
+  /// Waits for all the pushed events to be processed.
+  void finish();
+
+    private:
+
+  std::vector<Task_t> const& fTasks; ///< The tasks to run on each event.
+  unsigned int const fDepth; ///< Maximum number of events in the pipeline.
+
+  std::mutex fMutex; ///< Protects all the following data members.
+  std::condition_variable fEventReady; ///< Signals a new event (or the end).
+  std::condition_variable fSpaceReady; ///< Signals a processed event.
+
+  /// Events not processed yet by all the tasks.
+  std::deque<std::shared_ptr<EventProducts const>> fEvents;
+  unsigned long long fFirstEvent = 0; ///< Sequence number of `fEvents` front.
+  std::vector<unsigned long long> fProcessed; ///< Events done by each task.
+  bool fNoMoreEvents = false; ///< Whether `finish()` was called.
+  bool fStop = false; ///< Whether the tasks should stop right away.
+  std::exception_ptr fError; ///< First exception from a task.
+
+  std::vector<std::thread> fThreads; ///< One thread per task.
+
+  /// Loop of the thread running the task `iTask`.
+  void runTask(std::size_t iTask);
+
+  /// Stops all the threads and waits for them.
+  void stop();
+
+  /// Joins all the threads and rethrows the error from a task, if any.
+  void joinAndRethrow();
+
+}; // icarus::details::TaskPipeline
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Event loop running the analysis tasks concurrently on a pipeline.
+ * @tparam Event type of event (e.g. `gallery::Event`)
+ *
+ * The usual gallery analysis loop reads an event and then runs each of the
+ * analysis algorithms on its data products, one after the other.
+ * This runner instead:
+ * * on the calling thread, reads each event, fetching once all the data
+ *   products declared by the tasks, and runs the event callbacks;
+ * * runs each task on its own thread, so that independent tasks run
+ *   concurrently with each other, and with the reading of the next events.
+ *
+ * A _task_ (`addTask()`) declares the data products it reads (type and input
+ * tag) and receives them as arguments. Products read by more than one task are
+ * fetched only once. Since the event moves on while the tasks are still
+ * running, the products are _copied_ out of the event.
+ * Code which needs the event itself (e.g. associations via `art::FindMany`)
+ * can be added as an _event callback_ (`addEventCallback()`): event callbacks
+ * are run on the reading thread, in order, right after the products are read.
+ *
+ * Each task processes all the events in their order, on a single thread.
+ * Therefore, as long as tasks do not share state (e.g. each one fills its own
+ * histograms), the result is the same as in a serial loop.
+ * No more than `pipelineDepth()` events (besides the one being read) wait to
+ * be processed by all the tasks; a depth of `0` runs all the tasks
+ * synchronously in the reading thread, like the serial loop.
+ *
+ * Example with `gallery::Event`:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * icarus::PipelinedEventRunner<gallery::Event> runner { 2U };
+ * runner.addTask<std::vector<recob::Track>>(
+ *   [&trackAnalysis](std::vector<recob::Track> const& tracks)
+ *     { trackAnalysis.processTracks(tracks); },
+ *   trackTag
+ *   );
+ * gallery::Event event { inputFiles };
+ * unsigned long long const nEvents = runner.run(event);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * An exception thrown by a task or by the reading stops the loop and it is
+ * rethrown by `run()`.
+ *
+ * Requirements on `Event`:
+ * * `bool atEnd() const` and `void next()` for iteration;
+ * * `getValidHandle<T>(art::InputTag)`, for reading the products.
+ */
+template <typename Event>
+class icarus::PipelinedEventRunner {
+
+    public:
+
+  using Event_t = Event; ///< Type of event being processed.
+
+  /// Type of action on the event, run on the reading thread.
+  using EventCallback_t = std::function<void(Event_t const&)>;
+
+  /// Value for no limit on the number of events.
+  static constexpr unsigned long long NoLimit = ~0ULL;
+
+  /// Constructor: keeps up to `pipelineDepth` events waiting for the tasks.
+  explicit PipelinedEventRunner(unsigned int pipelineDepth = 2U)
+    : fPipelineDepth{ pipelineDepth }
+    {}
+
+  /// Returns the maximum number of events waiting for the tasks.
+  unsigned int pipelineDepth() const { return fPipelineDepth; }
+
+  /// Adds an action to be executed on each event on the reading thread.
+  void addEventCallback(EventCallback_t callback)
+    { fEventCallbacks.push_back(std::move(callback)); }
+
+  /**
+   * @brief Adds a task reading the specified data products.
+   * @tparam Products types of the data products read by the task
+   * @tparam Func type of the task
+   * @tparam Tags types of the input tags (convertible to `art::InputTag`)
+   * @param task the callable object to run on each event
+   * @param tags the input tag of each product, in the order of `Products`
+   *
+   * For each event, `task` is called with a constant reference to each of
+   * the products as arguments, in the order of `Products`.
+   */
+  template <typename... Products, typename Func, typename... Tags>
+  void addTask(Func task, Tags const&... tags);
+
+  /**
+   * @brief Runs the tasks on all the events from `event` on.
+   * @param event the event to start from; at the end, it is past the last one
+   * @param nEvents (default: all) process at most this many events
+   * @return the number of processed events
+   */
+  unsigned long long run(Event_t& event, unsigned long long nEvents = NoLimit);
+
+    private:
+
+  /// Information about a data product to be read.
+  struct ProductInfo_t {
+    std::type_index type; ///< Type of the product.
+    art::InputTag tag; ///< Input tag of the product.
+    /// Copies the product out of the event.
+    std::function<std::shared_ptr<void const>(Event_t const&)> fetch;
+  }; // ProductInfo_t
+
+  unsigned int fPipelineDepth; ///< Maximum events waiting for the tasks.
+  std::vector<ProductInfo_t> fProducts; ///< Products to read.
+  std::vector<EventCallback_t> fEventCallbacks; ///< Actions on the event.
+  std::vector<details::TaskPipeline::Task_t> fTasks; ///< Tasks on products.
+
+  /// Returns the index of product `T` with `tag`, registering it if needed.
+  template <typename T>
+  std::size_t productIndex(art::InputTag const& tag);
+
+  /// Calls `task` with the products at the specified `indices`.
+  template <typename... Products, typename Func, std::size_t... I>
+  static void callTask(
+    Func& task, EventProducts const& products,
+    std::array<std::size_t, sizeof...(Products)> const& indices,
+    std::index_sequence<I...>
+    );
+
+}; // icarus::PipelinedEventRunner
+
+
+// -----------------------------------------------------------------------------
+// ---  template implementation
+// -----------------------------------------------------------------------------
+template <typename Event>
+template <typename... Products, typename Func, typename... Tags>
+void icarus::PipelinedEventRunner<Event>::addTask
+  (Func task, Tags const&... tags)
+{
+  static_assert(sizeof...(Products) == sizeof...(Tags),
+    "PipelinedEventRunner::addTask() needs one input tag per product type");
+
+  std::array<std::size_t, sizeof...(Products)> const indices
+    { productIndex<Products>(art::InputTag{ tags })... };
+
+  fTasks.push_back([task=std::move(task), indices](EventProducts const& products)
+    mutable
+    {
+      callTask<Products...>
+        (task, products, indices, std::index_sequence_for<Products...>{});
+    });
+
+} // icarus::PipelinedEventRunner<>::addTask()
+
+
+// -----------------------------------------------------------------------------
+template <typename Event>
+unsigned long long icarus::PipelinedEventRunner<Event>::run
+  (Event_t& event, unsigned long long nEvents /* = NoLimit */)
+{
+  // the pipeline destructor stops the tasks if reading throws
+  details::TaskPipeline pipeline{ fTasks, fPipelineDepth };
+
+  unsigned long long iEvent = 0;
+  for (; !event.atEnd() && (iEvent < nEvents); event.next()) {
+
+    auto products = std::make_shared<EventProducts>(iEvent++);
+    for (ProductInfo_t const& info: fProducts) products->add(info.fetch(event));
+
+    for (EventCallback_t const& callback: fEventCallbacks) callback(event);
+
+    pipeline.push(std::move(products));
+
+  } // for events
+
+  pipeline.finish();
+  return iEvent;
+
+} // icarus::PipelinedEventRunner<>::run()
+
+
+// -----------------------------------------------------------------------------
+template <typename Event>
+template <typename T>
+std::size_t icarus::PipelinedEventRunner<Event>::productIndex
+  (art::InputTag const& tag)
+{
+  std::type_index const type{ typeid(T) };
+  for (std::size_t i = 0; i < fProducts.size(); ++i) {
+    if ((fProducts[i].type == type) && (fProducts[i].tag == tag)) return i;
+  }
+
+  fProducts.push_back({ type, tag, [tag](Event_t const& event)
+    {
+      return std::shared_ptr<void const>
+        { std::make_shared<T const>(*(event.template getValidHandle<T>(tag))) };
+    }
+    });
+  return fProducts.size() - 1;
+
+} // icarus::PipelinedEventRunner<>::productIndex()
+
+
+// -----------------------------------------------------------------------------
+template <typename Event>
+template <typename... Products, typename Func, std::size_t... I>
+void icarus::PipelinedEventRunner<Event>::callTask(
+  Func& task, [[maybe_unused]] EventProducts const& products,
+  [[maybe_unused]] std::array<std::size_t, sizeof...(Products)> const& indices,
+  std::index_sequence<I...>
+) {
+  task(products.template get<Products>(indices[I])...);
+} // icarus::PipelinedEventRunner<>::callTask()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // ICARUSALG_GALLERY_HELPERS_Cxx_PIPELINEDEVENTRUNNER_H
@@ -35,6 +35,7 @@ __all__ = [
   'makeFileList',
   'forEach',
   'eventLoop',
+  'parallelEventLoop',
   'findFHiCL',
   'loadConfiguration',
   'ConfigurationClass',
@@ -299,6 +300,88 @@ def eventLoop(inputFiles,
 # eventLoop()
 
 
+def parallelEventLoop(inputFiles,
+ nWorkers: "number of worker processes" = 1,
+ callbacks: "names of compiled C++ per-event functions" = [],
+ productSizeSums: "(type, tag, key) for the total size of collections" = [],
+ productSizes: "(type, tag, key) for the size of collections in each event" = [],
+ options = {},
+ ) -> "a dictionary with the merged results":
+  """
+  Runs compiled C++ code on all events from `inputFiles`, in parallel.
+  
+  The event loop is executed by `icarus::ParallelEventLoop<gallery::Event>`
+  (from `icarusalg/gallery/helpers/C++/ParallelEventLoop.h`) on `nWorkers`
+  processes, and Python is not involved in the processing of each event.
+  
+  The `inputFiles` are in the same format as for `eventLoop()`.
+  
+  Each of the `callbacks` is the name of a C++ function (or function object)
+  with signature
+  `void(gallery::Event const&, icarus::EventLoopResults&)`, which is called on
+  each event; it can be declared in advance with `ROOT.gInterpreter.Declare()`.
+  The built-in reductions are specified by the data product type (e.g.
+  `"std::vector<recob::Hit>"`), its input tag (string or `art::InputTag`) and
+  the name of the result to fill: `productSizeSums` adds the number of elements
+  of the collection in each event into a single sum, `productSizes` records
+  the number of elements in each event in a list.
+  
+  The result is a dictionary with the sums (as `float`) and the value lists
+  (as `list` of `float`) from all the workers, keyed by their name, plus the
+  number of processed events under the key `'nEvents'`.
+  Note that the order of the values in the lists is not the order of the
+  events, since each worker processes one event every `nWorkers`.
+  
+  Options:
+  - 'nEvents': number of events to be processed (does not include skipped ones)
+  - 'nSkip': number of events from the beginning of the sample to be skipped
+  
+  Example counting hits:
+      
+      parallelEventLoop("data.root", nWorkers=8,
+        productSizeSums=[ ( "std::vector<recob::Hit>", "gaushit", "hits" ) ],
+        )['hits']
+      
+  """
+  
+  SourceCode.loadHeaderFromUPS("icarusalg/gallery/helpers/C++/ParallelEventLoop.h")
+  SourceCode.loadLibrary("icarusalg_gallery_helpers")
+  
+  # option reading
+  nSkip = options.get('nSkip', 0)
+  nEvents = options.get('nEvents', None)
+  
+  # make sure the input file list is in the right format
+  if not isinstance(inputFiles, ROOT.vector(ROOT.string)):
+    if isinstance(inputFiles, str): inputFiles = [ inputFiles, ]
+    inputFiles = makeFileList(*inputFiles)
+  # if
+  
+  LoopClass = ROOT.icarus.ParallelEventLoop[ROOT.gallery.Event]
+  loop = LoopClass(inputFiles, nWorkers)
+  
+  for callback in callbacks:
+    loop.addCallback(getattr(ROOT, callback) if isinstance(callback, str) else callback)
+  for methodName, requests in (
+    ( 'addProductSizeSum', productSizeSums ),
+    ( 'addProductSizes', productSizes ),
+    ):
+    for klass, tag, key in requests:
+      getattr(loop, methodName)[klass](ROOT.art.InputTag(tag), key)
+  # for reductions
+  
+  results = loop.run(
+    LoopClass.NoLimit if nEvents is None else nEvents,
+    nSkip,
+    )
+  
+  merged = { 'nEvents': results.nEvents() }
+  for entry in results.sums(): merged[str(entry.first)] = entry.second
+  for entry in results.values(): merged[str(entry.first)] = list(entry.second)
+  return merged
+# parallelEventLoop()
+
+
 
 # this does not really work...
 # ROOT.gallery.Event.__iter__ = lambda self: EventIterator(self)
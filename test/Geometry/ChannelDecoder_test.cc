@@ -0,0 +1,185 @@
+/**
+ * @file   ChannelDecoder_test.cc
+ * @brief  Unit test for `icarus::ChannelDecoder`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/ChannelDecoder.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ChannelDecoder
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Geometry/ChannelDecoder.h"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <stdexcept> // std::out_of_range
+#include <cstddef>
+
+
+//------------------------------------------------------------------------------
+/*
+ * A small detector in the style of ICARUS: two cryostats with two TPC sets
+ * each, and four readout planes per TPC set (the first induction split in two),
+ * with 100 channels each; the last 50 channels are not mapped.
+ */
+constexpr unsigned int NCryostats = 2U;
+constexpr unsigned int NTPCsets = 2U;
+constexpr unsigned int NROPs = 4U;
+constexpr unsigned int NChannelsPerROP = 100U;
+constexpr raw::ChannelID_t NMappedChannels
+  = NCryostats * NTPCsets * NROPs * NChannelsPerROP;
+constexpr raw::ChannelID_t NChannels = NMappedChannels + 50U;
+
+geo::View_t ROPview(unsigned int r) {
+  constexpr geo::View_t Views[NROPs] = { geo::kY, geo::kY, geo::kU, geo::kV };
+  return Views[r];
+}
+
+geo::SigType_t ROPsigType(unsigned int r)
+  { return (r < 3U)? geo::kInduction: geo::kCollection; }
+
+readout::ROPID expectedROP(raw::ChannelID_t channel) {
+  if (channel >= NMappedChannels) return {};
+  unsigned int const iROP = channel / NChannelsPerROP;
+  return {
+    iROP / (NTPCsets * NROPs),
+    static_cast<readout::TPCsetID::TPCsetID_t>((iROP / NROPs) % NTPCsets),
+    iROP % NROPs
+    };
+}
+
+
+icarus::ChannelDecoder makeDecoder() {
+  icarus::ChannelDecoder decoder { NChannels };
+  raw::ChannelID_t first = 0;
+  for (unsigned int c = 0; c < NCryostats; ++c) {
+    for (unsigned short s = 0; s < NTPCsets; ++s) {
+      for (unsigned int r = 0; r < NROPs; ++r) {
+        decoder.setChannels(first, NChannelsPerROP, { c, s, r },
+          ROPview(r), ROPsigType(r));
+        first += NChannelsPerROP;
+      } // for ROPs
+    } // for TPC sets
+  } // for cryostats
+  return decoder;
+} // makeDecoder()
+
+
+//------------------------------------------------------------------------------
+void ChannelDecoderSingleTest() {
+
+  icarus::ChannelDecoder const decoder = makeDecoder();
+  BOOST_TEST(decoder.nChannels() == NChannels);
+
+  for (raw::ChannelID_t channel = 0; channel < NChannels + 10U; ++channel) {
+    BOOST_TEST_CONTEXT("Channel " << channel) {
+      readout::ROPID const expected = expectedROP(channel);
+      BOOST_TEST(decoder.hasChannel(channel) == expected.isValid);
+      BOOST_TEST(decoder.ROP(channel) == expected);
+      BOOST_TEST(decoder.TPCset(channel) == expected.asTPCsetID());
+      if (expected.isValid) {
+        BOOST_TEST(decoder.view(channel) == ROPview(expected.ROP));
+        BOOST_TEST(decoder.signalType(channel) == ROPsigType(expected.ROP));
+      }
+      else {
+        BOOST_TEST
+          (decoder.word(channel) == icarus::ChannelDecoder::InvalidWord);
+        BOOST_TEST(decoder.view(channel) == geo::kUnknown);
+        BOOST_TEST(decoder.signalType(channel) == geo::kMysteryType);
+      }
+    } // context
+  } // for
+
+  BOOST_TEST(!decoder.hasChannel(raw::InvalidChannelID));
+  BOOST_TEST(!decoder.ROP(raw::InvalidChannelID));
+
+  // an empty decoder maps nothing
+  icarus::ChannelDecoder const empty;
+  BOOST_TEST(empty.nChannels() == 0U);
+  BOOST_TEST(!empty.hasChannel(0));
+  BOOST_TEST(empty.view(0) == geo::kUnknown);
+
+} // ChannelDecoderSingleTest()
+
+
+//------------------------------------------------------------------------------
+void ChannelDecoderBatchTest() {
+
+  icarus::ChannelDecoder const decoder = makeDecoder();
+
+  std::vector<raw::ChannelID_t> channels;
+  for (raw::ChannelID_t channel = 0; channel < NChannels + 10U; channel += 7U)
+    channels.push_back(channel);
+  channels.push_back(raw::InvalidChannelID);
+  std::size_t const n = channels.size();
+
+  std::vector<geo::View_t> views(n);
+  std::vector<readout::ROPID> ROPs(n);
+  std::vector<readout::TPCsetID> TPCsets(n);
+  std::vector<icarus::ChannelDecoder::Word_t> words(n);
+  decoder.decode(channels, views, ROPs, TPCsets);
+  decoder.words(channels, words);
+
+  for (std::size_t i = 0; i < n; ++i) {
+    BOOST_TEST_CONTEXT("Channel " << channels[i]) {
+      BOOST_TEST(views[i] == decoder.view(channels[i]));
+      BOOST_TEST(ROPs[i] == decoder.ROP(channels[i]));
+      BOOST_TEST(TPCsets[i] == decoder.TPCset(channels[i]));
+      BOOST_TEST(words[i] == decoder.word(channels[i]));
+    }
+  } // for
+
+  // only some of the information
+  std::vector<geo::View_t> viewsOnly(n);
+  decoder.decode(channels, viewsOnly, {}, {});
+  BOOST_TEST(viewsOnly == views);
+
+} // ChannelDecoderBatchTest()
+
+
+//------------------------------------------------------------------------------
+void ChannelDecoderErrorTest() {
+
+  icarus::ChannelDecoder decoder { 10U };
+  readout::ROPID const rid { 0U, 0U, 0U };
+
+  BOOST_CHECK_THROW(
+    decoder.setChannels(5U, 6U, rid, geo::kU, geo::kInduction),
+    std::out_of_range
+    );
+  BOOST_CHECK_THROW(
+    decoder.setChannels(0U, 1U, { 0U, 0U, 255U }, geo::kU, geo::kInduction),
+    std::out_of_range
+    );
+  BOOST_CHECK_THROW(
+    decoder.setChannels(0U, 1U, readout::ROPID{}, geo::kU, geo::kInduction),
+    std::out_of_range
+    );
+  BOOST_TEST(!decoder.hasChannel(0U));
+
+  decoder.setChannels(5U, 5U, rid, geo::kU, geo::kInduction);
+  BOOST_TEST(decoder.hasChannel(9U));
+
+} // ChannelDecoderErrorTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelDecoderSingleTestCase) {
+  ChannelDecoderSingleTest();
+} // BOOST_AUTO_TEST_CASE(ChannelDecoderSingleTestCase)
+
+BOOST_AUTO_TEST_CASE(ChannelDecoderBatchTestCase) {
+  ChannelDecoderBatchTest();
+} // BOOST_AUTO_TEST_CASE(ChannelDecoderBatchTestCase)
+
+BOOST_AUTO_TEST_CASE(ChannelDecoderErrorTestCase) {
+  ChannelDecoderErrorTest();
+} // BOOST_AUTO_TEST_CASE(ChannelDecoderErrorTestCase)
@@ -0,0 +1,197 @@
+/**
+ * @file   ChannelMask_test.cc
+ * @brief  Unit test for `icarus::ChannelMask`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/ChannelMask.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ChannelMask
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Geometry/ChannelMask.h"
+#include "icarusalg/Utilities/IntegerRanges.h"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::count()
+#include <set>
+#include <stdexcept> // std::out_of_range
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+/*
+ * A small ICARUS-like layout: 1 cryostat with 2 TPC sets, each with 3 ROPs.
+ * The first ROP of each TPC set covers a single plane, the other two cover
+ * two planes each, sharing 20 channels. There are 10 wireless channels at the
+ * end of each ROP.
+ */
+constexpr unsigned int NTPCsets = 2U;
+constexpr unsigned int NROPs = 3U;
+constexpr unsigned int NWires = 100U;
+constexpr unsigned int NShared = 20U;
+constexpr unsigned int NWireless = 10U;
+
+
+icarus::ChannelMaskLayout makeTestLayout() {
+
+  icarus::ChannelMaskLayout layout;
+  raw::ChannelID_t nextChannel = 0;
+  for (unsigned int s = 0; s < NTPCsets; ++s) {
+    for (unsigned int r = 0; r < NROPs; ++r) {
+      readout::ROPID const ropid { 0U, s, r };
+      raw::ChannelID_t const firstROPchannel = nextChannel;
+      if (r == 0) {
+        geo::PlaneID const planeid { 0U, s * 2U, 0U };
+        layout.planes.push_back({ planeid, nextChannel, nextChannel + NWires });
+        nextChannel += NWires;
+      }
+      else {
+        geo::PlaneID const planeid1 { 0U, s * 2U, r };
+        geo::PlaneID const planeid2 { 0U, s * 2U + 1U, r };
+        layout.planes.push_back
+          ({ planeid1, nextChannel, nextChannel + NWires });
+        nextChannel += NWires - NShared;
+        layout.planes.push_back
+          ({ planeid2, nextChannel, nextChannel + NWires });
+        nextChannel += NWires;
+      }
+      nextChannel += NWireless;
+      layout.ROPs.push_back({ ropid, firstROPchannel, nextChannel });
+    } // for ROP
+  } // for TPC set
+  layout.endChannel = nextChannel;
+
+  return layout;
+} // makeTestLayout()
+
+
+//------------------------------------------------------------------------------
+/// Returns how many of `channels` are in `[ first, end [`.
+unsigned int countIn(
+  std::set<raw::ChannelID_t> const& channels,
+  raw::ChannelID_t first, raw::ChannelID_t end
+) {
+  return std::distance
+    (channels.lower_bound(first), channels.lower_bound(end));
+} // countIn()
+
+
+//------------------------------------------------------------------------------
+void ChannelMaskSummaryTest() {
+
+  icarus::ChannelMaskLayout const layout = makeTestLayout();
+
+  // masked channels include word boundaries and shared channels
+  std::vector<raw::ChannelID_t> const channels {
+    0, 63, 64, 65, 127, 128, 181, 182, 185, 199, 200, 450, 449, 63,
+    layout.endChannel - 1
+    };
+  std::set<raw::ChannelID_t> const channelSet
+    { channels.begin(), channels.end() };
+
+  icarus::ChannelMask const mask
+    { layout, channels.begin(), channels.end() };
+
+  BOOST_TEST(mask.nChannels() == layout.endChannel);
+  BOOST_TEST(mask.nMasked() == channelSet.size());
+  BOOST_TEST(mask.anyMasked());
+
+  for (raw::ChannelID_t channel = 0; channel < layout.endChannel; ++channel)
+    BOOST_TEST(mask.isMasked(channel) == (channelSet.count(channel) > 0));
+  BOOST_TEST(!mask.isMasked(layout.endChannel));
+  BOOST_TEST(!mask.isMasked(raw::InvalidChannelID));
+
+  std::vector<unsigned int> TPCsetCounts(NTPCsets, 0U);
+  for (icarus::ChannelMaskLayout::ROPInfo_t const& ROP: layout.ROPs) {
+    BOOST_TEST_CONTEXT("ROP: " << ROP.ID) {
+      unsigned int const expected
+        = countIn(channelSet, ROP.firstChannel, ROP.endChannel);
+      BOOST_TEST(mask.nMasked(ROP.ID) == expected);
+      BOOST_TEST(mask.anyMasked(ROP.ID) == (expected > 0));
+      TPCsetCounts[ROP.ID.TPCset] += expected;
+    }
+  } // for ROP
+
+  for (unsigned int s = 0; s < NTPCsets; ++s) {
+    readout::TPCsetID const tpcsetid { 0U, s };
+    BOOST_TEST(mask.nMasked(tpcsetid) == TPCsetCounts[s]);
+  }
+
+  for (icarus::ChannelMaskLayout::PlaneInfo_t const& plane: layout.planes) {
+    BOOST_TEST_CONTEXT("plane: " << plane.ID) {
+      BOOST_TEST(mask.nMasked(plane.ID)
+        == countIn(channelSet, plane.firstChannel, plane.endChannel));
+    }
+  } // for plane
+
+  // elements not in the layout
+  BOOST_TEST(mask.nMasked(readout::ROPID{ 1U, 0U, 0U }) == 0U);
+  BOOST_TEST(mask.nMasked(readout::TPCsetID{ 0U, NTPCsets }) == 0U);
+  BOOST_TEST(mask.nMasked(geo::PlaneID{ 0U, 0U, 5U }) == 0U);
+
+} // ChannelMaskSummaryTest()
+
+
+//------------------------------------------------------------------------------
+void ChannelMaskRangesTest() {
+
+  icarus::ChannelMaskLayout const layout = makeTestLayout();
+
+  icarus::IntegerRanges<raw::ChannelID_t> const channelRanges
+    { 3, 4, 5, 6, 60, 61, 62, 63, 64, 65, 66, 67, 68, 300, 301, 302 };
+
+  icarus::ChannelMask const mask { layout, channelRanges };
+  BOOST_TEST(mask.nMasked() == channelRanges.size());
+  BOOST_TEST(mask.isMasked(3));
+  BOOST_TEST(!mask.isMasked(7));
+  BOOST_TEST(mask.isMasked(64));
+  BOOST_TEST(!mask.isMasked(69));
+  BOOST_TEST(mask.isMasked(302));
+
+  // collection queries
+  std::vector<raw::ChannelID_t> const hitChannels
+    { 2, 3, 64, 64, 69, 301, 302, 303, raw::InvalidChannelID };
+  std::vector<bool> const expected
+    { false, true, true, true, false, true, true, false, false };
+
+  BOOST_TEST(mask.countMasked(hitChannels.begin(), hitChannels.end())
+    == static_cast<std::size_t>
+      (std::count(expected.begin(), expected.end(), true))
+    );
+
+  std::vector<char> flags(hitChannels.size(), 2);
+  auto const flagsEnd
+    = mask.flagMasked(hitChannels.begin(), hitChannels.end(), flags.begin());
+  BOOST_TEST((flagsEnd == flags.end()));
+  for (std::size_t i = 0; i < flags.size(); ++i)
+    BOOST_TEST((flags[i] != 0) == expected[i]);
+
+  // empty mask
+  icarus::ChannelMask const emptyMask { layout };
+  BOOST_TEST(!emptyMask.anyMasked());
+  BOOST_TEST(!emptyMask.anyMasked(readout::ROPID{ 0U, 0U, 0U }));
+
+  // channels out of the detector
+  icarus::IntegerRanges<raw::ChannelID_t> const badRanges
+    { layout.endChannel - 1, layout.endChannel };
+  BOOST_CHECK_THROW(
+    (icarus::ChannelMask{ layout, badRanges }),
+    std::out_of_range
+    );
+
+} // ChannelMaskRangesTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelMaskTestCase) {
+  ChannelMaskSummaryTest();
+  ChannelMaskRangesTest();
+} // BOOST_AUTO_TEST_CASE(ChannelMaskTestCase)
@@ -0,0 +1,167 @@
+/**
+ * @file   ChannelToWireMap_test.cc
+ * @brief  Unit test and benchmark for `icarus::details::ChannelToWireMap`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/details/ChannelToWireMap.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ChannelToWireMap
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Geometry/details/ChannelToWireMap.h"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::find_if()
+#include <chrono>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// ICARUS-like layout: 2 cryostats, 2 TPC sets each, 4 readout planes each
+constexpr unsigned int NCryostats = 2U;
+constexpr unsigned int NTPCsets = 2U;
+constexpr unsigned int NROPs = 4U;
+constexpr unsigned int ChannelsPerROP[NROPs] = { 2304U, 2304U, 5760U, 5760U };
+
+
+struct MapFixture {
+
+  icarus::details::ChannelToWireMap map;
+  std::vector<readout::ROPID> ROPs;
+  std::vector<raw::ChannelID_t> firstChannels;
+
+  MapFixture()
+    {
+      raw::ChannelID_t nextChannel = 0;
+      for (unsigned int c = 0; c < NCryostats; ++c) {
+        for (unsigned short s = 0; s < NTPCsets; ++s) {
+          for (unsigned int r = 0; r < NROPs; ++r) {
+            readout::ROPID const ropid { c, s, r };
+            map.addROP(ropid, nextChannel, ChannelsPerROP[r]);
+            ROPs.push_back(ropid);
+            firstChannels.push_back(nextChannel);
+            nextChannel += ChannelsPerROP[r];
+          } // for ROP
+        } // for TPC set
+      } // for cryostat
+      map.setEndChannel(nextChannel);
+    }
+
+}; // MapFixture
+
+
+//------------------------------------------------------------------------------
+void ROPlookupTest() {
+
+  MapFixture const data;
+  icarus::details::ChannelToWireMap const& map = data.map;
+
+  for (std::size_t i = 0; i < data.ROPs.size(); ++i) {
+    readout::ROPID const& ropid = data.ROPs[i];
+    BOOST_TEST_CONTEXT("ROP: " << ropid) {
+      auto const* info = map.find(ropid);
+      BOOST_TEST_REQUIRE(info);
+      BOOST_TEST(info->ropid == ropid);
+      BOOST_TEST(info->firstChannel == data.firstChannels[i]);
+      BOOST_TEST(info->nChannels == ChannelsPerROP[ropid.ROP]);
+
+      // the lookup by channel must agree
+      BOOST_TEST(map.find(info->firstChannel) == info);
+      BOOST_TEST(map.find(info->firstChannel + info->nChannels - 1) == info);
+    }
+  } // for
+
+  // ROPs not in the map
+  BOOST_TEST(!map.find(readout::ROPID{}));
+  BOOST_TEST(!map.find(readout::ROPID{ NCryostats, 0U, 0U }));
+  BOOST_TEST(!map.find(readout::ROPID{ 0U, NTPCsets, 0U }));
+  BOOST_TEST(!map.find(readout::ROPID{ 0U, 0U, NROPs }));
+
+} // ROPlookupTest()
+
+
+//------------------------------------------------------------------------------
+void ROPlookupAfterClearTest() {
+
+  MapFixture data;
+  data.map.clear();
+  BOOST_TEST(!data.map.find(data.ROPs.front()));
+
+  data.map.addROP(readout::ROPID{ 0U, 0U, 2U }, 0U, 100U);
+  data.map.setEndChannel(100U);
+  BOOST_TEST(!data.map.find(readout::ROPID{ 0U, 0U, 0U }));
+  auto const* info = data.map.find(readout::ROPID{ 0U, 0U, 2U });
+  BOOST_TEST_REQUIRE(info);
+  BOOST_TEST(info->nChannels == 100U);
+
+} // ROPlookupAfterClearTest()
+
+
+//------------------------------------------------------------------------------
+void ROPlookupBenchmark() {
+
+  /*
+   * Times the lookup by ROP ID of all the ROPs, repeated many times,
+   * against the linear search that the map used to perform.
+   */
+  using Clock_t = std::chrono::steady_clock;
+  constexpr unsigned int NRepetitions = 200'000U;
+
+  MapFixture const data;
+  icarus::details::ChannelToWireMap const& map = data.map;
+
+  std::vector<icarus::details::ChannelToWireMap::ChannelsInROPStruct> records;
+  for (readout::ROPID const& ropid: data.ROPs)
+    records.push_back(*map.find(ropid));
+
+  unsigned long long sumMap = 0ULL;
+  auto const startMap = Clock_t::now();
+  for (unsigned int i = 0; i < NRepetitions; ++i) {
+    for (readout::ROPID const& ropid: data.ROPs)
+      sumMap += map.find(ropid)->nChannels;
+  } // for
+  auto const stopMap = Clock_t::now();
+
+  unsigned long long sumLinear = 0ULL;
+  auto const startLinear = Clock_t::now();
+  for (unsigned int i = 0; i < NRepetitions; ++i) {
+    for (readout::ROPID const& ropid: data.ROPs) {
+      sumLinear += std::find_if(records.begin(), records.end(),
+        [&ropid](auto const& record){ return record.ropid == ropid; }
+        )->nChannels;
+    }
+  } // for
+  auto const stopLinear = Clock_t::now();
+
+  BOOST_TEST(sumMap == sumLinear);
+
+  double const nLookups = double(NRepetitions) * data.ROPs.size();
+  auto const nsPerLookup = [nLookups](auto duration)
+    {
+      return std::chrono::duration<double, std::nano>(duration).count()
+        / nLookups;
+    };
+  BOOST_TEST_MESSAGE("ROP lookup over " << data.ROPs.size() << " ROPs: "
+    << nsPerLookup(stopMap - startMap) << " ns/lookup (table), "
+    << nsPerLookup(stopLinear - startLinear) << " ns/lookup (linear search)"
+    );
+
+} // ROPlookupBenchmark()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ROPlookupTestCase) {
+  ROPlookupTest();
+  ROPlookupAfterClearTest();
+} // BOOST_AUTO_TEST_CASE(ROPlookupTestCase)
+
+BOOST_AUTO_TEST_CASE(ROPlookupBenchmarkCase) {
+  ROPlookupBenchmark();
+} // BOOST_AUTO_TEST_CASE(ROPlookupBenchmarkCase)
@@ -0,0 +1,120 @@
+/**
+ * @file   GeometryCache_test.cc
+ * @brief  Unit test for the GDML geometry cache utilities.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/GeometryCache.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE GeometryCache
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Geometry/GeometryCache.h"
+
+// ROOT libraries
+#include "TGeoManager.h"
+#include "TGeoVolume.h" // TGeoManager::FindVolumeFast() result
+
+// C/C++ standard libraries
+#include <fstream>
+#include <string>
+#include <cstdio> // std::remove()
+
+
+//------------------------------------------------------------------------------
+/// Writes a minimal GDML file with a world box of the specified half size.
+void writeTestGDML(std::string const& path, double halfSize) {
+  std::ofstream out { path };
+  out << R"(<?xml version="1.0" encoding="UTF-8" ?>
+<gdml>
+  <define/>
+  <materials>
+    <element name="Hydrogen" formula="H" Z="1.">
+      <atom value="1.0079"/>
+    </element>
+    <material name="Vacuum" state="gas">
+      <D value="1e-25"/>
+      <fraction n="1.0" ref="Hydrogen"/>
+    </material>
+  </materials>
+  <solids>
+    <box name="WorldBox" lunit="cm" x=")" << (2.0 * halfSize)
+    << R"(" y="100" z="100"/>
+  </solids>
+  <structure>
+    <volume name="volWorld">
+      <materialref ref="Vacuum"/>
+      <solidref ref="WorldBox"/>
+    </volume>
+  </structure>
+  <setup name="Default" version="1.0">
+    <world ref="volWorld"/>
+  </setup>
+</gdml>
+)";
+} // writeTestGDML()
+
+
+//------------------------------------------------------------------------------
+void GeometryCacheTest() {
+
+  std::string const gdmlPath = "GeometryCache_test.gdml";
+  std::string const cachePath = "GeometryCache_test.root";
+
+  writeTestGDML(gdmlPath, 50.0);
+  std::string const checksum = icarus::geo::fileChecksum(gdmlPath);
+  BOOST_TEST(checksum.size() == 16U);
+  BOOST_TEST(icarus::geo::fileChecksum(gdmlPath) == checksum);
+
+  // no cache yet
+  BOOST_TEST(!icarus::geo::readGeometryCacheInfo(cachePath).valid());
+  BOOST_TEST(!icarus::geo::isGeometryCacheValid(cachePath, gdmlPath));
+
+  TGeoManager* geoManager
+    = icarus::geo::writeGeometryCache(gdmlPath, cachePath);
+  BOOST_TEST(geoManager);
+  BOOST_TEST(geoManager->FindVolumeFast("volWorld"));
+
+  icarus::geo::GeometryCacheInfo const info
+    = icarus::geo::readGeometryCacheInfo(cachePath);
+  BOOST_TEST(info.valid());
+  BOOST_TEST(info.checksum == checksum);
+  BOOST_TEST(info.sourcePath == gdmlPath);
+  BOOST_TEST(icarus::geo::isGeometryCacheValid(cachePath, gdmlPath));
+
+  using icarus::geo::GeometrySource;
+  GeometrySource source = GeometrySource::GDML;
+
+  // the geometry is read back from the cache
+  geoManager = icarus::geo::importGeometry(gdmlPath, cachePath, &source);
+  BOOST_TEST(geoManager);
+  BOOST_TEST(geoManager->FindVolumeFast("volWorld"));
+  BOOST_TEST((source == GeometrySource::Cache));
+
+  // without a cache, the GDML file is parsed
+  source = GeometrySource::Cache;
+  geoManager = icarus::geo::importGeometry(gdmlPath, "", &source);
+  BOOST_TEST(geoManager);
+  BOOST_TEST((source == GeometrySource::GDML));
+
+  // a change in the GDML file invalidates the cache
+  writeTestGDML(gdmlPath, 60.0);
+  BOOST_TEST(icarus::geo::fileChecksum(gdmlPath) != checksum);
+  BOOST_TEST(!icarus::geo::isGeometryCacheValid(cachePath, gdmlPath));
+  source = GeometrySource::Cache;
+  geoManager = icarus::geo::importGeometry(gdmlPath, cachePath, &source);
+  BOOST_TEST(geoManager);
+  BOOST_TEST((source == GeometrySource::GDML));
+
+  std::remove(gdmlPath.c_str());
+  std::remove(cachePath.c_str());
+
+} // GeometryCacheTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(GeometryCacheTestCase) {
+  GeometryCacheTest();
+} // BOOST_AUTO_TEST_CASE(GeometryCacheTestCase)
@@ -0,0 +1,623 @@
+/**
+ * @file   ICARUSChannelMapAlg_test.cxx
+ * @brief  Unit test for the lookup tables of `icarus::ICARUSChannelMapAlg`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/ICARUSChannelMapAlg.h`
+ *
+ * Usage: `ICARUSChannelMapAlg_test  ConfigurationFile`
+ *
+ * The precomputed tables of the channel mapping (readout ID ranges, wire
+ * tables, crossing channels, channel decoder) are compared, on the full
+ * ICARUS geometry, with the results computed from the geometry description.
+ */
+
+// Boost test libraries; defining this symbol tells boost somehow to generate
+// a main() function; Boost is pulled in by boost_unit_test_base.h
+#define BOOST_TEST_MODULE ICARUSChannelMapAlgTest
+
+// ICARUS libraries
+#include "icarusalg/Geometry/ICARUSChannelMapAlg.h"
+#include "icarusalg/Geometry/ChannelDecoder.h"
+#include "test/Geometry/geometry_unit_test_icarus.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/GeometryData.h"
+#include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/WireGeo.h"
+#include "larcorealg/Geometry/Exceptions.h" // geo::InvalidWireError
+#include "larcorealg/TestUtils/boost_unit_test_base.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// framework libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::count(), std::min(), std::includes()
+#include <numeric> // std::iota()
+#include <memory> // std::unique_ptr<>
+#include <set>
+#include <random>
+#include <vector>
+#include <limits> // std::numeric_limits<>
+#include <cmath> // std::abs(), std::round(), std::hypot()
+
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+// the configuration file name is learnt from the command line
+struct IcarusGeometryConfiguration:
+  public testing::BoostCommandLineConfiguration<
+    icarus::testing::IcarusGeometryEnvironmentConfiguration
+      <icarus::ICARUSChannelMapAlg>
+    >
+{
+  /// Constructor: overrides the application name
+  IcarusGeometryConfiguration()
+    { SetApplicationName("ICARUSChannelMapAlgTest"); }
+}; // class IcarusGeometryConfiguration
+
+
+/*
+ * The geometry does not expose its channel mapping object, so the fixture
+ * creates its own one, initialized with a copy of the cryostats from the
+ * geometry. The setup is shared by all the test cases.
+ */
+class ChannelMapTestFixture {
+
+  using Environment_t
+    = testing::GeometryTesterEnvironment<IcarusGeometryConfiguration>;
+
+  struct Setup_t {
+    Environment_t env;
+    geo::GeometryData_t geodata; // must outlive the channel mapping
+    icarus::ICARUSChannelMapAlg channelMap
+      { icarus::ICARUSChannelMapAlg::Parameters{ fhicl::ParameterSet{} } };
+
+    Setup_t()
+      {
+        geo::GeometryCore const& geom = *(env.Geometry());
+        for (unsigned int c = 0; c < geom.Ncryostats(); ++c)
+          geodata.cryostats.push_back(geom.Cryostat(geo::CryostatID{ c }));
+        channelMap.Initialize(geodata);
+      }
+  }; // Setup_t
+
+  static std::unique_ptr<Setup_t> gSetup;
+
+    public:
+
+  ChannelMapTestFixture()
+    { if (!gSetup) gSetup = std::make_unique<Setup_t>(); }
+
+  /// Returns the geometry service provider.
+  static geo::GeometryCore const& Geom() { return *(gSetup->env.Geometry()); }
+
+  /// Returns the channel mapping under test.
+  static icarus::ICARUSChannelMapAlg const& ChannelMap()
+    { return gSetup->channelMap; }
+
+}; // class ChannelMapTestFixture
+
+std::unique_ptr<ChannelMapTestFixture::Setup_t> ChannelMapTestFixture::gSetup;
+
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+template <typename Span>
+auto toVector(Span const& span)
+  { return std::vector(span.begin(), span.end()); }
+
+
+//------------------------------------------------------------------------------
+void ReadoutIDrangesTest
+  (geo::GeometryCore const& geom, icarus::ICARUSChannelMapAlg const& channelMap)
+{
+  /*
+   * `PlaneIDs()` is not supported by this mapping, and `ROPtoWirePlanes()`,
+   * `ROPtoTPCs()` and `TPCsetToTPCs()` are now copies of the same tables as
+   * the ranges: the references are built here from the geometry and from the
+   * per-plane and per-TPC mapping (`WirePlaneToROP()`, `TPCtoTPCset()`);
+   * `FirstWirePlaneInROP()` and `FirstTPCinTPCset()` still use the original
+   * per-ROP and per-TPC set collections, and they check the order.
+   */
+
+  // all the wire planes, sorted
+  std::vector<geo::PlaneID> allPlanes;
+  for (geo::PlaneID const& pid: geom.IteratePlaneIDs())
+    allPlanes.push_back(pid);
+  std::sort(allPlanes.begin(), allPlanes.end());
+  BOOST_TEST(toVector(channelMap.SortedPlaneIDs()) == allPlanes);
+
+  std::size_t nPlanesInROPs = 0U;
+  for (unsigned int c = 0; c < geom.Ncryostats(); ++c) {
+
+    readout::CryostatID const cid { c };
+    auto const nTPCsets = static_cast<readout::TPCsetID::TPCsetID_t>
+      (channelMap.NTPCsets(cid));
+    BOOST_TEST(nTPCsets > 0U);
+
+    for (readout::TPCsetID::TPCsetID_t s = 0; s < nTPCsets; ++s) {
+
+      readout::TPCsetID const sid { cid, s };
+      BOOST_TEST_CONTEXT("TPC set " << sid) {
+
+        std::vector<geo::TPCID> expectedTPCs;
+        for (geo::TPCID const& tpcid: geom.IterateTPCIDs(cid)) {
+          if (channelMap.TPCtoTPCset(tpcid) != sid) continue;
+          expectedTPCs.push_back(tpcid);
+        }
+
+        std::vector<geo::TPCID> const TPCs
+          = toVector(channelMap.TPCsInTPCset(sid));
+        BOOST_TEST(channelMap.TPCsetToTPCs(sid) == TPCs);
+        BOOST_TEST_REQUIRE(!TPCs.empty());
+        BOOST_TEST(TPCs.front() == channelMap.FirstTPCinTPCset(sid));
+        std::vector<geo::TPCID> sortedTPCs = TPCs;
+        std::sort(sortedTPCs.begin(), sortedTPCs.end());
+        BOOST_TEST(sortedTPCs == expectedTPCs);
+
+      } // TPC set context
+
+      auto const nROPs
+        = static_cast<readout::ROPID::ROPID_t>(channelMap.NROPs(sid));
+      BOOST_TEST(nROPs > 0U);
+      for (readout::ROPID::ROPID_t r = 0; r < nROPs; ++r) {
+
+        readout::ROPID const rid { sid, r };
+        BOOST_TEST_CONTEXT("ROP " << rid) {
+
+          std::vector<geo::PlaneID> expectedPlanes;
+          for (geo::PlaneID const& pid: allPlanes) {
+            if (channelMap.WirePlaneToROP(pid) != rid) continue;
+            expectedPlanes.push_back(pid);
+          }
+
+          std::vector<geo::PlaneID> const planes
+            = toVector(channelMap.WirePlanesInROP(rid));
+          BOOST_TEST(channelMap.ROPtoWirePlanes(rid) == planes);
+          BOOST_TEST_REQUIRE(!planes.empty());
+          BOOST_TEST(planes.front() == channelMap.FirstWirePlaneInROP(rid));
+          std::vector<geo::PlaneID> sortedPlanes = planes;
+          std::sort(sortedPlanes.begin(), sortedPlanes.end());
+          BOOST_TEST(sortedPlanes == expectedPlanes);
+          nPlanesInROPs += planes.size();
+
+          // the TPCs of the ROP are the ones of its planes, in the same order
+          std::vector<geo::TPCID> const expectedTPCs
+            (planes.begin(), planes.end());
+          std::vector<geo::TPCID> const TPCs
+            = toVector(channelMap.TPCsInROP(rid));
+          BOOST_TEST(TPCs == expectedTPCs);
+          BOOST_TEST(channelMap.ROPtoTPCs(rid) == TPCs);
+
+        } // ROP context
+
+      } // for ROPs
+
+      // a ROP beyond the last one has no planes nor TPCs
+      readout::ROPID const noROP { sid, nROPs };
+      BOOST_TEST(channelMap.WirePlanesInROP(noROP).empty());
+      BOOST_TEST(channelMap.TPCsInROP(noROP).empty());
+
+    } // for TPC sets
+
+    // a TPC set beyond the last one has no TPCs
+    BOOST_TEST(channelMap.TPCsInTPCset({ cid, nTPCsets }).empty());
+
+  } // for cryostats
+
+  // each plane belongs to exactly one ROP
+  BOOST_TEST(nPlanesInROPs == allPlanes.size());
+
+  // invalid IDs have empty ranges
+  BOOST_TEST(channelMap.WirePlanesInROP(readout::ROPID{}).empty());
+  BOOST_TEST(channelMap.TPCsInROP(readout::ROPID{}).empty());
+  BOOST_TEST(channelMap.TPCsInTPCset(readout::TPCsetID{}).empty());
+  BOOST_TEST(channelMap.ROPtoWirePlanes(readout::ROPID{}).empty());
+  BOOST_TEST(channelMap.ROPtoTPCs(readout::ROPID{}).empty());
+  BOOST_TEST(channelMap.TPCsetToTPCs(readout::TPCsetID{}).empty());
+
+  // the unsorted plane set is still not supported
+  BOOST_CHECK_THROW(channelMap.PlaneIDs(), cet::exception);
+
+} // ReadoutIDrangesTest()
+
+
+//------------------------------------------------------------------------------
+void WireTableTest
+  (geo::GeometryCore const& geom, icarus::ICARUSChannelMapAlg const& channelMap)
+{
+  /*
+   * For each plane, points are randomly picked on the plane, in a frame 20%
+   * larger than the plane itself, so that some of them are outside of it;
+   * the wire table must find the same wire as `geo::PlaneGeo::NearestWireID()`
+   * or `InvalidWire` where the latter throws.
+   * Points too close to the middle between two wires (or to the border of
+   * the plane) are skipped, since rounding may legitimately go either way.
+   */
+  constexpr unsigned int NPoints = 2000U;
+
+  std::mt19937 engine { 20261018 };
+  std::uniform_real_distribution<double> flat { -0.6, +0.6 };
+
+  for (geo::PlaneGeo const& plane: geom.IteratePlanes()) {
+    BOOST_TEST_CONTEXT("Plane " << plane.ID()) {
+
+      icarus::WireTable const& table = channelMap.PlaneWireTable(plane.ID());
+      BOOST_TEST(table.nWires() == plane.Nwires());
+      BOOST_TEST(table.pitch() == plane.WirePitch(),
+        boost::test_tools::tolerance(1e-6));
+
+      geo::Point_t const center = plane.GetCenter();
+      geo::Vector_t const widthDir = plane.GetWidthDirection();
+      geo::Vector_t const depthDir = plane.GetDepthDirection();
+
+      std::vector<double> ys, zs;
+      std::vector<unsigned int> expected;
+      for (unsigned int i = 0; i < NPoints; ++i) {
+        geo::Point_t const point = center
+          + flat(engine) * plane.Width() * widthDir
+          + flat(engine) * plane.Depth() * depthDir;
+
+        double const wireCoord = plane.WireCoordinate(point);
+        if (std::abs(wireCoord - std::round(wireCoord) - 0.5) < 1e-4) continue;
+        if (std::abs(wireCoord - std::round(wireCoord) + 0.5) < 1e-4) continue;
+
+        unsigned int wire = icarus::WireTable::InvalidWire;
+        try { wire = plane.NearestWireID(point).Wire; }
+        catch (geo::InvalidWireError const&) {}
+
+        ys.push_back(point.Y());
+        zs.push_back(point.Z());
+        expected.push_back(wire);
+      } // for points
+      BOOST_TEST(std::count(expected.begin(), expected.end(),
+        icarus::WireTable::InvalidWire) > 0);
+
+      std::vector<unsigned int> wires(ys.size());
+      table.nearestWires(ys, zs, wires);
+      BOOST_TEST(wires == expected, boost::test_tools::per_element());
+
+    } // plane context
+  } // for planes
+
+  // non-existent planes have no table
+  BOOST_CHECK_THROW(channelMap.PlaneWireTable(geo::PlaneID{}), cet::exception);
+  geo::TPCGeo const& TPC = geom.TPC(geo::TPCID{ 0, 0 });
+  BOOST_CHECK_THROW(
+    channelMap.PlaneWireTable(geo::PlaneID{ TPC.ID(), TPC.Nplanes() }),
+    cet::exception
+    );
+
+} // WireTableTest()
+
+
+//------------------------------------------------------------------------------
+/// Returns how far inside both wires their crossing point is on the (y, z)
+/// plane, in centimeters (negative if outside either wire or if parallel).
+double wireCrossingMargin(geo::WireGeo const& wireA, geo::WireGeo const& wireB)
+{
+  geo::Point_t const startA = wireA.GetStart();
+  geo::Point_t const startB = wireB.GetStart();
+  geo::Vector_t const dirA = wireA.GetEnd() - startA;
+  geo::Vector_t const dirB = wireB.GetEnd() - startB;
+
+  // solve `startA + t dirA = startB + u dirB` on the (y, z) plane
+  double const det = dirA.Y() * dirB.Z() - dirA.Z() * dirB.Y();
+  if (det == 0.0) return -std::numeric_limits<double>::infinity();
+  geo::Vector_t const d = startB - startA;
+  double const t = (d.Y() * dirB.Z() - d.Z() * dirB.Y()) / det;
+  double const u = (d.Y() * dirA.Z() - d.Z() * dirA.Y()) / det;
+
+  double const lengthA = std::hypot(dirA.Y(), dirA.Z());
+  double const lengthB = std::hypot(dirB.Y(), dirB.Z());
+  return std::min({
+    t * lengthA, (1.0 - t) * lengthA, u * lengthB, (1.0 - u) * lengthB
+    });
+} // wireCrossingMargin()
+
+
+void CrossingChannelsTest
+  (geo::GeometryCore const& geom, icarus::ICARUSChannelMapAlg const& channelMap)
+{
+  /*
+   * For all the channels, the crossing channel ranges must contain exactly the
+   * channels of the wires from `CrossingWires()`, and the crossing wires must
+   * be on consecutive channels (`computeCrossingChannels()` relies on it).
+   * For the channels and readout planes of the first induction plane (whose
+   * wires are split in two ROPs) and for a sample of the others, the crossing
+   * wires and channels are also compared with all the wire pairs tested by
+   * `geo::GeometryCore::WireIDsIntersect()`. Pairs crossing too close to the
+   * end of either wire are skipped, since rounding may go either way.
+   */
+  constexpr raw::ChannelID_t GeometryStep = 7U;
+  constexpr double EndTolerance = 1e-3; // cm
+
+  // whether the readout plane holds the wires of the first induction plane
+  auto const isFirstInduction = [&channelMap](readout::ROPID const& rid)
+    { return channelMap.FirstWirePlaneInROP(rid).Plane == 0; };
+
+  unsigned int nCrossing = 0U;
+  unsigned int nGeometryChecks = 0U;
+  raw::ChannelID_t const nChannels = channelMap.Nchannels();
+  for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel) {
+    readout::ROPID const channelROP = channelMap.ChannelToROP(channel);
+    readout::TPCsetID const sid = channelROP.asTPCsetID();
+    auto const nROPs
+      = static_cast<readout::ROPID::ROPID_t>(channelMap.NROPs(sid));
+    std::vector<geo::WireID> const channelWires
+      = channelMap.ChannelToWire(channel);
+
+    for (readout::ROPID::ROPID_t r = 0; r < nROPs; ++r) {
+      readout::ROPID const rid { sid, r };
+      BOOST_TEST_CONTEXT("Channel " << channel << " on " << rid) {
+
+        std::vector<icarus::details::ChannelRange_t> const ranges
+          = toVector(channelMap.CrossingChannels(channel, rid));
+
+        // no channel crosses the ones in its own readout plane
+        if (rid == channelROP) BOOST_TEST(ranges.empty());
+        if (!ranges.empty()) ++nCrossing;
+
+        // ranges are sorted, disjoint and all in the readout plane
+        raw::ChannelID_t const firstChannel
+          = channelMap.FirstChannelInROP(rid);
+        raw::ChannelID_t const endChannel
+          = firstChannel + channelMap.Nchannels(rid);
+        std::set<raw::ChannelID_t> channels;
+        for (std::size_t i = 0; i < ranges.size(); ++i) {
+          BOOST_TEST(ranges[i].begin() < ranges[i].end());
+          BOOST_TEST(ranges[i].begin() >= firstChannel);
+          BOOST_TEST(ranges[i].end() <= endChannel);
+          if (i > 0) BOOST_TEST(ranges[i - 1].end() < ranges[i].begin());
+          for (raw::ChannelID_t c = ranges[i].begin(); c < ranges[i].end(); ++c)
+            channels.insert(c);
+        }
+
+        bool const checkGeometry = (channel % GeometryStep == 0)
+          || isFirstInduction(channelROP) || isFirstInduction(rid);
+        if (checkGeometry) ++nGeometryChecks;
+
+        std::set<raw::ChannelID_t> wireChannels; // from `CrossingWires()`
+        std::set<raw::ChannelID_t> geoChannels; // crossing in the geometry
+        std::set<raw::ChannelID_t> endChannels; // crossing near a wire end
+        for (geo::WireID const& wireid: channelWires) {
+          for (geo::PlaneID const& pid: channelMap.WirePlanesInROP(rid)) {
+            BOOST_TEST_CONTEXT("Wire " << wireid << " on " << pid) {
+
+              icarus::WireCrossingTable::WireRange_t const wires
+                = channelMap.CrossingWires(wireid, pid);
+              if (pid.asTPCID() != wireid.asTPCID()) {
+                BOOST_TEST(wires.empty());
+                continue;
+              }
+
+              // crossing wires are on consecutive channels, in either order
+              int step = 0;
+              raw::ChannelID_t prevChannel = raw::InvalidChannelID;
+              for (auto w = wires.first; w < wires.end; ++w) {
+                raw::ChannelID_t const ch
+                  = channelMap.PlaneWireToChannel(geo::WireID{ pid, w });
+                if (w > wires.first) {
+                  int const diff = static_cast<int>(ch)
+                    - static_cast<int>(prevChannel);
+                  if (step == 0) step = diff;
+                  BOOST_TEST(std::abs(diff) == 1);
+                  BOOST_TEST(diff == step);
+                }
+                wireChannels.insert(ch);
+                prevChannel = ch;
+              } // for crossing wires
+
+              if (!checkGeometry) continue;
+
+              geo::WireGeo const& wire = geom.Wire(wireid);
+              unsigned int nMismatches = 0U;
+              unsigned int const nWires = geom.Plane(pid).Nwires();
+              for (unsigned int w = 0; w < nWires; ++w) {
+                geo::WireID const otherID { pid, w };
+                double const margin
+                  = wireCrossingMargin(wire, geom.Wire(otherID));
+                geo::Point_t crossing;
+                bool const crosses
+                  = geom.WireIDsIntersect(wireid, otherID, crossing);
+                raw::ChannelID_t const ch
+                  = channelMap.PlaneWireToChannel(otherID);
+                if (std::abs(margin) < EndTolerance) {
+                  endChannels.insert(ch);
+                  continue;
+                }
+                if (crosses) geoChannels.insert(ch);
+                if (crosses != wires.contains(w)) ++nMismatches;
+              } // for wires in the other plane
+              BOOST_TEST(nMismatches == 0U);
+
+            } // context
+          } // for planes
+        } // for wires of the channel
+
+        // the channel ranges cover exactly the channels of the crossing wires
+        BOOST_TEST(channels == wireChannels);
+
+        // ... which are the ones crossing in the geometry, but for the ones
+        // crossing close to the end of a wire
+        if (checkGeometry) {
+          BOOST_TEST(std::includes(channels.begin(), channels.end(),
+            geoChannels.begin(), geoChannels.end()));
+          for (raw::ChannelID_t const ch: channels) {
+            BOOST_TEST_CONTEXT("crossing channel " << ch) {
+              BOOST_TEST((geoChannels.count(ch) + endChannels.count(ch) > 0U));
+            }
+          } // for
+        } // if check with geometry
+
+      } // context
+    } // for readout planes
+
+    // readout planes in other TPC sets do not cross the channel
+    readout::TPCsetID const otherSet{
+      sid.asCryostatID(),
+      static_cast<readout::TPCsetID::TPCsetID_t>
+        ((sid.TPCset + 1) % channelMap.NTPCsets(sid))
+      };
+    if (otherSet != sid) {
+      BOOST_TEST
+        (channelMap.CrossingChannels(channel, { otherSet, 0 }).empty());
+    }
+    BOOST_TEST(channelMap.CrossingChannels(channel, readout::ROPID{}).empty());
+
+  } // for channels
+  BOOST_TEST(nCrossing > 0U);
+  BOOST_TEST(nGeometryChecks > 0U);
+
+  BOOST_CHECK_THROW(
+    channelMap.CrossingChannels
+      (channelMap.Nchannels(), channelMap.ChannelToROP(0)),
+    cet::exception
+    );
+
+} // CrossingChannelsTest()
+
+
+//------------------------------------------------------------------------------
+void ChannelDecoderTest
+  (geo::GeometryCore const& geom, icarus::ICARUSChannelMapAlg const& channelMap)
+{
+  /*
+   * `ChannelToROP()` and `SignalTypeForChannel()` now read the packed channel
+   * decoder: the references are built from the per-ROP channel ranges
+   * (`FirstChannelInROP()`, `Nchannels(ROPID)`) and checked against the
+   * per-channel lookup (`ChannelToWire()`), all from the channel-to-wire map;
+   * the signal type follows the plane number, as in `findPlaneType()`.
+   */
+  icarus::ChannelDecoder const& decoder = channelMap.channelDecoder();
+
+  raw::ChannelID_t const nChannels = channelMap.Nchannels();
+  BOOST_TEST(decoder.nChannels() == nChannels);
+
+  std::vector<readout::ROPID> expectedROPs(nChannels);
+  std::vector<geo::View_t> expectedViews(nChannels, geo::kUnknown);
+  std::vector<geo::SigType_t> expectedSigTypes(nChannels, geo::kMysteryType);
+  for (unsigned int c = 0; c < geom.Ncryostats(); ++c) {
+
+    readout::CryostatID const cid { c };
+    auto const nTPCsets = static_cast<readout::TPCsetID::TPCsetID_t>
+      (channelMap.NTPCsets(cid));
+    for (readout::TPCsetID::TPCsetID_t s = 0; s < nTPCsets; ++s) {
+
+      readout::TPCsetID const sid { cid, s };
+      auto const nROPs
+        = static_cast<readout::ROPID::ROPID_t>(channelMap.NROPs(sid));
+      for (readout::ROPID::ROPID_t r = 0; r < nROPs; ++r) {
+
+        readout::ROPID const rid { sid, r };
+        geo::PlaneID const pid = channelMap.FirstWirePlaneInROP(rid);
+        geo::View_t const view = geom.Plane(pid).View();
+        geo::SigType_t const sigType
+          = (pid.Plane < 2)? geo::kInduction
+          : (pid.Plane == 2)? geo::kCollection
+          : geo::kMysteryType
+          ;
+
+        raw::ChannelID_t const firstChannel = channelMap.FirstChannelInROP(rid);
+        raw::ChannelID_t const endChannel
+          = firstChannel + channelMap.Nchannels(rid);
+        BOOST_TEST_REQUIRE(endChannel <= nChannels);
+        for (raw::ChannelID_t ch = firstChannel; ch < endChannel; ++ch) {
+          BOOST_TEST(!expectedROPs[ch].isValid); // no overlap between ROPs
+          expectedROPs[ch] = rid;
+          expectedViews[ch] = view;
+          expectedSigTypes[ch] = sigType;
+        }
+
+      } // for ROPs
+    } // for TPC sets
+  } // for cryostats
+
+  for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel) {
+    BOOST_TEST_CONTEXT("Channel " << channel) {
+
+      readout::ROPID const& expectedROP = expectedROPs[channel];
+      BOOST_TEST_REQUIRE(expectedROP.isValid); // all the channels are mapped
+
+      // the lookup by channel agrees with the ranges by ROP
+      for (geo::WireID const& wid: channelMap.ChannelToWire(channel))
+        BOOST_TEST(channelMap.WirePlaneToROP(wid) == expectedROP);
+
+      BOOST_TEST(decoder.hasChannel(channel));
+      BOOST_TEST(decoder.ROP(channel) == expectedROP);
+      BOOST_TEST(decoder.TPCset(channel) == expectedROP.asTPCsetID());
+      BOOST_TEST(decoder.view(channel) == expectedViews[channel]);
+      BOOST_TEST(decoder.signalType(channel) == expectedSigTypes[channel]);
+
+      BOOST_TEST(channelMap.ChannelToROP(channel) == expectedROP);
+      BOOST_TEST
+        (channelMap.SignalTypeForChannel(channel) == expectedSigTypes[channel]);
+
+    } // context
+  } // for channels
+
+  // the batch decoding, including channels which are not mapped
+  std::vector<raw::ChannelID_t> channels(nChannels);
+  std::iota(channels.begin(), channels.end(), raw::ChannelID_t{ 0 });
+  channels.push_back(nChannels);
+  channels.push_back(raw::InvalidChannelID);
+  std::vector<geo::View_t> views(channels.size());
+  std::vector<readout::ROPID> ROPs(channels.size());
+  std::vector<readout::TPCsetID> TPCsets(channels.size());
+  decoder.decode(channels, views, ROPs, TPCsets);
+  for (std::size_t i = 0; i < nChannels; ++i) {
+    BOOST_TEST_CONTEXT("Channel " << channels[i]) {
+      BOOST_TEST(views[i] == expectedViews[i]);
+      BOOST_TEST(ROPs[i] == expectedROPs[i]);
+      BOOST_TEST(TPCsets[i] == expectedROPs[i].asTPCsetID());
+    }
+  } // for
+  for (std::size_t i = nChannels; i < channels.size(); ++i) {
+    BOOST_TEST_CONTEXT("Channel " << channels[i]) {
+      BOOST_TEST(views[i] == geo::kUnknown);
+      BOOST_TEST(!ROPs[i].isValid);
+      BOOST_TEST(!TPCsets[i].isValid);
+
+      BOOST_TEST(!decoder.hasChannel(channels[i]));
+      BOOST_TEST(!channelMap.ChannelToROP(channels[i]).isValid);
+      BOOST_TEST
+        (channelMap.SignalTypeForChannel(channels[i]) == geo::kMysteryType);
+    }
+  } // for
+
+} // ChannelDecoderTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_FIXTURE_TEST_SUITE(ICARUSChannelMapAlgTests, ChannelMapTestFixture)
+
+BOOST_AUTO_TEST_CASE(ReadoutIDrangesTestCase) {
+  ReadoutIDrangesTest(Geom(), ChannelMap());
+} // BOOST_AUTO_TEST_CASE(ReadoutIDrangesTestCase)
+
+BOOST_AUTO_TEST_CASE(WireTableTestCase) {
+  WireTableTest(Geom(), ChannelMap());
+} // BOOST_AUTO_TEST_CASE(WireTableTestCase)
+
+BOOST_AUTO_TEST_CASE(CrossingChannelsTestCase) {
+  CrossingChannelsTest(Geom(), ChannelMap());
+} // BOOST_AUTO_TEST_CASE(CrossingChannelsTestCase)
+
+BOOST_AUTO_TEST_CASE(ChannelDecoderTestCase) {
+  ChannelDecoderTest(Geom(), ChannelMap());
+} // BOOST_AUTO_TEST_CASE(ChannelDecoderTestCase)
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+//------------------------------------------------------------------------------
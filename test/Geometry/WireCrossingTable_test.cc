@@ -0,0 +1,152 @@
+/**
+ * @file   WireCrossingTable_test.cc
+ * @brief  Unit test for `icarus::WireCrossingTable`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/WireCrossingTable.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE WireCrossingTable
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Geometry/WireCrossingTable.h"
+#include "icarusalg/Geometry/WireTable.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <cmath>
+#include <cstddef>
+
+
+//------------------------------------------------------------------------------
+/*
+ * Planes of wires at a given angle from the vertical, cut by a rectangular
+ * frame, described directly by a `icarus::WireTable`.
+ * As in ICARUS, the first induction wires are horizontal and only cover half
+ * of the length of the frame, while the other planes have wires at +/-60
+ * degrees covering all of it.
+ */
+constexpr double FrameHalfHeight = 100.0; // y from -100 to +100 cm
+constexpr double FrameLength = 400.0; // z from 0 to 400 cm
+constexpr double Pitch = 0.3; // cm
+
+
+icarus::WireTable makePlane(double angle, double zMin, double zMax) {
+
+  double const sinA = std::sin(angle), cosA = std::cos(angle);
+  // wire direction (y, z) = (cosA, sinA); normal (y, z) = (-sinA, cosA)
+  double const nY = -sinA, nZ = cosA;
+
+  double cMin = 0.0, cMax = 0.0;
+  for (double const y: { -FrameHalfHeight, FrameHalfHeight }) {
+    for (double const z: { zMin, zMax }) {
+      double const c = y * nY + z * nZ;
+      cMin = std::min(cMin, c);
+      cMax = std::max(cMax, c);
+    }
+  }
+
+  std::vector<icarus::WireTable::WireEnds_t> wires;
+  for (double c = cMin + Pitch / 2.0; c < cMax; c += Pitch) {
+    double tMin = -1e9, tMax = 1e9;
+    auto const clip = [&tMin, &tMax](double p0, double d, double lo, double hi)
+      {
+        if (std::abs(d) < 1e-12) {
+          if ((p0 < lo) || (p0 > hi)) { tMin = 1.0; tMax = 0.0; }
+          return;
+        }
+        double t1 = (lo - p0) / d, t2 = (hi - p0) / d;
+        if (t1 > t2) std::swap(t1, t2);
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+      };
+    clip(c * nY, cosA, -FrameHalfHeight, FrameHalfHeight);
+    clip(c * nZ, sinA, zMin, zMax);
+    if (tMin >= tMax) continue;
+    wires.push_back({
+      c * nY + tMin * cosA, c * nZ + tMin * sinA,
+      c * nY + tMax * cosA, c * nZ + tMax * sinA
+      });
+  } // for
+
+  return { 0.0, wires };
+} // makePlane()
+
+
+//------------------------------------------------------------------------------
+/// Compares the crossing table of `planeA` and `planeB` with all the pairs.
+void checkCrossingTable
+  (icarus::WireTable const& planeA, icarus::WireTable const& planeB)
+{
+  using WireNo_t = icarus::WireTable::WireNo_t;
+
+  icarus::WireCrossingTable const table { planeA, planeB };
+  BOOST_TEST(table.nWires() == planeA.nWires());
+
+  // brute force: test all the wires of B against each wire of A
+  std::vector<WireNo_t> otherWires(planeB.nWires());
+  for (std::size_t i = 0; i < otherWires.size(); ++i) otherWires[i] = i;
+  std::vector<double> y(planeB.nWires()), z(planeB.nWires());
+  std::vector<char> inside(planeB.nWires());
+
+  unsigned int nMismatches = 0U, nCrossings = 0U;
+  for (WireNo_t wire = 0; wire < planeA.nWires(); ++wire) {
+    std::vector<WireNo_t> const wires(planeB.nWires(), wire);
+    planeA.intersections(planeB, wires, otherWires, y, z, inside);
+
+    icarus::WireCrossingTable::WireRange_t const range
+      = table.crossingWires(wire);
+    for (WireNo_t otherWire = 0; otherWire < planeB.nWires(); ++otherWire) {
+      if (range.contains(otherWire) != (inside[otherWire] != 0)) {
+        BOOST_TEST_MESSAGE("Mismatch: A:" << wire << " B:" << otherWire);
+        ++nMismatches;
+      }
+    } // for B
+    nCrossings += range.size();
+  } // for A
+
+  BOOST_TEST(nMismatches == 0U);
+  BOOST_TEST(nCrossings > 0U);
+
+} // checkCrossingTable()
+
+
+//------------------------------------------------------------------------------
+void WireCrossingTableTest() {
+
+  // first induction, split in half along z
+  icarus::WireTable const planeH
+    = makePlane(M_PI / 2.0, 0.0, FrameLength / 2.0);
+  icarus::WireTable const planeU
+    = makePlane(+M_PI / 3.0, 0.0, FrameLength);
+  icarus::WireTable const planeV
+    = makePlane(-M_PI / 3.0, 0.0, FrameLength);
+
+  checkCrossingTable(planeH, planeU);
+  checkCrossingTable(planeU, planeH);
+  checkCrossingTable(planeU, planeV);
+  checkCrossingTable(planeV, planeU);
+
+  // wires of the induction plane beyond the split cross no wire of H
+  icarus::WireCrossingTable const UtoH { planeU, planeH };
+  icarus::WireCrossingTable::WireRange_t const lastRange
+    = UtoH.crossingWires(planeU.nWires() - 1);
+  BOOST_TEST(lastRange.empty());
+
+  // parallel wires never cross
+  icarus::WireCrossingTable const UtoU { planeU, planeU };
+  for (icarus::WireTable::WireNo_t wire = 0; wire < planeU.nWires(); ++wire)
+    BOOST_TEST(UtoU.crossingWires(wire).empty());
+
+  // wires out of the table
+  BOOST_TEST(UtoH.crossingWires(planeU.nWires()).empty());
+
+} // WireCrossingTableTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(WireCrossingTableTestCase) {
+  WireCrossingTableTest();
+} // BOOST_AUTO_TEST_CASE(WireCrossingTableTestCase)
@@ -0,0 +1,220 @@
+/**
+ * @file   WireTable_test.cc
+ * @brief  Unit test for `icarus::WireTable`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Geometry/WireTable.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE WireTable
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Geometry/WireTable.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstddef>
+
+
+//------------------------------------------------------------------------------
+/*
+ * A plane with ICARUS-like induction wires on the y/z plane: wires at `angle`
+ * from the vertical, with the given pitch, cut by a rectangular frame.
+ * The geometry mock-up offers the subset of `geo::PlaneGeo` interface used by
+ * `icarus::WireTable::fromPlane()`.
+ */
+struct Point { double x, y, z; double X() const { return x; }
+  double Y() const { return y; } double Z() const { return z; } };
+
+struct WireMockup {
+  Point start, end;
+  Point GetStart() const { return start; }
+  Point GetEnd() const { return end; }
+}; // WireMockup
+
+struct PlaneMockup {
+  double x = 0.0;
+  std::vector<WireMockup> wires;
+  unsigned int Nwires() const { return wires.size(); }
+  WireMockup const& Wire(unsigned int i) const { return wires.at(i); }
+  Point GetCenter() const { return { x, 0.0, 0.0 }; }
+}; // PlaneMockup
+
+
+constexpr double FrameHalfHeight = 200.0; // y from -200 to +200 cm
+constexpr double FrameLength = 900.0; // z from 0 to 900 cm
+constexpr double Pitch = 0.3; // cm
+
+
+/// Wire planes with wires at `angle` (radians) from the _y_ axis.
+PlaneMockup makePlane(double angle, double x = 0.0) {
+
+  double const sinA = std::sin(angle), cosA = std::cos(angle);
+  // wire direction (y, z) = (cosA, sinA); normal (y, z) = (-sinA, cosA)
+  double const nY = -sinA, nZ = cosA;
+
+  // wire coordinate range covering the frame corners
+  double cMin = 0.0, cMax = 0.0;
+  for (double const y: { -FrameHalfHeight, FrameHalfHeight }) {
+    for (double const z: { 0.0, FrameLength }) {
+      double const c = y * nY + z * nZ;
+      cMin = std::min(cMin, c);
+      cMax = std::max(cMax, c);
+    }
+  }
+
+  PlaneMockup plane;
+  plane.x = x;
+  for (double c = cMin + Pitch / 2.0; c < cMax; c += Pitch) {
+    // intersect the line { c n + t d } with the frame
+    double tMin = -1e9, tMax = 1e9;
+    auto const clip = [&tMin, &tMax](double p0, double d, double lo, double hi)
+      {
+        if (std::abs(d) < 1e-12) {
+          if ((p0 < lo) || (p0 > hi)) { tMin = 1.0; tMax = 0.0; }
+          return;
+        }
+        double t1 = (lo - p0) / d, t2 = (hi - p0) / d;
+        if (t1 > t2) std::swap(t1, t2);
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+      };
+    clip(c * nY, cosA, -FrameHalfHeight, FrameHalfHeight);
+    clip(c * nZ, sinA, 0.0, FrameLength);
+    if (tMin >= tMax) continue;
+    plane.wires.push_back({
+      { x, c * nY + tMin * cosA, c * nZ + tMin * sinA },
+      { x, c * nY + tMax * cosA, c * nZ + tMax * sinA }
+      });
+  } // for
+
+  return plane;
+} // makePlane()
+
+
+//------------------------------------------------------------------------------
+/// Distance in the _y_/_z_ plane between a point and a wire (as a line).
+double distanceFromWire(WireMockup const& wire, double y, double z) {
+  double const dy = wire.end.y - wire.start.y, dz = wire.end.z - wire.start.z;
+  double const length = std::hypot(dy, dz);
+  return std::abs((y - wire.start.y) * dz - (z - wire.start.z) * dy) / length;
+} // distanceFromWire()
+
+
+//------------------------------------------------------------------------------
+void NearestWireTest() {
+
+  PlaneMockup const plane = makePlane(M_PI / 3.0, -100.0);
+  icarus::WireTable const table = icarus::WireTable::fromPlane(plane);
+
+  BOOST_TEST(table.nWires() == plane.Nwires());
+  BOOST_TEST(table.planeX() == -100.0);
+  BOOST_TEST(table.pitch() == Pitch, boost::test_tools::tolerance(1e-6));
+  for (std::size_t i = 0; i < table.nWires(); ++i) {
+    BOOST_TEST(table.wireCoord()[i] == i * Pitch,
+      boost::test_tools::tolerance(1e-6));
+  }
+
+  std::mt19937 engine{ 12345 };
+  std::uniform_real_distribution<double> randomY
+    { -FrameHalfHeight, FrameHalfHeight };
+  std::uniform_real_distribution<double> randomZ{ 0.0, FrameLength };
+
+  constexpr std::size_t NPoints = 5000;
+  std::vector<double> ys, zs;
+  for (std::size_t i = 0; i < NPoints; ++i) {
+    ys.push_back(randomY(engine));
+    zs.push_back(randomZ(engine));
+  }
+  // points beyond the first and the last wires
+  ys.push_back(-FrameHalfHeight - 10.0);
+  zs.push_back(FrameLength + 10.0);
+  ys.push_back(FrameHalfHeight + 10.0);
+  zs.push_back(-10.0);
+
+  std::vector<icarus::WireTable::WireNo_t> wires(ys.size());
+  table.nearestWires(ys, zs, wires);
+
+  for (std::size_t i = 0; i < NPoints; ++i) {
+    BOOST_TEST_CONTEXT("point #" << i << " (" << ys[i] << ", " << zs[i] << ")")
+    {
+      BOOST_TEST_REQUIRE(wires[i] != icarus::WireTable::InvalidWire);
+      // brute force: no other wire is closer
+      double const d = distanceFromWire(plane.Wire(wires[i]), ys[i], zs[i]);
+      BOOST_TEST(d <= Pitch / 2.0 + 1e-6);
+      for (unsigned int const neighbour: { wires[i] - 1, wires[i] + 1 }) {
+        if (neighbour >= plane.Nwires()) continue;
+        BOOST_TEST
+          (distanceFromWire(plane.Wire(neighbour), ys[i], zs[i]) >= d - 1e-6);
+      }
+    }
+  } // for
+  BOOST_TEST(wires[NPoints] == icarus::WireTable::InvalidWire);
+  BOOST_TEST(wires[NPoints + 1] == icarus::WireTable::InvalidWire);
+
+} // NearestWireTest()
+
+
+//------------------------------------------------------------------------------
+void IntersectionTest() {
+
+  PlaneMockup const planeU = makePlane(+M_PI / 3.0);
+  PlaneMockup const planeV = makePlane(-M_PI / 3.0);
+  PlaneMockup const planeW = makePlane(0.0); // vertical wires
+  icarus::WireTable const tableU = icarus::WireTable::fromPlane(planeU);
+  icarus::WireTable const tableV = icarus::WireTable::fromPlane(planeV);
+  icarus::WireTable const tableW = icarus::WireTable::fromPlane(planeW);
+
+  std::mt19937 engine{ 54321 };
+  std::uniform_int_distribution<unsigned int> randomU{ 0, planeU.Nwires() - 1 };
+  std::uniform_int_distribution<unsigned int> randomV{ 0, planeV.Nwires() - 1 };
+
+  constexpr std::size_t NPairs = 2000;
+  std::vector<icarus::WireTable::WireNo_t> wiresU, wiresV;
+  for (std::size_t i = 0; i < NPairs; ++i) {
+    wiresU.push_back(randomU(engine));
+    wiresV.push_back(randomV(engine));
+  }
+
+  std::vector<double> ys(NPairs), zs(NPairs);
+  std::vector<char> inside(NPairs);
+  tableU.intersections(tableV, wiresU, wiresV, ys, zs, inside);
+
+  unsigned int nInside = 0;
+  for (std::size_t i = 0; i < NPairs; ++i) {
+    BOOST_TEST_CONTEXT("U:" << wiresU[i] << " V:" << wiresV[i]) {
+      WireMockup const& wireU = planeU.Wire(wiresU[i]);
+      WireMockup const& wireV = planeV.Wire(wiresV[i]);
+      // the crossing point lies on both wires
+      BOOST_TEST(distanceFromWire(wireU, ys[i], zs[i]) < 1e-6);
+      BOOST_TEST(distanceFromWire(wireV, ys[i], zs[i]) < 1e-6);
+      // and it is inside if it is in the frame
+      bool const inFrame = (std::abs(ys[i]) <= FrameHalfHeight + 1e-4)
+        && (zs[i] >= -1e-4) && (zs[i] <= FrameLength + 1e-4);
+      BOOST_TEST((inside[i] != 0) == inFrame);
+      if (inside[i]) ++nInside;
+    }
+  } // for
+  BOOST_TEST(nInside > 0U);
+  BOOST_TEST(nInside < NPairs);
+
+  // parallel wires do not cross
+  std::vector<icarus::WireTable::WireNo_t> const wire0 { 0U }, wire1 { 1U };
+  std::vector<double> y(1), z(1);
+  std::vector<char> in(1, 1);
+  tableW.intersections(tableW, wire0, wire1, y, z, in);
+  BOOST_TEST(!in[0]);
+  BOOST_TEST(std::isnan(y[0]));
+
+} // IntersectionTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(WireTableTestCase) {
+  NearestWireTest();
+  IntersectionTest();
+} // BOOST_AUTO_TEST_CASE(WireTableTestCase)
@@ -20,6 +20,7 @@
 #include "larcorealg/CoreUtils/enumerate.h"
 
 // C/C++ standard libraries
+#include <algorithm> // std::count()
 #include <map>
 #include <vector>
 #include <any>
@@ -474,6 +475,283 @@ void AssnsCrosserDiamond_test() {
 } // AssnsCrosserDiamond_test()
 
 
+//------------------------------------------------------------------------------
+testing::mockup::Event makeDiamondsTestEvent() {
+  
+  std::vector<DataTypeA> dataA { DataTypeA{ 10 }, DataTypeA{ 11 } };
+  std::vector<DataTypeB> dataB
+    { DataTypeB{ 20 }, DataTypeB{ 21 }, DataTypeB{ 22 } };
+  std::vector<DataTypeC> dataC { DataTypeC{ 30 }, DataTypeC{ 31 } };
+  std::vector<DataTypeD> dataD { DataTypeD{ 40 } };
+  
+  testing::mockup::Event event;
+  
+  event.put(std::move(dataA), art::InputTag{ "A" });
+  event.put(std::move(dataB), art::InputTag{ "B" });
+  event.put(std::move(dataC), art::InputTag{ "C" });
+  event.put(std::move(dataD), art::InputTag{ "D" });
+  
+  testing::mockup::PtrMaker<DataTypeA> makeAptr{ event, art::InputTag{ "A" } };
+  testing::mockup::PtrMaker<DataTypeB> makeBptr{ event, art::InputTag{ "B" } };
+  testing::mockup::PtrMaker<DataTypeC> makeCptr{ event, art::InputTag{ "C" } };
+  testing::mockup::PtrMaker<DataTypeD> makeDptr{ event, art::InputTag{ "D" } };
+  
+  /*
+   * The plan:
+   *  A[0] <=> B[0], B[1]
+   *  A[1] <=> B[1], B[2]  (B[1] is shared)
+   * 
+   *  B[0] <=> C[0]
+   *  B[1] <=> C[0], C[1]
+   *  B[2] <=> C[1]
+   * 
+   *  C[0] <=> D[0]
+   *  C[1] <=> D[0]
+   * 
+   *  A[0] <=> C[0] (2 paths), C[1] (1 path) <=> D[0] (3 paths)
+   *  A[1] <=> C[0] (1 path), C[1] (2 paths) <=> D[0] (3 paths)
+   */
+  art::Assns<DataTypeA, DataTypeB> assnsAB;
+  assnsAB.addSingle(makeAptr(0), makeBptr(0));
+  assnsAB.addSingle(makeAptr(0), makeBptr(1));
+  assnsAB.addSingle(makeAptr(1), makeBptr(1));
+  assnsAB.addSingle(makeAptr(1), makeBptr(2));
+  event.put(std::move(assnsAB), art::InputTag{ "B" });
+  
+  art::Assns<DataTypeB, DataTypeC> assnsBC;
+  assnsBC.addSingle(makeBptr(0), makeCptr(0));
+  assnsBC.addSingle(makeBptr(1), makeCptr(0));
+  assnsBC.addSingle(makeBptr(1), makeCptr(1));
+  assnsBC.addSingle(makeBptr(2), makeCptr(1));
+  event.put(std::move(assnsBC), art::InputTag{ "C" });
+  
+  art::Assns<DataTypeC, DataTypeD> assnsCD;
+  assnsCD.addSingle(makeCptr(0), makeDptr(0));
+  assnsCD.addSingle(makeCptr(1), makeDptr(0));
+  event.put(std::move(assnsCD), art::InputTag{ "D" });
+  
+  return event;
+} // makeDiamondsTestEvent()
+
+
+//------------------------------------------------------------------------------
+template <typename Crosser>
+std::map<typename Crosser::TargetPtr_t, std::size_t> collectPaths
+  (Crosser const& crosser, typename Crosser::KeyPtr_t const& keyPtr)
+{
+  // returns the number of paths for each target, from duplicates or counts
+  auto const& targets = crosser.assPtrs(keyPtr);
+  auto const& counts = crosser.pathCounts(keyPtr);
+  BOOST_TEST((counts.empty() || (counts.size() == targets.size())));
+  
+  std::map<typename Crosser::TargetPtr_t, std::size_t> paths;
+  for (std::size_t i = 0; i < targets.size(); ++i)
+    paths[targets[i]] += counts.empty()? 1: counts[i];
+  return paths;
+} // collectPaths()
+
+
+void AssnsCrosserDuplicates_test() {
+  /*
+   * Test of the treatment of the same target reached via different paths.
+   * 
+   * See `makeDiamondsTestEvent()` for the plan.
+   */
+  
+  using icarus::ns::util::AssnsCrosserOptions, icarus::ns::util::startFrom,
+    icarus::ns::util::hopTo;
+  using Duplicates = AssnsCrosserOptions::Duplicates;
+  
+  testing::mockup::Event const event = makeDiamondsTestEvent();
+  
+  testing::mockup::PtrMaker<DataTypeA> makeAptr{ event, art::InputTag{ "A" } };
+  testing::mockup::PtrMaker<DataTypeC> makeCptr{ event, art::InputTag{ "C" } };
+  testing::mockup::PtrMaker<DataTypeD> makeDptr{ event, art::InputTag{ "D" } };
+  
+  std::map<art::Ptr<DataTypeC>, std::size_t> const expectedA0toC
+    { { makeCptr(0), 2 }, { makeCptr(1), 1 } };
+  std::map<art::Ptr<DataTypeC>, std::size_t> const expectedA1toC
+    { { makeCptr(0), 1 }, { makeCptr(1), 2 } };
+  std::map<art::Ptr<DataTypeD>, std::size_t> const expectedAtoD
+    { { makeDptr(0), 3 } };
+  
+  BOOST_TEST_CONTEXT("Duplicates kept") {
+    icarus::ns::util::AssnsCrosser const AtoC{ event
+      , startFrom<DataTypeA>{}, hopTo<DataTypeB>{ "B" }, hopTo<DataTypeC>{ "C" }
+      };
+    
+    BOOST_TEST(AtoC.assPtrs(makeAptr(0)).size() == 3);
+    BOOST_TEST(AtoC.pathCounts(makeAptr(0)).empty());
+    BOOST_TEST((collectPaths(AtoC, makeAptr(0)) == expectedA0toC));
+    BOOST_TEST(AtoC.assPtrs(makeAptr(1)).size() == 3);
+    BOOST_TEST((collectPaths(AtoC, makeAptr(1)) == expectedA1toC));
+  }
+  
+  BOOST_TEST_CONTEXT("Duplicates removed") {
+    icarus::ns::util::AssnsCrosser const AtoC{ event
+      , AssnsCrosserOptions{ Duplicates::remove }
+      , startFrom<DataTypeA>{}, hopTo<DataTypeB>{ "B" }, hopTo<DataTypeC>{ "C" }
+      };
+    
+    for (std::size_t iA: { 0U, 1U }) {
+      BOOST_TEST_CONTEXT("A[" << iA << "]") {
+        auto const& Cs = AtoC.assPtrs(makeAptr(iA));
+        BOOST_TEST(Cs.size() == 2);
+        BOOST_TEST(std::count(Cs.begin(), Cs.end(), makeCptr(0)) == 1);
+        BOOST_TEST(std::count(Cs.begin(), Cs.end(), makeCptr(1)) == 1);
+        BOOST_TEST(AtoC.pathCounts(makeAptr(iA)).empty());
+      }
+    } // for
+  }
+  
+  BOOST_TEST_CONTEXT("Paths counted") {
+    auto const AtoC = icarus::ns::util::makeAssnsCrosser<DataTypeA>(event
+      , AssnsCrosserOptions{ Duplicates::count }
+      , startFrom<DataTypeA>{}, hopTo<DataTypeB>{ "B" }, hopTo<DataTypeC>{ "C" }
+      );
+    
+    BOOST_TEST(AtoC.assPtrs(makeAptr(0)).size() == 2);
+    BOOST_TEST((collectPaths(AtoC, makeAptr(0)) == expectedA0toC));
+    BOOST_TEST(AtoC.assPtrs(makeAptr(1)).size() == 2);
+    BOOST_TEST((collectPaths(AtoC, makeAptr(1)) == expectedA1toC));
+  }
+  
+  BOOST_TEST_CONTEXT("Paths counted over three hops (forward)") {
+    icarus::ns::util::AssnsCrosser const AtoD{ event
+      , AssnsCrosserOptions{ Duplicates::count }
+      , startFrom<DataTypeA>{}
+      , hopTo<DataTypeB>{ "B" }, hopTo<DataTypeC>{ "C" }, hopTo<DataTypeD>{ "D" }
+      };
+    
+    BOOST_TEST((collectPaths(AtoD, makeAptr(0)) == expectedAtoD));
+    BOOST_TEST((collectPaths(AtoD, makeAptr(1)) == expectedAtoD));
+  }
+  
+  BOOST_TEST_CONTEXT("Paths counted over three hops (backward)") {
+    icarus::ns::util::AssnsCrosser const AtoD{ event
+      , AssnsCrosserOptions{ Duplicates::count }
+      , startFrom<DataTypeA>{}
+      , hopTo<DataTypeB>{}, hopTo<DataTypeC>{ "C" }, hopTo<DataTypeD>{ "D" }
+      };
+    
+    BOOST_TEST((collectPaths(AtoD, makeAptr(0)) == expectedAtoD));
+    BOOST_TEST((collectPaths(AtoD, makeAptr(1)) == expectedAtoD));
+  }
+  
+  BOOST_TEST_CONTEXT("Duplicate associations in a single hop") {
+    testing::mockup::Event event;
+    event.put(std::vector<DataTypeA>{ DataTypeA{ 10 } }, art::InputTag{ "A" });
+    event.put(std::vector<DataTypeB>{ DataTypeB{ 20 } }, art::InputTag{ "B" });
+    testing::mockup::PtrMaker<DataTypeA> makeAptr{ event, "A" };
+    testing::mockup::PtrMaker<DataTypeB> makeBptr{ event, "B" };
+    art::Assns<DataTypeA, DataTypeB> assnsAB;
+    assnsAB.addSingle(makeAptr(0), makeBptr(0));
+    assnsAB.addSingle(makeAptr(0), makeBptr(0));
+    event.put(std::move(assnsAB), art::InputTag{ "B" });
+    
+    icarus::ns::util::AssnsCrosser const AtoB{ event
+      , AssnsCrosserOptions{ Duplicates::count }
+      , startFrom<DataTypeA>{}, hopTo<DataTypeB>{ "B" }
+      };
+    
+    BOOST_TEST(AtoB.assPtrs(makeAptr(0)).size() == 1);
+    BOOST_TEST(AtoB.pathCounts(makeAptr(0)).size() == 1);
+    BOOST_TEST(AtoB.assPtr(makeAptr(0)) == makeBptr(0));
+    BOOST_TEST(AtoB.pathCounts(makeAptr(0)).front() == 2);
+  }
+  
+} // AssnsCrosserDuplicates_test()
+
+
+//------------------------------------------------------------------------------
+testing::mockup::Event makeLargeTestEvent() {
+  /*
+   * Many keys, each associated to a few B, each associated to a few C
+   * (and C to D), with plenty of shared objects and multiple paths.
+   */
+  constexpr std::size_t NA = 2000, NB = 5000, NC = 3000, ND = 500;
+  
+  testing::mockup::Event event;
+  event.put(std::vector<DataTypeA>(NA), art::InputTag{ "A" });
+  event.put(std::vector<DataTypeB>(NB), art::InputTag{ "B" });
+  event.put(std::vector<DataTypeC>(NC), art::InputTag{ "C" });
+  event.put(std::vector<DataTypeD>(ND), art::InputTag{ "D" });
+  
+  testing::mockup::PtrMaker<DataTypeA> makeAptr{ event, art::InputTag{ "A" } };
+  testing::mockup::PtrMaker<DataTypeB> makeBptr{ event, art::InputTag{ "B" } };
+  testing::mockup::PtrMaker<DataTypeC> makeCptr{ event, art::InputTag{ "C" } };
+  testing::mockup::PtrMaker<DataTypeD> makeDptr{ event, art::InputTag{ "D" } };
+  
+  art::Assns<DataTypeA, DataTypeB> assnsAB;
+  for (std::size_t iA = 0; iA < NA; ++iA)
+    for (std::size_t k = 0; k < 4; ++k)
+      assnsAB.addSingle(makeAptr(iA), makeBptr((iA * 3 + k * 7) % NB));
+  event.put(std::move(assnsAB), art::InputTag{ "B" });
+  
+  art::Assns<DataTypeB, DataTypeC> assnsBC;
+  for (std::size_t iB = 0; iB < NB; ++iB)
+    for (std::size_t k = 0; k < 3; ++k)
+      assnsBC.addSingle(makeBptr(iB), makeCptr((iB * 5 + k * 11) % NC));
+  event.put(std::move(assnsBC), art::InputTag{ "C" });
+  
+  art::Assns<DataTypeC, DataTypeD> assnsCD;
+  for (std::size_t iC = 0; iC < NC; ++iC)
+    for (std::size_t k = 0; k < 2; ++k)
+      assnsCD.addSingle(makeCptr(iC), makeDptr((iC + k * 13) % ND));
+  event.put(std::move(assnsCD), art::InputTag{ "D" });
+  
+  return event;
+} // makeLargeTestEvent()
+
+
+void AssnsCrosserParallel_test() {
+  /*
+   * The result of the parallel expansion must match the serial one exactly.
+   */
+  
+  using icarus::ns::util::AssnsCrosserOptions, icarus::ns::util::startFrom,
+    icarus::ns::util::hopTo;
+  using Duplicates = AssnsCrosserOptions::Duplicates;
+  
+  testing::mockup::Event const event = makeLargeTestEvent();
+  auto const& dataA
+    = event.getProduct<std::vector<DataTypeA>>(art::InputTag{ "A" });
+  testing::mockup::PtrMaker<DataTypeA> makeAptr{ event, art::InputTag{ "A" } };
+  
+  for (Duplicates const duplicates
+    : { Duplicates::keep, Duplicates::remove, Duplicates::count }
+  ) {
+    BOOST_TEST_CONTEXT("Duplicates option #" << static_cast<int>(duplicates))
+    {
+      auto makeAtoD = [&event](AssnsCrosserOptions const& options)
+        {
+          return icarus::ns::util::AssnsCrosser{ event
+            , options
+            , startFrom<DataTypeA>{}
+            , hopTo<DataTypeB>{ "B" }
+            , hopTo<DataTypeC>{ "C" }
+            , hopTo<DataTypeD>{ "D" }
+            };
+        };
+      
+      auto const serial = makeAtoD(AssnsCrosserOptions{ duplicates, 1U });
+      auto const parallel = makeAtoD(AssnsCrosserOptions{ duplicates, 4U });
+      
+      std::size_t nMismatches = 0;
+      for (std::size_t iA = 0; iA < dataA.size(); ++iA) {
+        art::Ptr<DataTypeA> const Aptr = makeAptr(iA);
+        if (serial.assPtrs(Aptr).empty()) ++nMismatches;
+        if (serial.assPtrs(Aptr) != parallel.assPtrs(Aptr)) ++nMismatches;
+        if (serial.pathCounts(Aptr) != parallel.pathCounts(Aptr))
+          ++nMismatches;
+      } // for
+      BOOST_TEST(nMismatches == 0U);
+    } // context
+  } // for duplicates
+  
+} // AssnsCrosserParallel_test()
+
+
 //------------------------------------------------------------------------------
 void AssnsCrosser3check(
   testing::mockup::Event const& event,
@@ -1073,6 +1351,20 @@ BOOST_AUTO_TEST_CASE( AssnsCrosser2_testCase ) {
 } // BOOST_AUTO_TEST_CASE( AssnsCrosser2_testCase )
 
 
+BOOST_AUTO_TEST_CASE( AssnsCrosserDuplicates_testCase ) {
+  
+  AssnsCrosserDuplicates_test();
+  
+} // BOOST_AUTO_TEST_CASE( AssnsCrosserDuplicates_testCase )
+
+
+BOOST_AUTO_TEST_CASE( AssnsCrosserParallel_testCase ) {
+  
+  AssnsCrosserParallel_test();
+  
+} // BOOST_AUTO_TEST_CASE( AssnsCrosserParallel_testCase )
+
+
 BOOST_AUTO_TEST_CASE( AssnsCrosser3_testCase ) {
   
   AssnsCrosser3_test();
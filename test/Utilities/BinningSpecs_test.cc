@@ -15,6 +15,11 @@
 // ICARUS libraries
 #include "icarusalg/Utilities/BinningSpecs.h"
 
+// C/C++ standard libraries
+#include <random>
+#include <vector>
+#include <cmath> // std::pow()
+
 
 // -----------------------------------------------------------------------------
 void BinningSpecs_NBinsFor_test() {
@@ -304,6 +309,70 @@ void makeBinningFromNBins_nohint_test() {
 } // makeBinningFromNBins_nohint_test()
 
 
+//------------------------------------------------------------------------------
+void checkBinningsFromNBins(
+  std::vector<icarus::ns::util::BinningRequest> const& requests,
+  std::initializer_list<double> hints
+) {
+  
+  using icarus::ns::util::BinningRequest;
+  using icarus::ns::util::BinningSpecs;
+  
+  std::vector<BinningSpecs> const binnings
+    = icarus::ns::util::makeBinningsFromNBins(requests, hints);
+  
+  BOOST_TEST(binnings.size() == requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    BinningRequest const& request = requests[i];
+    BinningSpecs const expected = icarus::ns::util::makeBinningFromNBins
+      (request.lower, request.upper, request.nBins, hints);
+    BOOST_TEST_CONTEXT("request #" << i << " [ " << request.lower << " ; "
+      << request.upper << " ] in " << request.nBins << " bins"
+    ) {
+      // exact comparison: the results must be identical
+      BOOST_TEST(binnings[i].lower() == expected.lower());
+      BOOST_TEST(binnings[i].upper() == expected.upper());
+      BOOST_TEST(binnings[i].nBins() == expected.nBins());
+      BOOST_TEST(binnings[i].binWidth() == expected.binWidth());
+    }
+  } // for
+  
+} // checkBinningsFromNBins()
+
+
+void makeBinningsFromNBins_test() {
+  
+  std::vector<icarus::ns::util::BinningRequest> requests {
+    { -5.0, 8.0, 7UL },   // from the single binning tests
+    { -1.0, 3.0, 9UL },
+    {  0.0, 10.0, 10UL }, // bin width exactly a power of ten
+    {  0.0, 1.0, 10UL },  // bin width 0.1
+    {  0.0, 1.0, 1000UL },
+    {  0.0, 0.999999999999999, 1UL }, // just below a power of ten
+    {  0.0, 1.000000000000001, 1UL }, // just above a power of ten
+    { -1e-12, 1e-12, 7UL },
+    { 0.0, 4.0e9, 360UL },
+  };
+  
+  std::mt19937 engine { 1234 };
+  std::uniform_real_distribution<double> logRange { -8.0, 8.0 };
+  std::uniform_real_distribution<double> offset { -2.0, 2.0 };
+  std::uniform_int_distribution<unsigned long> nBins { 1UL, 2000UL };
+  for (int i = 0; i < 50000; ++i) {
+    double const range = std::pow(10.0, logRange(engine));
+    double const lower = offset(engine) * range;
+    requests.push_back({ lower, lower + range, nBins(engine) });
+  }
+  
+  checkBinningsFromNBins(requests, icarus::ns::util::DefaultBinningHints);
+  checkBinningsFromNBins(requests, { 1.0, 1.5 });
+  checkBinningsFromNBins(requests, {});
+  
+  BOOST_TEST(icarus::ns::util::makeBinningsFromNBins({}).empty());
+  
+} // makeBinningsFromNBins_test()
+
+
 //------------------------------------------------------------------------------
 //---  The tests
 //---
@@ -339,4 +408,11 @@ BOOST_AUTO_TEST_CASE( makeBinningFromNBins_testCase ) {
 } // BOOST_AUTO_TEST_CASE( makeBinningFromNBins_testCase )
 
 
+BOOST_AUTO_TEST_CASE( makeBinningsFromNBins_testCase ) {
+  
+  makeBinningsFromNBins_test();
+  
+} // BOOST_AUTO_TEST_CASE( makeBinningsFromNBins_testCase )
+
+
 //------------------------------------------------------------------------------
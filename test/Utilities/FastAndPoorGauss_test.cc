@@ -24,6 +24,12 @@
 #include "TF1.h"
 #include "TFitResult.h"
 
+// C/C++ standard libraries
+#include <vector>
+#include <random>
+#include <limits>
+#include <cstdint>
+
 
 //------------------------------------------------------------------------------
 template <std::size_t NSamples>
@@ -68,6 +74,53 @@ void Test(TFile* pFile = nullptr, bool statChecks = true) {
 } // void Test()
 
 
+//------------------------------------------------------------------------------
+template <std::size_t NSamples, typename UInt>
+void TestWords() {
+  
+  constexpr unsigned int NWords = 10'000U;
+  constexpr unsigned int WordBits = std::numeric_limits<UInt>::digits;
+  
+  util::FastAndPoorGauss<NSamples> gauss;
+  util::GaussianTransformer<double> const target { 5.0, 2.0 };
+  BOOST_TEST_MESSAGE("Testing sampling " << NSamples << " points from "
+    << WordBits << "-bit words.");
+  
+  // words include the extremes
+  std::mt19937_64 engine { 314159U };
+  std::uniform_int_distribution<UInt> flat;
+  std::vector<UInt> words { 0U, std::numeric_limits<UInt>::max() };
+  while (words.size() < NWords) words.push_back(flat(engine));
+  
+  gsl::span<UInt const> const input { words };
+  std::vector<double> z(NWords), x(NWords);
+  std::vector<float> zf(NWords + 3); // longer than the input
+  BOOST_CHECK_EQUAL
+    (gauss.transformWords(input, gsl::span<double>{ z }), NWords);
+  BOOST_CHECK_EQUAL
+    (gauss.transformWords(input, gsl::span<double>{ x }, target), NWords);
+  BOOST_CHECK_EQUAL
+    (gauss.transformWords(input, gsl::span<float>{ zf }), NWords);
+  
+  constexpr unsigned int NBits = util::FastAndPoorGauss<NSamples>::NBits;
+  for (std::size_t i = 0; i < NWords; ++i) {
+    // the word w maps as u = w / 2^WordBits, that is into the sample from its
+    // NBits highest bits; here u is picked in the middle of that sample step
+    UInt const word = words[i];
+    std::size_t index = 0U;
+    if constexpr (NBits > 0) index = word >> (WordBits - NBits);
+    double const expected = gauss((index + 0.5) / NSamples);
+    BOOST_TEST_CONTEXT("word #" << i << ": " << word) {
+      BOOST_CHECK_EQUAL(gauss.transformWord(word), expected);
+      BOOST_CHECK_EQUAL(z[i], expected);
+      BOOST_CHECK_EQUAL(x[i], target(expected));
+      BOOST_CHECK_EQUAL(zf[i], static_cast<float>(expected));
+    }
+  } // for
+  
+} // TestWords()
+
+
 //------------------------------------------------------------------------------
 //---  The tests
 //---
@@ -90,3 +143,13 @@ BOOST_AUTO_TEST_CASE( TestCase ) {
   
 } // BOOST_AUTO_TEST_CASE( TestCase )
 
+
+BOOST_AUTO_TEST_CASE( WordTestCase ) {
+  
+  TestWords<  1024U, std::uint32_t>();
+  TestWords< 32768U, std::uint32_t>();
+  TestWords< 32768U, std::uint64_t>();
+  TestWords<     1U, std::uint16_t>();
+  
+} // BOOST_AUTO_TEST_CASE( WordTestCase )
+
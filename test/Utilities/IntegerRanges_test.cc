@@ -21,6 +21,10 @@
 #include <iostream>
 #include <utility> // std::pair<>
 #include <array>
+#include <vector>
+#include <algorithm> // std::sort(), std::shuffle()
+#include <random>
+#include <limits>
 #include <type_traits> // std::is_same_v, std::remove_reference_t
 
 
@@ -230,6 +234,111 @@ void TestUnsorted() {
 } // TestDuplicates()
 
 
+// -----------------------------------------------------------------------------
+/// Checks that `ranges` has the same ranges as `expected`.
+template <typename T, bool CheckGrowingA, bool CheckGrowingB>
+void CheckSameRanges(
+  icarus::IntegerRanges<T, CheckGrowingA> const& ranges,
+  icarus::IntegerRanges<T, CheckGrowingB> const& expected
+) {
+  
+  BOOST_CHECK_EQUAL(ranges.size(), expected.size());
+  BOOST_REQUIRE_EQUAL(ranges.nRanges(), expected.nRanges());
+  
+  for (auto const& [ i, r, e ]: util::enumerate(ranges.ranges(), expected.ranges()))
+  {
+    BOOST_TEST_MESSAGE("[" << i << "]");
+    BOOST_CHECK_EQUAL(r.lower, e.lower);
+    BOOST_CHECK_EQUAL(r.upper, e.upper);
+  } // for
+  
+} // CheckSameRanges()
+
+
+/// Checks the unsorted construction from `values` against the sorted one.
+template <typename T>
+void CheckUnsortedAgainstSorted
+  (std::vector<T> const& values, unsigned int nThreads = 1U)
+{
+  std::vector<T> sorted { values };
+  std::sort(sorted.begin(), sorted.end());
+  icarus::IntegerRanges<T, true> const expected
+    { sorted.begin(), sorted.end() };
+  
+  icarus::IntegerRanges<T> const ranges
+    { icarus::unsorted, values.begin(), values.end(), nThreads };
+  
+  CheckSameRanges(ranges, expected);
+  
+} // CheckUnsortedAgainstSorted()
+
+
+// -----------------------------------------------------------------------------
+void TestUnsortedConstruction() {
+  
+  // the example from the documentation
+  std::vector<int> const data { 8, 4, 10, 2, 6, 5, 1, 4 };
+  icarus::IntegerRanges<int> const ranges
+    { icarus::unsorted, data.begin(), data.end() };
+  std::cout << "Testing: " << ranges << std::endl;
+  CheckSameRanges(ranges, icarus::IntegerRanges<int>{ 1, 2, 4, 5, 6, 8, 10 });
+  
+  // empty input
+  std::vector<int> const empty;
+  BOOST_CHECK(icarus::makeIntegerRangesFromUnsorted(empty).empty());
+  
+  // duplicates and negative numbers (dense: bitmap)
+  CheckUnsortedAgainstSorted<int>({ 3, -2, 3, -1, -5, 0, -5, 11, 10, 3, -2 });
+  
+  // sparse values (radix sort), including the extremes of the type
+  CheckUnsortedAgainstSorted<long>({
+    1'000'000'000L, -7L, std::numeric_limits<long>::min(),
+    -6L, 1'000'000'001L, 42L, std::numeric_limits<long>::max() - 1, -7L
+    });
+  
+  // unsigned type with a small domain
+  CheckUnsortedAgainstSorted<unsigned short>({ 9, 3, 4, 65535, 3, 0, 5 });
+  
+  // random content, both dense and sparse, large enough for radix sort
+  std::mt19937 engine { 12345U };
+  for (int const span: { 100, 10'000, 100'000'000 }) {
+    std::uniform_int_distribution<int> dist { -span / 2, span / 2 };
+    std::vector<int> values(20'000);
+    for (int& value: values) value = dist(engine);
+    BOOST_TEST_MESSAGE("Random values in a span of " << span);
+    CheckUnsortedAgainstSorted(values);
+  } // for
+  
+} // TestUnsortedConstruction()
+
+
+// -----------------------------------------------------------------------------
+void TestParallelUnsortedConstruction() {
+  
+  // a shuffled list of sequences long enough to be split among threads
+  std::vector<int> values;
+  for (int start = -1'000'000; start < 1'000'000; start += 1'000)
+    for (int value = start; value < start + 700; ++value)
+      values.push_back(value);
+  values.insert(values.end(), values.begin(), values.begin() + 50'000);
+  std::mt19937 engine { 67890U };
+  std::shuffle(values.begin(), values.end(), engine);
+  
+  auto const ranges = icarus::makeIntegerRangesFromUnsorted(values, 4U);
+  BOOST_CHECK_EQUAL(ranges.nRanges(), 2'000U);
+  BOOST_CHECK_EQUAL(ranges.size(), 2'000U * 700U);
+  
+  CheckUnsortedAgainstSorted(values, 4U);
+  
+  // sparse values (the chunks are sorted and merged)
+  std::uniform_int_distribution<int> dist;
+  std::vector<int> sparse(300'000);
+  for (int& value: sparse) value = dist(engine);
+  CheckUnsortedAgainstSorted(sparse, 3U);
+  
+} // TestParallelUnsortedConstruction()
+
+
 //------------------------------------------------------------------------------
 void TestIntegerRangesDocumentation() {
   
@@ -275,6 +384,14 @@ BOOST_AUTO_TEST_CASE( BasicTestCase ) {
 } // BOOST_AUTO_TEST_CASE( BasicTestCase )
 
 
+BOOST_AUTO_TEST_CASE( UnsortedTestCase ) {
+  
+  TestUnsortedConstruction();
+  TestParallelUnsortedConstruction();
+  
+} // BOOST_AUTO_TEST_CASE( UnsortedTestCase )
+
+
 BOOST_AUTO_TEST_CASE( DocumentationTestCase ) {
   
   TestIntegerRangesDocumentation();
@@ -0,0 +1,116 @@
+/**
+ * @file   InteractionTypeCode_test.cc
+ * @brief  Unit test for utilities from `InteractionTypeCode.h`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Utilities/InteractionTypeCode.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE InteractionTypeCode
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Utilities/InteractionTypeCode.h"
+#include "icarusalg/Utilities/WeakCurrentType.h"
+
+// C/C++ standard library
+#include <array>
+#include <cstdint>
+
+
+//------------------------------------------------------------------------------
+void WeakCurrentTypeNameTest() {
+  
+  BOOST_TEST(icarus::ChargedCurrentType.nameView() == "charged");
+  BOOST_TEST(icarus::NeutralCurrentType.shortNameView() == "NC");
+  BOOST_TEST(icarus::AnyWeakCurrentType.name() == "any");
+  
+  BOOST_TEST(icarus::WeakCurrentType{ "Charged" } == icarus::ChargedCurrentType);
+  BOOST_TEST(icarus::WeakCurrentType{ "nc" } == icarus::NeutralCurrentType);
+  BOOST_TEST(icarus::WeakCurrentType{ "" } == icarus::AnyWeakCurrentType);
+  BOOST_CHECK_THROW(icarus::WeakCurrentType{ "charge" }, cet::exception);
+  
+} // WeakCurrentTypeNameTest()
+
+
+//------------------------------------------------------------------------------
+void InteractionTypeCodeTest() {
+  
+  using icarus::InteractionTypeCode;
+  using ModeField = InteractionTypeCode::Field
+    <InteractionTypeCode::FirstFreeBit, 4U>;
+  
+  static_assert
+    (InteractionTypeCode{}.currentType() == icarus::AnyWeakCurrentType);
+  
+  InteractionTypeCode code { icarus::ChargedCurrentType };
+  code.set<ModeField>(5U);
+  BOOST_TEST(code.currentType() == icarus::ChargedCurrentType);
+  BOOST_TEST(code.currentTypeName() == "charged");
+  BOOST_TEST(code.get<ModeField>() == 5U);
+  
+  code.setCurrentType(icarus::NeutralCurrentType);
+  BOOST_TEST(code.currentType() == icarus::NeutralCurrentType);
+  BOOST_TEST(code.get<ModeField>() == 5U);
+  
+  code.set<ModeField>(0x13U); // overflowing bits are discarded
+  BOOST_TEST(code.get<ModeField>() == 0x3U);
+  BOOST_TEST(code.currentType() == icarus::NeutralCurrentType);
+  
+  BOOST_TEST(InteractionTypeCode::fromCode(code.code()).code() == code.code());
+  
+} // InteractionTypeCodeTest()
+
+
+//------------------------------------------------------------------------------
+void maskCurrentTypeTest() {
+  
+  using icarus::InteractionTypeCode;
+  using ModeField = InteractionTypeCode::Field
+    <InteractionTypeCode::FirstFreeBit, 4U>;
+  
+  std::array<InteractionTypeCode::Code_t, 5U> const codes {
+    InteractionTypeCode{ icarus::ChargedCurrentType }.code(),
+    InteractionTypeCode{ icarus::NeutralCurrentType }.code(),
+    InteractionTypeCode{ icarus::ChargedCurrentType }.set<ModeField>(2).code(),
+    InteractionTypeCode{ icarus::NeutralCurrentType }.set<ModeField>(2).code(),
+    InteractionTypeCode{ icarus::ChargedCurrentType }.set<ModeField>(1).code()
+  };
+  std::array<std::uint8_t, 5U> mask;
+  
+  BOOST_TEST(icarus::maskCurrentType(codes, icarus::ChargedCurrentType, mask)
+    == 3U);
+  BOOST_TEST(mask == (std::array<std::uint8_t, 5U>{ 1, 0, 1, 0, 1 }));
+  
+  BOOST_TEST(icarus::maskCurrentType(codes, icarus::NeutralCurrentType, mask)
+    == 2U);
+  BOOST_TEST(mask == (std::array<std::uint8_t, 5U>{ 0, 1, 0, 1, 0 }));
+  
+  BOOST_TEST(icarus::maskCurrentType(codes, icarus::AnyWeakCurrentType, mask)
+    == 5U);
+  BOOST_TEST(mask == (std::array<std::uint8_t, 5U>{ 1, 1, 1, 1, 1 }));
+  
+  BOOST_TEST(icarus::maskFieldEqual<ModeField>(codes, 2U, mask) == 2U);
+  BOOST_TEST(mask == (std::array<std::uint8_t, 5U>{ 0, 0, 1, 1, 0 }));
+  
+} // maskCurrentTypeTest()
+
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+BOOST_AUTO_TEST_CASE( WeakCurrentTypeTestCase ) {
+  
+  WeakCurrentTypeNameTest();
+  
+} // BOOST_AUTO_TEST_CASE( WeakCurrentTypeTestCase )
+
+
+BOOST_AUTO_TEST_CASE( InteractionTypeCodeTestCase ) {
+  
+  InteractionTypeCodeTest();
+  maskCurrentTypeTest();
+  
+} // BOOST_AUTO_TEST_CASE( InteractionTypeCodeTestCase )
+
@@ -0,0 +1,160 @@
+/**
+ * @file   IntervalSet_test.cc
+ * @brief  Unit test for utilities from `IntervalSet.h`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Utilities/IntervalSet.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE IntervalSet
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Utilities/IntervalSet.h"
+
+// C/C++ standard library
+#include <algorithm> // std::sort()
+#include <random>
+#include <vector>
+#include <cstdint>
+
+
+//------------------------------------------------------------------------------
+using Interval_t = icarus::ns::util::TimeInterval<int>;
+using IntervalSet_t = icarus::ns::util::IntervalSet<int>;
+
+
+/// Brute-force membership: whether `t` is in any of the `intervals`.
+bool inAny(std::vector<Interval_t> const& intervals, int t) {
+  for (Interval_t const& interval: intervals)
+    if (interval.contains(t)) return true;
+  return false;
+} // inAny()
+
+
+//------------------------------------------------------------------------------
+void normalizationTest() {
+  
+  IntervalSet_t const set{
+    Interval_t{ 8, 9 }, Interval_t{ -2, 2 }, Interval_t{ 1, 5 },
+    Interval_t{ 5, 6 }, Interval_t{ 7, 7 }, Interval_t{ 12, 10 }
+    };
+  
+  BOOST_TEST(set.size() == 2U);
+  BOOST_TEST(set.intervals()[0].start == -2);
+  BOOST_TEST(set.intervals()[0].stop  ==  6);
+  BOOST_TEST(set.intervals()[1].start ==  8);
+  BOOST_TEST(set.intervals()[1].stop  ==  9);
+  
+  BOOST_TEST(set.contains(-2));
+  BOOST_TEST(set.contains(5));
+  BOOST_TEST(!set.contains(6));
+  BOOST_TEST(!set.contains(7));
+  BOOST_TEST(set.contains(8));
+  BOOST_TEST(!set.contains(9));
+  BOOST_TEST(!set.contains(-3));
+  
+  IntervalSet_t added = set;
+  added.add({ 6, 8 });
+  BOOST_TEST(added.size() == 1U);
+  BOOST_TEST(added.span().start == -2);
+  BOOST_TEST(added.span().stop == 9);
+  
+} // normalizationTest()
+
+
+//------------------------------------------------------------------------------
+void algebraTest() {
+  
+  IntervalSet_t const gates
+    { Interval_t{ -2, 2 }, Interval_t{ 1, 5 }, Interval_t{ 8, 9 } };
+  IntervalSet_t const vetoes{ Interval_t{ 4, 8 } };
+  
+  IntervalSet_t const open = gates & vetoes.complement({ -10, 10 });
+  BOOST_TEST(open.size() == 2U);
+  BOOST_TEST(open.intervals()[0].start == -2);
+  BOOST_TEST(open.intervals()[0].stop  ==  4);
+  BOOST_TEST(open.intervals()[1].start ==  8);
+  BOOST_TEST(open.intervals()[1].stop  ==  9);
+  
+  IntervalSet_t const all = gates | vetoes;
+  BOOST_TEST(all.size() == 1U);
+  BOOST_TEST(all.span().start == -2);
+  BOOST_TEST(all.span().stop == 9);
+  
+  BOOST_TEST(IntervalSet_t{}.complement({ 0, 3 }).size() == 1U);
+  BOOST_TEST(gates.complement({ 0, 0 }).empty());
+  
+} // algebraTest()
+
+
+//------------------------------------------------------------------------------
+void randomTest() {
+  
+  std::mt19937 engine{ 12345 };
+  std::uniform_int_distribution<int> startDist{ -500, 500 }, lengthDist{ 0, 40 };
+  auto randomIntervals = [&](std::size_t n){
+      std::vector<Interval_t> intervals;
+      for (std::size_t i = 0; i < n; ++i) {
+        int const start = startDist(engine);
+        intervals.emplace_back(start, start + lengthDist(engine));
+      }
+      return intervals;
+    };
+  
+  Interval_t const universe{ -450, 450 };
+  std::vector<int> times;
+  for (int t = -600; t < 600; ++t) times.push_back(t);
+  std::vector<std::uint8_t> result(times.size());
+  
+  for (int iTrial = 0; iTrial < 20; ++iTrial) {
+    
+    std::vector<Interval_t> const A = randomIntervals(30);
+    std::vector<Interval_t> const B = randomIntervals(25);
+    IntervalSet_t const setA{ A }, setB{ B };
+    IntervalSet_t const unionAB = setA | setB;
+    IntervalSet_t const interAB = setA & setB;
+    IntervalSet_t const complA = setA.complement(universe);
+    
+    IntervalSet_t incremental;
+    for (Interval_t const& interval: A) incremental.add(interval);
+    BOOST_TEST(incremental.size() == setA.size());
+    
+    std::size_t const nInA = setA.containsSorted(times, result);
+    std::size_t nExpected = 0;
+    for (std::size_t i = 0; i < times.size(); ++i) {
+      int const t = times[i];
+      bool const inA = inAny(A, t), inB = inAny(B, t);
+      nExpected += inA;
+      BOOST_TEST(setA.contains(t) == inA);
+      BOOST_TEST(incremental.contains(t) == inA);
+      BOOST_TEST(bool(result[i]) == inA);
+      BOOST_TEST(unionAB.contains(t) == (inA || inB));
+      BOOST_TEST(interAB.contains(t) == (inA && inB));
+      BOOST_TEST(complA.contains(t) == (universe.contains(t) && !inA));
+    } // for
+    BOOST_TEST(nInA == nExpected);
+    
+  } // for trials
+  
+} // randomTest()
+
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+BOOST_AUTO_TEST_CASE( IntervalSetTestCase ) {
+  
+  normalizationTest();
+  algebraTest();
+  
+} // BOOST_AUTO_TEST_CASE( IntervalSetTestCase )
+
+
+BOOST_AUTO_TEST_CASE( IntervalSetRandomTestCase ) {
+  
+  randomTest();
+  
+} // BOOST_AUTO_TEST_CASE( IntervalSetRandomTestCase )
+
@@ -0,0 +1,216 @@
+/**
+ * @file LazyAssnsCrosser_test.cc
+ * @brief Unit test for `icarus::ns::util::LazyAssnsCrosser` class.
+ * @date October 18, 2026
+ * @see icarusalg/Utilities/LazyAssnsCrosser.h
+ */
+
+
+// Boost libraries
+#define BOOST_TEST_MODULE LazyAssnsCrosser
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// library to test
+#include "icarusalg/Utilities/LazyAssnsCrosser.h"
+
+// ICARUS and LArSoft libraries
+#include "icarusalg/Utilities/AssnsCrosser.h"
+#include "test/FrameworkEventMockup.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <utility> // std::move()
+#include <cstddef>
+
+
+//------------------------------------------------------------------------------
+// test data
+template <std::size_t Tag>
+struct DataType {
+  static constexpr std::size_t tag = Tag;
+  std::size_t ID = 0;
+}; // DataType<>
+
+struct DataTypeA: DataType<1> {};
+struct DataTypeB: DataType<2> {};
+struct DataTypeC: DataType<3> {};
+struct DataTypeD: DataType<4> {};
+
+constexpr std::size_t NA = 500, NB = 1200, NC = 800, ND = 100;
+
+
+//------------------------------------------------------------------------------
+testing::mockup::Event makeTestEvent() {
+  /*
+   * Many keys, each associated to a few B, each associated to a few C
+   * (and C to D), with plenty of shared objects and multiple paths.
+   * The last B and C are not associated to anything, and the last A is not
+   * present in the associations.
+   */
+  testing::mockup::Event event;
+  event.put(std::vector<DataTypeA>(NA), art::InputTag{ "A" });
+  event.put(std::vector<DataTypeB>(NB), art::InputTag{ "B" });
+  event.put(std::vector<DataTypeC>(NC), art::InputTag{ "C" });
+  event.put(std::vector<DataTypeD>(ND), art::InputTag{ "D" });
+
+  testing::mockup::PtrMaker<DataTypeA> makeAptr{ event, art::InputTag{ "A" } };
+  testing::mockup::PtrMaker<DataTypeB> makeBptr{ event, art::InputTag{ "B" } };
+  testing::mockup::PtrMaker<DataTypeC> makeCptr{ event, art::InputTag{ "C" } };
+  testing::mockup::PtrMaker<DataTypeD> makeDptr{ event, art::InputTag{ "D" } };
+
+  art::Assns<DataTypeA, DataTypeB> assnsAB;
+  for (std::size_t iA = 0; iA < NA - 1; ++iA)
+    for (std::size_t k = 0; k < 4; ++k)
+      assnsAB.addSingle(makeAptr(iA), makeBptr((iA * 3 + k * 7) % NB));
+  event.put(std::move(assnsAB), art::InputTag{ "B" });
+
+  art::Assns<DataTypeB, DataTypeC> assnsBC;
+  for (std::size_t iB = 0; iB < NB - 1; ++iB)
+    for (std::size_t k = 0; k < 3; ++k)
+      assnsBC.addSingle(makeBptr(iB), makeCptr((iB * 5 + k * 11) % NC));
+  event.put(std::move(assnsBC), art::InputTag{ "C" });
+
+  art::Assns<DataTypeC, DataTypeD> assnsCD;
+  for (std::size_t iC = 0; iC < NC - 1; ++iC)
+    for (std::size_t k = 0; k < 2; ++k)
+      assnsCD.addSingle(makeCptr(iC), makeDptr((iC + k * 13) % ND));
+  event.put(std::move(assnsCD), art::InputTag{ "D" });
+
+  return event;
+} // makeTestEvent()
+
+
+//------------------------------------------------------------------------------
+template <typename Lazy, typename Eager>
+std::size_t countMismatches(
+  testing::mockup::Event const& event, Lazy const& lazy, Eager const& eager
+) {
+  testing::mockup::PtrMaker<DataTypeA> makeAptr{ event, art::InputTag{ "A" } };
+  std::size_t nMismatches = 0;
+  for (std::size_t iA = 0; iA < NA; ++iA) {
+    art::Ptr<DataTypeA> const Aptr = makeAptr(iA);
+    if (lazy.assPtrs(Aptr) != eager.assPtrs(Aptr)) ++nMismatches;
+    if (lazy.pathCounts(Aptr) != eager.pathCounts(Aptr)) ++nMismatches;
+  } // for
+  return nMismatches;
+} // countMismatches()
+
+
+//------------------------------------------------------------------------------
+void LazyAssnsCrosser_test() {
+  /*
+   * The lazy crosser must return the same results as the eager one,
+   * and expand only the keys that are queried.
+   */
+  using icarus::ns::util::AssnsCrosserOptions;
+  using Duplicates = AssnsCrosserOptions::Duplicates;
+
+  testing::mockup::Event const event = makeTestEvent();
+  testing::mockup::PtrMaker<DataTypeA> makeAptr{ event, art::InputTag{ "A" } };
+
+  for (Duplicates const duplicates
+    : { Duplicates::keep, Duplicates::remove, Duplicates::count }
+  ) {
+    BOOST_TEST_CONTEXT("Duplicates option #" << static_cast<int>(duplicates))
+    {
+      AssnsCrosserOptions const options{ duplicates };
+
+      icarus::ns::util::LazyAssnsCrosser
+        <DataTypeA, DataTypeB, DataTypeC, DataTypeD> const lazyAtoD
+        { event, options, "B", "C", "D" };
+      icarus::ns::util::AssnsCrosser
+        <DataTypeA, DataTypeB, DataTypeC, DataTypeD> const eagerAtoD
+        { event, options, {}, "B", "C", "D" };
+
+      BOOST_TEST(lazyAtoD.nExpandedKeys() == 0U);
+      BOOST_TEST(!lazyAtoD.assPtrs(makeAptr(7)).empty());
+      BOOST_TEST(lazyAtoD.nExpandedKeys() == 1U);
+      lazyAtoD.assPtrs(makeAptr(7));
+      lazyAtoD.pathCounts(makeAptr(7));
+      BOOST_TEST(lazyAtoD.nExpandedKeys() == 1U);
+
+      BOOST_TEST(lazyAtoD.assPtrs(makeAptr(NA - 1)).empty());
+
+      BOOST_TEST(countMismatches(event, lazyAtoD, eagerAtoD) == 0U);
+      BOOST_TEST(lazyAtoD.nExpandedKeys() == NA);
+    } // context
+  } // for duplicates
+
+} // LazyAssnsCrosser_test()
+
+
+//------------------------------------------------------------------------------
+void LazyAssnsCrosserBackward_test() {
+  /*
+   * The first hop is not specified: it must be discovered from the second one,
+   * as in the backward traversal of `AssnsCrosser`.
+   */
+  using icarus::ns::util::AssnsCrosserOptions;
+
+  testing::mockup::Event const event = makeTestEvent();
+
+  AssnsCrosserOptions const options{ AssnsCrosserOptions::Duplicates::count };
+  icarus::ns::util::LazyAssnsCrosser<DataTypeA, DataTypeB, DataTypeC> const
+    lazyAtoC{ event, options, {}, "C" };
+  icarus::ns::util::AssnsCrosser<DataTypeA, DataTypeB, DataTypeC> const
+    eagerAtoC{ event, options, {}, "B", "C" };
+
+  BOOST_TEST(countMismatches(event, lazyAtoC, eagerAtoC) == 0U);
+
+} // LazyAssnsCrosserBackward_test()
+
+
+//------------------------------------------------------------------------------
+void LazyAssnsCrosserConcurrent_test() {
+  /*
+   * Many threads query the same keys at the same time.
+   */
+  using icarus::ns::util::AssnsCrosserOptions;
+  constexpr unsigned int NThreads = 4U;
+
+  testing::mockup::Event const event = makeTestEvent();
+
+  AssnsCrosserOptions const options{ AssnsCrosserOptions::Duplicates::count };
+  icarus::ns::util::LazyAssnsCrosser
+    <DataTypeA, DataTypeB, DataTypeC, DataTypeD> const lazyAtoD
+    { event, options, "B", "C", "D" };
+  icarus::ns::util::AssnsCrosser
+    <DataTypeA, DataTypeB, DataTypeC, DataTypeD> const eagerAtoD
+    { event, options, {}, "B", "C", "D" };
+
+  std::atomic<std::size_t> nMismatches{ 0U };
+  std::vector<std::thread> threads;
+  for (unsigned int iThread = 0; iThread < NThreads; ++iThread) {
+    threads.emplace_back([&]()
+      { nMismatches += countMismatches(event, lazyAtoD, eagerAtoD); });
+  }
+  for (std::thread& thread: threads) thread.join();
+
+  BOOST_TEST(nMismatches.load() == 0U);
+  BOOST_TEST(lazyAtoD.nExpandedKeys() == NA);
+
+} // LazyAssnsCrosserConcurrent_test()
+
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+BOOST_AUTO_TEST_CASE( LazyAssnsCrosser_testCase ) {
+
+  LazyAssnsCrosser_test();
+  LazyAssnsCrosserBackward_test();
+
+} // BOOST_AUTO_TEST_CASE( LazyAssnsCrosser_testCase )
+
+
+BOOST_AUTO_TEST_CASE( LazyAssnsCrosserConcurrent_testCase ) {
+
+  LazyAssnsCrosserConcurrent_test();
+
+} // BOOST_AUTO_TEST_CASE( LazyAssnsCrosserConcurrent_testCase )
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,115 @@
+/**
+ * @file   ROOTasyncWriter_test.cc
+ * @brief  Unit test for `util::ROOT::AsyncObjectWriter`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Utilities/ROOTasyncWriter.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ROOTasyncWriter
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Utilities/ROOTasyncWriter.h"
+
+// ROOT libraries
+#include "TFile.h"
+#include "TNamed.h"
+#include "TROOT.h" // ROOT::EnableThreadSafety()
+
+// C/C++ standard libraries
+#include <memory> // std::unique_ptr, std::make_unique()
+#include <stdexcept> // std::logic_error
+#include <string>
+#include <cstdio> // std::remove()
+
+
+// -----------------------------------------------------------------------------
+constexpr std::size_t NDirectories = 5U;
+constexpr std::size_t NObjectsPerDirectory = 200U;
+constexpr std::size_t NObjects = NDirectories * NObjectsPerDirectory;
+
+std::string directoryPath(std::size_t iDir)
+  { return "Dir" + std::to_string(iDir) + "/Sub"; }
+
+std::string objectName(std::size_t iObj)
+  { return "Obj" + std::to_string(iObj); }
+
+std::string objectTitle(std::size_t iObj)
+  { return "Object #" + std::to_string(iObj); }
+
+
+// -----------------------------------------------------------------------------
+void AsyncObjectWriterTest() {
+
+  std::string const fileName = "ROOTasyncWriter_test.root";
+
+  ::ROOT::EnableThreadSafety(); // before any ROOT object is created
+
+  {
+    TFile file { fileName.c_str(), "RECREATE" };
+    BOOST_TEST_REQUIRE(!file.IsZombie());
+
+    // a short queue, so that the writer thread is often waited for
+    util::ROOT::AsyncObjectWriter writer { file, { 4U, 1 } };
+
+    std::size_t iObj = 0U;
+    for (std::size_t iDir = 0; iDir < NDirectories; ++iDir) {
+      for (std::size_t i = 0; i < NObjectsPerDirectory; ++i, ++iObj) {
+        writer.write(
+          std::make_unique<TNamed>
+            (objectName(iObj).c_str(), objectTitle(iObj).c_str()),
+          directoryPath(iDir), "Test directory"
+          );
+      } // for objects
+      if (iDir % 2 == 0) writer.closeDirectory("Dir" + std::to_string(iDir));
+    } // for directories
+    writer.flush();
+    BOOST_TEST(writer.nWritten() == NObjects);
+
+    writer.finish();
+    BOOST_TEST(writer.nWritten() == NObjects);
+    BOOST_CHECK_THROW(
+      writer.write(std::make_unique<TNamed>("Late", "Too late")),
+      std::logic_error
+      );
+    BOOST_CHECK_THROW(writer.closeDirectory("Dir0"), std::logic_error);
+
+    file.Write();
+    file.Close();
+  }
+
+  // all the objects are in the file, in their directories
+  TFile file { fileName.c_str(), "READ" };
+  BOOST_TEST_REQUIRE(!file.IsZombie());
+  std::size_t nFound = 0U;
+  for (std::size_t iObj = 0; iObj < NObjects; ++iObj) {
+    std::string const path
+      = directoryPath(iObj / NObjectsPerDirectory) + "/" + objectName(iObj);
+    BOOST_TEST_CONTEXT("Object '" << path << "'") {
+      std::unique_ptr<TNamed> const obj { file.Get<TNamed>(path.c_str()) };
+      BOOST_TEST(obj);
+      if (!obj) continue;
+      ++nFound;
+      BOOST_TEST(obj->GetTitle() == objectTitle(iObj));
+    }
+  } // for
+  BOOST_TEST(nFound == NObjects);
+
+  std::unique_ptr<TNamed> const late { file.Get<TNamed>("Late") };
+  BOOST_TEST(!late);
+
+  file.Close();
+  std::remove(fileName.c_str());
+
+} // AsyncObjectWriterTest()
+
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(AsyncObjectWriterTestCase) {
+  AsyncObjectWriterTest();
+} // BOOST_AUTO_TEST_CASE(AsyncObjectWriterTestCase)
+
+
+// -----------------------------------------------------------------------------
@@ -17,6 +17,14 @@ namespace tt = boost::test_tools;
 // LArSoft libraries
 #include "larcorealg/CoreUtils/counter.h"
 
+// C/C++ standard libraries
+#include <algorithm> // std::sort()
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cmath> // std::exp()
+
 
 //------------------------------------------------------------------------------
 template <typename T, typename U>
@@ -221,6 +229,139 @@ void ExtendedRangeTest() {
 } // void ExtendedRangeTest()
 
 
+//------------------------------------------------------------------------------
+void AddPulsesTest() {
+
+  using SampledFunction_t = util::SampledFunction<double, float>;
+  using Pulse_t = SampledFunction_t::Pulse_t;
+
+  // a PMT-like pulse shape, 1 step = 1 tick, with 5 subticks
+  auto const shape
+    = [](double t){ return (t < 0.0)? 0.0f: float(t * std::exp(-t / 3.0)); };
+  constexpr gsl::index nSamples = 32;
+  constexpr gsl::index nSubsamples = 5;
+  SampledFunction_t const sampled { shape, -2.0, 30.0, nSamples, nSubsamples };
+
+  // pulses, some of them coincident, some partially out of the buffer
+  std::mt19937 rng { 1234U };
+  std::uniform_real_distribution<double> time { -40.0, 240.0 };
+  std::uniform_int_distribution<int> nPE { 1, 4 };
+  std::vector<Pulse_t> pulses;
+  for (int i = 0; i < 2000; ++i) {
+    pulses.push_back({ time(rng), float(nPE(rng)) });
+    if (i % 10 == 0) pulses.push_back(pulses.back()); // a coincident pulse
+  }
+  std::sort(pulses.begin(), pulses.end(),
+    [](Pulse_t const& a, Pulse_t const& b){ return a.time < b.time; });
+
+  // reference: scalar loop
+  std::vector<float> expected(200, 0.0f);
+  auto const expectedSize = static_cast<gsl::index>(expected.size());
+  for (Pulse_t const& pulse: pulses) {
+    gsl::index const iSub = sampled.closestSubsampleIndex(pulse.time);
+    gsl::index const start = sampled.stepIndex(pulse.time, iSub);
+    auto const& subsample = sampled.subsample(iSub);
+    for (gsl::index i = 0; i < sampled.size(); ++i) {
+      gsl::index const iDest = start + i;
+      if ((iDest >= 0) && (iDest < expectedSize))
+        expected[iDest] += pulse.amplitude * subsample[i];
+    }
+  } // for
+
+  std::vector<float> waveform(expected.size(), 0.0f);
+  sampled.addPulses<float>(pulses, waveform);
+  for (auto const i: util::counter(waveform.size()))
+    BOOST_TEST_CONTEXT("Tick: " << i) { BOOST_TEST(waveform[i] == expected[i]); }
+
+  // merging changes rounding: compare with tolerance
+  std::vector<float> merged(expected.size(), 0.0f);
+  sampled.addPulses<float>(pulses, merged, true);
+  for (auto const i: util::counter(merged.size()))
+    BOOST_TEST_CONTEXT("Tick: " << i)
+      { BOOST_TEST(merged[i] == expected[i], tt::tolerance(1e-5f)); }
+
+} // void AddPulsesTest()
+
+
+//------------------------------------------------------------------------------
+void ConstructionBenchmarkTest() {
+
+  /*
+   * An "expensive" function (numerically integrated) is sampled with the
+   * constructor extending the range until the function is small enough;
+   * the number of function calls is checked, and the construction is timed
+   * with and without parallel computation of the subsamples.
+   */
+  using Clock_t = std::chrono::steady_clock;
+
+  std::atomic<unsigned int> nCalls { 0U };
+  auto const response = [&nCalls](double t)
+    {
+      ++nCalls;
+      if (t <= 0.0) return 0.0;
+      // integral of u exp(-u) from 0 to t, midpoint rule
+      constexpr int nSteps = 2000;
+      double const du = t / nSteps;
+      double sum = 0.0;
+      for (int i = 0; i < nSteps; ++i) {
+        double const u = (i + 0.5) * du;
+        sum += u * std::exp(-u);
+      }
+      return std::exp(-t / 4.0) * sum * du;
+    };
+  auto const below = [](double, double y){ return std::abs(y) < 1e-3; };
+
+  constexpr double min = 0.0;
+  constexpr double step = 0.05;
+  constexpr double atLeast = 1.0;
+  constexpr gsl::index nSubsamples = 8;
+
+  nCalls = 0U;
+  auto const startSerial = Clock_t::now();
+  util::SampledFunction const serial
+    { response, min, step, below, nSubsamples, atLeast };
+  auto const stopSerial = Clock_t::now();
+  unsigned int const serialCalls = nCalls;
+
+  // each sample is evaluated once; in addition, the extension evaluates the
+  // point at upper() and the one after it, which stopped the extension
+  BOOST_TEST(serialCalls == nSubsamples * serial.size() + 2U);
+
+  nCalls = 0U;
+  auto const startParallel = Clock_t::now();
+  util::SampledFunction const parallel{
+    response, min, step, below, nSubsamples, atLeast,
+    util::SampledFunctionOptions{ 4U }
+    };
+  auto const stopParallel = Clock_t::now();
+  BOOST_TEST(nCalls == serialCalls);
+
+  BOOST_TEST_REQUIRE(parallel.size() == serial.size());
+  for (auto const iSub: util::counter(nSubsamples)) {
+    BOOST_TEST_CONTEXT("Subsample: " << iSub) {
+      for (auto const iSample: util::counter(serial.size())) {
+        BOOST_TEST_CONTEXT("Sample: " << iSample) {
+          double const x
+            = (min + iSub * serial.substepSize()) + iSample * step;
+          BOOST_TEST(serial.value(iSample, iSub) == response(x));
+          BOOST_TEST
+            (parallel.value(iSample, iSub) == serial.value(iSample, iSub));
+        }
+      } // for samples
+    }
+  } // for subsamples
+
+  auto const ms = [](auto duration)
+    { return std::chrono::duration<double, std::milli>(duration).count(); };
+  BOOST_TEST_MESSAGE("Construction of " << nSubsamples << " x "
+    << serial.size() << " samples: " << ms(stopSerial - startSerial)
+    << " ms (serial), " << ms(stopParallel - startParallel)
+    << " ms (4 threads)"
+    );
+
+} // void ConstructionBenchmarkTest()
+
+
 //------------------------------------------------------------------------------
 //---  The tests
 //---
@@ -231,3 +372,17 @@ BOOST_AUTO_TEST_CASE( TestCase ) {
 
 } // BOOST_AUTO_TEST_CASE( TestCase )
 
+
+BOOST_AUTO_TEST_CASE( AddPulsesTestCase ) {
+
+  AddPulsesTest();
+
+} // BOOST_AUTO_TEST_CASE( AddPulsesTestCase )
+
+
+BOOST_AUTO_TEST_CASE( ConstructionBenchmarkTestCase ) {
+
+  ConstructionBenchmarkTest();
+
+} // BOOST_AUTO_TEST_CASE( ConstructionBenchmarkTestCase )
+
@@ -0,0 +1,148 @@
+/**
+ * @file   TPCsetRangeTable_test.cc
+ * @brief  Unit test for the batched time range merging of `TrackTimeInterval`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Utilities/TrackTimeInterval.h`
+ *
+ * Unlike `TrackTimeInterval_test`, this test needs no geometry nor detector
+ * properties: the ranges in each TPC set are made up, and the merging of
+ * `TrackTimeInterval::timeRangesOfTracks()` is compared with the one
+ * track by track of `TrackTimeInterval::mergeTPCsetRanges_SBN()`.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE TPCsetRangeTable
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Utilities/TrackTimeInterval.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ReadoutDataContainers.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+
+// C/C++ standard libraries
+#include <random>
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+using TrackTimeInterval = lar::util::TrackTimeInterval;
+using TimeRange = TrackTimeInterval::TimeRange;
+using TPCsetRangeTable = TrackTimeInterval::TPCsetRangeTable;
+using TPCsetRanges_t = readout::TPCsetDataContainer<TimeRange>;
+
+
+/// Returns a random range; either boundary may be undefined.
+template <typename Engine>
+TimeRange randomRange(Engine& engine) {
+
+  std::uniform_real_distribution<double> time { -1500.0, 1500.0 };
+  std::uniform_int_distribution<int> kind { 0, 5 };
+
+  TimeRange range;
+  switch (kind(engine)) {
+    case 0: // start only
+      range.start = TrackTimeInterval::electronics_time{ time(engine) };
+      break;
+    case 1: // stop only
+      range.stop = TrackTimeInterval::electronics_time{ time(engine) };
+      break;
+    default: {
+      double const start = time(engine);
+      range.start = TrackTimeInterval::electronics_time{ start };
+      range.stop = TrackTimeInterval::electronics_time{ start + 1000.0 };
+    }
+  } // switch
+  return range;
+} // randomRange()
+
+
+// -----------------------------------------------------------------------------
+void TPCsetRangeTableTest
+  (std::size_t nTracks, unsigned int nCryostats, unsigned int nTPCsets)
+{
+  std::mt19937 engine { 12345 };
+  std::uniform_int_distribution<int> nRanges { 0, 2 }; // 0: invalid range
+
+  TPCsetRangeTable table { nTracks, nCryostats, nTPCsets };
+  BOOST_TEST(table.nTracks() == nTracks);
+  BOOST_TEST(table.nCryostats() == nCryostats);
+  BOOST_TEST(table.nTPCsets() == nTPCsets);
+
+  BOOST_TEST(!table.hasTPCset(readout::TPCsetID{}));
+  BOOST_TEST(!table.hasTPCset(readout::TPCsetID(nCryostats, 0)));
+  if (nCryostats > 0)
+    BOOST_TEST(!table.hasTPCset(readout::TPCsetID(0, nTPCsets)));
+
+  // the same ranges in the table and in a container for each track
+  std::vector<TPCsetRanges_t> trackRanges
+    (nTracks, TPCsetRanges_t{ nCryostats, nTPCsets });
+  for (unsigned int c = 0; c < nCryostats; ++c) {
+    for (unsigned int s = 0; s < nTPCsets; ++s) {
+      readout::TPCsetID const tpcsetID(c, s);
+      BOOST_TEST_REQUIRE(table.hasTPCset(tpcsetID));
+      for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+
+        BOOST_TEST(!table.range(iTrack, tpcsetID).isValid());
+
+        TimeRange& expected = trackRanges[iTrack][tpcsetID];
+        for (int i = nRanges(engine); i > 0; --i) {
+          TimeRange const range = randomRange(engine);
+          table.intersect(iTrack, tpcsetID, range);
+          expected.intersect(range);
+        } // for ranges
+
+        TimeRange const range = table.range(iTrack, tpcsetID);
+        BOOST_TEST(range.start.value() == expected.start.value());
+        BOOST_TEST(range.stop.value() == expected.stop.value());
+        BOOST_TEST(table.startTimes(tpcsetID)[iTrack] == range.start.value());
+        BOOST_TEST(table.stopTimes(tpcsetID)[iTrack] == range.stop.value());
+
+      } // for tracks
+    } // for TPC sets
+  } // for cryostats
+
+  // batched merge must match the one of each single track
+  TrackTimeInterval::TimeRangeArrays const merged
+    = TrackTimeInterval::timeRangesOfTracks(table);
+  BOOST_TEST_REQUIRE(merged.size() == nTracks);
+  BOOST_TEST_REQUIRE(merged.stop.size() == nTracks);
+
+  unsigned int nValid = 0U;
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    TimeRange const expected
+      = TrackTimeInterval::mergeTPCsetRanges_SBN(trackRanges[iTrack]);
+    TimeRange const range = merged[iTrack];
+    BOOST_TEST_CONTEXT("Track #" << iTrack << " expected: " << expected) {
+      BOOST_TEST(range.isValid() == expected.isValid());
+      BOOST_TEST(range.start.value() == expected.start.value());
+      BOOST_TEST(range.stop.value() == expected.stop.value());
+    }
+    if (expected.isValid()) ++nValid;
+  } // for tracks
+
+  // make sure that the random sample was not trivial
+  if (nTracks >= 100) {
+    BOOST_TEST(nValid > 0U);
+    BOOST_TEST(nValid < nTracks);
+  }
+
+} // TPCsetRangeTableTest()
+
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(TPCsetRangeTableTestCase) {
+
+  TPCsetRangeTableTest(500U, 2U, 2U); // ICARUS-like
+  TPCsetRangeTableTest(500U, 1U, 2U); // single cryostat
+  TPCsetRangeTableTest(200U, 3U, 1U); // no cathode crossing
+  TPCsetRangeTableTest(0U, 2U, 2U); // no tracks
+  TPCsetRangeTableTest(10U, 0U, 0U); // no TPC sets
+
+} // BOOST_AUTO_TEST_CASE(TPCsetRangeTableTestCase)
+
+
+// -----------------------------------------------------------------------------
@@ -29,6 +29,7 @@
 #include "lardataalg/DetectorInfo/LArPropertiesStandardTestHelpers.h"
 #include "lardataalg/Utilities/quantities/spacetime.h" // microseconds
 #include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/CryostatGeo.h"
 #include "larcorealg/Geometry/TPCGeo.h"
 #include "larcorealg/Geometry/PlaneGeo.h"
 #include "larcorealg/CoreUtils/counter.h"
@@ -425,5 +426,77 @@ BOOST_AUTO_TEST_CASE(timeRangeOfHits_singleTPCset)
 } // BOOST_AUTO_TEST_CASE(PrintHitsOnAllPlanes)
 
 
+BOOST_AUTO_TEST_CASE(timeRangesOfTracks_batch)
+{
+  /*
+   * Tracks with hits in one or more TPC, with and without crossing cathodes
+   * and cryostats: the batch processing must return the same ranges as the
+   * track-by-track one.
+   */
+  auto const& testEnv = TestFixture::Env();
+  auto const detClockData
+    = testEnv.Provider<detinfo::DetectorClocks>()->DataForJob();
+  detinfo::DetectorTimings const detTiming{ detClockData };
+  
+  geo::GeometryCore const& geom = *(testEnv.Provider<geo::GeometryCore>());
+  detinfo::DetectorPropertiesData detProp
+    = testEnv.Provider<detinfo::DetectorProperties>()->DataFor(detClockData);
+  
+  lar::util::TrackTimeInterval const chargeTime{ geom, detProp, detTiming };
+  
+  // a hit on the first plane of `TPC` at fraction `u` of the drift distance
+  auto const makeHitInTPC = [&geom,&detProp](geo::TPCGeo const& TPC, double u)
+    {
+      geo::PlaneGeo const& plane = TPC.FirstPlane();
+      double const xC = TPC.GetCathodeCenter().X();
+      double const xA = plane.GetCenter().X();
+      geo::WireID const wireID{ plane.ID(), 100 };
+      raw::ChannelID_t const channel = geom.PlaneWireToChannel(wireID);
+      return makeHitAt(
+        channel, detProp.ConvertXToTicks(xA + (xC - xA) * u, plane.ID()),
+        plane.View(), geom.SignalType(channel), wireID
+        );
+    };
+  
+  std::vector<std::vector<recob::Hit>> tracks;
+  tracks.emplace_back(); // no hits at all
+  std::vector<recob::Hit> allTPCs;
+  double u = 0.1;
+  for (geo::TPCGeo const& TPC: geom.Iterate<geo::TPCGeo>()) {
+    tracks.push_back({ makeHitInTPC(TPC, 0.2), makeHitInTPC(TPC, 0.7) });
+    allTPCs.push_back(makeHitInTPC(TPC, u));
+    u += 0.1;
+  } // for TPC
+  tracks.push_back(std::move(allTPCs));
+  for (geo::CryostatGeo const& cryo: geom.Iterate<geo::CryostatGeo>()) {
+    std::vector<recob::Hit> cryoHits; // crossing the cathode
+    for (geo::TPCGeo const& TPC: cryo.IterateTPCs())
+      cryoHits.push_back(makeHitInTPC(TPC, 0.95));
+    tracks.push_back(std::move(cryoHits));
+  } // for cryostats
+  
+  lar::util::TrackTimeInterval::TPCsetRangeTable table
+    = chargeTime.makeTPCsetRangeTable(tracks.size());
+  for (std::size_t iTrack = 0; iTrack < tracks.size(); ++iTrack)
+    chargeTime.addHitsToTable(table, iTrack, tracks[iTrack]);
+  
+  lar::util::TrackTimeInterval::TimeRangeArrays const ranges
+    = chargeTime.timeRangesOfTracks(table);
+  BOOST_TEST(ranges.size() == tracks.size());
+  
+  for (std::size_t iTrack = 0; iTrack < tracks.size(); ++iTrack) {
+    lar::util::TrackTimeInterval::TimeRange const expected
+      = chargeTime.timeRangeOfHits(tracks[iTrack]);
+    lar::util::TrackTimeInterval::TimeRange const range = ranges[iTrack];
+    BOOST_TEST_CONTEXT("Track #" << iTrack << " expected: " << expected) {
+      BOOST_TEST(range.isValid() == expected.isValid());
+      BOOST_TEST(range.start == expected.start);
+      BOOST_TEST(range.stop == expected.stop);
+    }
+  } // for
+  
+} // BOOST_AUTO_TEST_CASE(timeRangesOfTracks_batch)
+
+
 
 // BOOST_AUTO_TEST_SUITE_END()
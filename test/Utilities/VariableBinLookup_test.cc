@@ -0,0 +1,172 @@
+/**
+ * @file   VariableBinLookup_test.cc
+ * @brief  Unit test for `util::ROOT::VariableBinLookup` and its filler.
+ * @date   October 18, 2026
+ * @see    `icarusalg/Utilities/ROOTutils.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE VariableBinLookup
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/Utilities/ROOTutils.h"
+
+// ROOT libraries
+#include "TAxis.h"
+#include "TH1D.h"
+
+// C/C++ standard libraries
+#include <random>
+#include <vector>
+#include <limits>
+#include <cmath> // std::nextafter()
+
+
+// -----------------------------------------------------------------------------
+/// Returns bin edges with random widths, some of them very narrow.
+std::vector<double> makeEdges(std::mt19937& engine, int nBins) {
+  std::uniform_real_distribution<double> flat { 0.0, 1.0 };
+  std::vector<double> edges { -3.0 };
+  for (int i = 0; i < nBins; ++i)
+    edges.push_back(edges.back() + ((flat(engine) < 0.1)? 1e-3: flat(engine)));
+  return edges;
+} // makeEdges()
+
+
+/// Returns test values: random ones in and out of range, and edge values.
+std::vector<double> makeValues
+  (std::mt19937& engine, std::vector<double> const& edges, int nRandom)
+{
+  double const lower = edges.front(), upper = edges.back();
+  std::uniform_real_distribution<double> flat
+    { lower - 0.1 * (upper - lower), upper + 0.1 * (upper - lower) };
+  std::vector<double> values;
+  for (int i = 0; i < nRandom; ++i) values.push_back(flat(engine));
+  for (double const edge: edges) {
+    values.push_back(edge);
+    values.push_back(std::nextafter(edge, lower - 1.0));
+    values.push_back(std::nextafter(edge, upper + 1.0));
+  }
+  values.push_back(-std::numeric_limits<double>::infinity());
+  values.push_back(+std::numeric_limits<double>::infinity());
+  values.push_back(std::numeric_limits<double>::quiet_NaN());
+  return values;
+} // makeValues()
+
+
+// -----------------------------------------------------------------------------
+void VariableBinLookupTest() {
+
+  std::mt19937 engine { 12345 };
+
+  for (int const nBins: { 1, 2, 10, 137, 400 }) {
+    std::vector<double> const edges = makeEdges(engine, nBins);
+    util::ROOT::VariableBinLookup const lookup { edges };
+    TAxis const axis { nBins, edges.data() };
+
+    BOOST_TEST(lookup.nBins() == nBins);
+    BOOST_TEST(lookup.edges() == edges);
+
+    std::vector<double> const values = makeValues(engine, edges, 10000);
+    std::vector<int> bins(values.size());
+    lookup.findBins(values, bins);
+
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      double const x = values[i];
+      BOOST_TEST_CONTEXT("Value " << x << " (" << nBins << " bins)") {
+        int const expected = axis.FindBin(x);
+        BOOST_TEST(lookup.findBin(x) == expected);
+        BOOST_TEST(bins[i] == expected);
+      }
+    } // for values
+
+    // underflow and overflow explicitly
+    BOOST_TEST(lookup.findBin(edges.front() - 1.0) == 0);
+    BOOST_TEST(lookup.findBin(edges.back()) == nBins + 1);
+    BOOST_TEST(lookup.findBin(edges.back() + 1.0) == nBins + 1);
+
+  } // for binnings
+
+} // VariableBinLookupTest()
+
+
+// -----------------------------------------------------------------------------
+void VariableBinFillerTest(bool weighted) {
+
+  std::mt19937 engine { 54321 };
+  std::uniform_real_distribution<double> flatWeight { 0.5, 2.0 };
+
+  int const nBins = 50;
+  std::vector<double> const edges = makeEdges(engine, nBins);
+  util::ROOT::VariableBinLookup const lookup { edges };
+
+  std::vector<double> values = makeValues(engine, edges, 5000);
+  values.pop_back(); // skip NaN, which TH1::Fill() does not count as entry
+  std::vector<double> weights(values.size(), 1.0);
+  if (weighted) for (double& w: weights) w = flatWeight(engine);
+
+  // reference: ROOT filling all entries, the first half with unit weight;
+  // `hist` has that first half already when the filler content is added
+  std::size_t const half = values.size() / 2;
+  TH1D expected { "Expected", "", nBins, edges.data() };
+  expected.SetDirectory(nullptr);
+  TH1D hist { "Hist", "", nBins, edges.data() };
+  hist.SetDirectory(nullptr);
+  for (std::size_t i = 0; i < half; ++i) {
+    expected.Fill(values[i]);
+    hist.Fill(values[i]);
+  }
+  for (std::size_t i = half; i < values.size(); ++i)
+    expected.Fill(values[i], weights[i]);
+
+  gsl::span<double const> const addedValues
+    { values.data() + half, values.size() - half };
+  util::ROOT::VariableBinFiller filler { lookup };
+  if (weighted) {
+    filler.fill
+      (addedValues, { weights.data() + half, weights.size() - half });
+  }
+  else filler.fill(addedValues);
+  BOOST_TEST(filler.entries() == values.size() - half);
+
+  filler.addTo(hist);
+
+  BOOST_TEST(hist.GetEntries() == expected.GetEntries());
+  BOOST_TEST((hist.GetSumw2N() > 0) == (expected.GetSumw2N() > 0));
+  for (int bin = 0; bin <= nBins + 1; ++bin) {
+    BOOST_TEST_CONTEXT("Bin " << bin) {
+      BOOST_TEST(hist.GetBinContent(bin) == expected.GetBinContent(bin),
+        boost::test_tools::tolerance(1e-9));
+      BOOST_TEST(hist.GetBinError(bin) == expected.GetBinError(bin),
+        boost::test_tools::tolerance(1e-9));
+    }
+  } // for bins
+
+  // after a reset, nothing is added
+  filler.reset();
+  BOOST_TEST(filler.entries() == 0U);
+  filler.addTo(hist);
+  BOOST_TEST(hist.GetEntries() == expected.GetEntries());
+  BOOST_TEST(hist.GetBinContent(1) == expected.GetBinContent(1),
+    boost::test_tools::tolerance(1e-9));
+
+} // VariableBinFillerTest()
+
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(VariableBinLookupTestCase) {
+  VariableBinLookupTest();
+} // BOOST_AUTO_TEST_CASE(VariableBinLookupTestCase)
+
+BOOST_AUTO_TEST_CASE(VariableBinFillerTestCase) {
+  VariableBinFillerTest(false);
+} // BOOST_AUTO_TEST_CASE(VariableBinFillerTestCase)
+
+BOOST_AUTO_TEST_CASE(VariableBinFillerWeightedTestCase) {
+  VariableBinFillerTest(true);
+} // BOOST_AUTO_TEST_CASE(VariableBinFillerWeightedTestCase)
+
+
+// -----------------------------------------------------------------------------
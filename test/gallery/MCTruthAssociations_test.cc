@@ -0,0 +1,143 @@
+/**
+ * @file   MCTruthAssociations_test.cc
+ * @brief  Unit test for the truth bookkeeping of `truth::MCTruthAssociations`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/gallery/MCTruthBase/MCTruthAssociations.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE MCTruthAssociations
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/gallery/MCTruthBase/MCTruthAssociations.h"
+#include "test/FrameworkEventMockup.h"
+
+// LArSoft and framework libraries
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "nusimdata/SimulationBase/MCTruth.h"
+#include "nusimdata/SimulationBase/MCParticle.h"
+#include "canvas/Persistency/Common/Assns.h"
+#include "canvas/Persistency/Common/FindOneP.h"
+#include "canvas/Persistency/Common/Ptr.h"
+#include "canvas/Utilities/InputTag.h"
+#include "fhiclcpp/ParameterSet.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+/*
+ * Two generator records; six particles, associated to the records as:
+ *
+ *     particle:  0  1  2  3  4  5
+ *     record:    0  0  1  1  0  1
+ *
+ * so that each record shows up again after the other one.
+ */
+constexpr std::size_t NParticles = 6U;
+constexpr std::size_t ParticleTruth[NParticles] = { 0, 0, 1, 1, 0, 1 };
+
+art::InputTag const TruthTag { "generator" };
+art::InputTag const ParticleTag { "largeant" };
+
+
+testing::mockup::Event makeTestEvent() {
+
+  testing::mockup::Event event;
+
+  event.put(std::vector<simb::MCTruth>(2U), TruthTag);
+
+  std::vector<simb::MCParticle> particles;
+  for (std::size_t i = 0; i < NParticles; ++i)
+    particles.emplace_back(static_cast<int>(i + 1), 13, "primary");
+  event.put(std::move(particles), ParticleTag);
+
+  testing::mockup::PtrMaker<simb::MCTruth> const makeTruthPtr
+    { event, TruthTag };
+  testing::mockup::PtrMaker<simb::MCParticle> const makeParticlePtr
+    { event, ParticleTag };
+  // the mockup has no partner associations: store the direction that
+  // `art::FindOneP<simb::MCTruth>` reads
+  art::Assns<simb::MCParticle, simb::MCTruth> particleToTruth;
+  for (std::size_t i = 0; i < NParticles; ++i) {
+    particleToTruth.addSingle
+      (makeParticlePtr(i), makeTruthPtr(ParticleTruth[i]));
+  }
+  event.put(std::move(particleToTruth), ParticleTag);
+
+  return event;
+} // makeTestEvent()
+
+
+// -----------------------------------------------------------------------------
+void MCTruthDuplicatesTest() {
+
+  testing::mockup::Event const event = makeTestEvent();
+  testing::mockup::PtrMaker<simb::MCTruth> const makeTruthPtr
+    { event, TruthTag };
+  testing::mockup::PtrMaker<simb::MCParticle> const makeParticlePtr
+    { event, ParticleTag };
+
+  truth::MCParticleVec particles;
+  for (std::size_t i = 0; i < NParticles; ++i)
+    particles.push_back(makeParticlePtr(i));
+  truth::MCTruthAssns const particleToTruth { particles, event, ParticleTag };
+
+  // the geometry is only stored, not used, by these queries
+  fhicl::ParameterSet geoConfig;
+  geoConfig.put("Name", std::string{ "test" });
+  geoConfig.put("SurfaceY", 0.0);
+  geo::GeometryCore const geom { geoConfig };
+
+  truth::MCTruthAssociations MCtruthAssns { fhicl::ParameterSet{} };
+
+  // setting up a few times must give the same result as the first time
+  for (int iSetup = 0; iSetup < 3; ++iSetup) {
+    BOOST_TEST_CONTEXT("setup #" << iSetup) {
+
+      MCtruthAssns.setup({}, particles, particleToTruth, geom);
+
+      // each record is listed once, in order of first appearance
+      truth::MCTruthTruthVec const& truths = MCtruthAssns.MCTruthVector();
+      BOOST_TEST_REQUIRE(truths.size() == 2U);
+      BOOST_TEST((truths[0] == makeTruthPtr(0)));
+      BOOST_TEST((truths[1] == makeTruthPtr(1)));
+
+      for (std::size_t i = 0; i < NParticles; ++i) {
+        int const trackID = static_cast<int>(i + 1);
+        BOOST_TEST_CONTEXT("track ID " << trackID) {
+          BOOST_TEST((MCtruthAssns.TrackIDToMCTruth(trackID)
+            == makeTruthPtr(ParticleTruth[i])));
+        }
+      } // for particles
+
+      BOOST_TEST(MCtruthAssns.MCTruthToParticles(truths[0]).size() == 3U);
+      BOOST_TEST(MCtruthAssns.MCTruthToParticles(truths[1]).size() == 3U);
+
+    } // context
+  } // for setups
+
+  // a smaller event with a single record: the previous one is forgotten
+  truth::MCParticleVec const someParticles
+    { makeParticlePtr(0), makeParticlePtr(1) };
+  truth::MCTruthAssns const someParticleToTruth
+    { someParticles, event, ParticleTag };
+  MCtruthAssns.setup({}, someParticles, someParticleToTruth, geom);
+  truth::MCTruthTruthVec const& truths = MCtruthAssns.MCTruthVector();
+  BOOST_TEST_REQUIRE(truths.size() == 1U);
+  BOOST_TEST((truths[0] == makeTruthPtr(0)));
+
+} // MCTruthDuplicatesTest()
+
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MCTruthDuplicatesTestCase) {
+  MCTruthDuplicatesTest();
+} // BOOST_AUTO_TEST_CASE(MCTruthDuplicatesTestCase)
+
+
+// -----------------------------------------------------------------------------
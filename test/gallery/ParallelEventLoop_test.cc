@@ -0,0 +1,264 @@
+/**
+ * @file   ParallelEventLoop_test.cc
+ * @brief  Unit test for `icarus::ParallelEventLoop` and its results.
+ * @date   October 18, 2026
+ * @see    `icarusalg/gallery/helpers/C++/ParallelEventLoop.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ParallelEventLoop
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/gallery/helpers/C++/ParallelEventLoop.h"
+
+// framework libraries
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort()
+#include <numeric> // std::iota()
+#include <sstream>
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <vector>
+#include <limits>
+#include <csignal> // ::raise(), SIGKILL
+#include <cstdint> // std::uint64_t
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Minimal event type for `icarus::ParallelEventLoop`.
+ *
+ * Each "input file" name is the number of events in it; the only data product
+ * is a vector with as many elements as the event index plus one.
+ */
+class TestEvent {
+
+    public:
+
+  template <typename T>
+  struct ValidHandle {
+    T data;
+    T const* operator->() const { return &data; }
+  };
+
+  TestEvent(std::vector<std::string> const& inputFiles)
+    {
+      for (std::string const& file: inputFiles) fNEvents += std::stoul(file);
+    }
+
+  bool atEnd() const { return fEntry >= fNEvents; }
+  void next() { ++fEntry; }
+
+  unsigned long entry() const { return fEntry; }
+
+  template <typename T>
+  ValidHandle<T> getValidHandle(art::InputTag const&) const
+    { return { T(fEntry + 1) }; }
+
+    private:
+  unsigned long fNEvents = 0;
+  unsigned long fEntry = 0;
+
+}; // TestEvent
+
+
+// -----------------------------------------------------------------------------
+void EventLoopResultsRoundTripTest() {
+
+  icarus::EventLoopResults results;
+  results.add("hits", 12.5);
+  results.add("hits", 3.0);
+  results.add("");
+  results.add("negative", -1e-300);
+  results.add("huge", std::numeric_limits<double>::max());
+  results.append("sizes", 1.0);
+  results.append("sizes", -2.5);
+  results.append("sizes", 1e+20);
+  results.append("other key", 0.0);
+  for (int i = 0; i < 5; ++i) results.countEvent();
+
+  std::stringstream buffer;
+  results.writeTo(buffer);
+  icarus::EventLoopResults const readBack
+    = icarus::EventLoopResults::readFrom(buffer);
+
+  BOOST_TEST(readBack.nEvents() == 5ULL);
+  BOOST_TEST(readBack.sums() == results.sums());
+  BOOST_TEST(readBack.values() == results.values());
+  BOOST_TEST(readBack.sum("hits") == 15.5);
+  BOOST_TEST(readBack.values("sizes") == results.values("sizes"));
+
+  // empty results
+  std::stringstream emptyBuffer;
+  icarus::EventLoopResults{}.writeTo(emptyBuffer);
+  icarus::EventLoopResults const empty
+    = icarus::EventLoopResults::readFrom(emptyBuffer);
+  BOOST_TEST(empty.nEvents() == 0ULL);
+  BOOST_TEST(empty.sums().empty());
+  BOOST_TEST(empty.values().empty());
+
+  // truncated data is detected
+  std::string data = buffer.str();
+  data.resize(data.size() - 4);
+  std::istringstream truncated { data };
+  BOOST_CHECK_THROW(
+    icarus::EventLoopResults::readFrom(truncated),
+    std::runtime_error
+    );
+
+  // data cut at every possible point is detected
+  for (std::size_t size = 0; size < buffer.str().size(); ++size) {
+    std::istringstream cut { buffer.str().substr(0, size) };
+    BOOST_CHECK_THROW(
+      icarus::EventLoopResults::readFrom(cut),
+      std::runtime_error
+      );
+  } // for
+
+  // absurd sizes are detected before any allocation or long loop
+  for (std::size_t const offset: { 8U, 16U }) {
+    std::string corrupted = buffer.str();
+    std::uint64_t const huge = std::numeric_limits<std::uint64_t>::max() / 2;
+    corrupted.replace(offset, sizeof(huge),
+      reinterpret_cast<char const*>(&huge), sizeof(huge));
+    std::istringstream in { corrupted };
+    BOOST_CHECK_THROW(
+      icarus::EventLoopResults::readFrom(in),
+      std::runtime_error
+      );
+  } // for
+
+} // EventLoopResultsRoundTripTest()
+
+
+// -----------------------------------------------------------------------------
+void runInWorkersTest(unsigned int nWorkers) {
+
+  constexpr unsigned int NItems = 103U;
+
+  unsigned int nLocalCalls = 0U; // changed only when running in this process
+  icarus::EventLoopResults const results = icarus::details::runInWorkers(
+    nWorkers,
+    [nWorkers,&nLocalCalls](unsigned int iWorker)
+      {
+        ++nLocalCalls;
+        icarus::EventLoopResults results;
+        results.add("calls");
+        results.append("worker", iWorker);
+        for (unsigned int i = iWorker; i < NItems; i += nWorkers) {
+          results.append("items", i);
+          results.add("sum", i);
+          results.countEvent();
+        }
+        return results;
+      }
+    );
+
+  // each worker was called exactly once
+  BOOST_TEST(results.sum("calls") == nWorkers);
+  std::vector<double> workers = results.values("worker");
+  std::sort(workers.begin(), workers.end());
+  std::vector<double> expectedWorkers(nWorkers);
+  std::iota(expectedWorkers.begin(), expectedWorkers.end(), 0.0);
+  BOOST_TEST(workers == expectedWorkers);
+
+  // each item was processed exactly once
+  BOOST_TEST(results.nEvents() == NItems);
+  std::vector<double> items = results.values("items");
+  std::sort(items.begin(), items.end());
+  std::vector<double> expectedItems(NItems);
+  std::iota(expectedItems.begin(), expectedItems.end(), 0.0);
+  BOOST_TEST(items == expectedItems);
+  BOOST_TEST(results.sum("sum") == NItems * (NItems - 1) / 2);
+
+  // a single worker runs in this process, the others in forked ones
+  BOOST_TEST(nLocalCalls == ((nWorkers <= 1)? 1U: 0U));
+
+} // runInWorkersTest()
+
+
+void runInWorkersFailureTest() {
+
+  auto const work = [](unsigned int iWorker)
+    {
+      if (iWorker == 2) throw std::runtime_error{ "worker failure" };
+      icarus::EventLoopResults results;
+      results.countEvent();
+      return results;
+    };
+  BOOST_CHECK_THROW(
+    icarus::details::runInWorkers(4U, work),
+    std::runtime_error
+    );
+
+  // a worker dying without a clean exit is a failure, too
+  auto const crash = [](unsigned int iWorker)
+    {
+      if (iWorker == 1) ::raise(SIGKILL);
+      icarus::EventLoopResults results;
+      results.countEvent();
+      return results;
+    };
+  BOOST_CHECK_THROW(
+    icarus::details::runInWorkers(3U, crash),
+    std::runtime_error
+    );
+
+} // runInWorkersFailureTest()
+
+
+// -----------------------------------------------------------------------------
+void ParallelEventLoopTest(unsigned int nWorkers) {
+
+  // two "files" with 20 and 17 events
+  icarus::ParallelEventLoop<TestEvent> loop { { "20", "17" }, nWorkers };
+  loop.addCallback([](TestEvent const& event, icarus::EventLoopResults& r)
+    { r.append("entry", event.entry()); });
+  loop.addProductSizeSum<std::vector<int>>(art::InputTag{ "data" }, "total");
+  loop.addProductSizes<std::vector<int>>(art::InputTag{ "data" }, "sizes");
+
+  // all the events
+  icarus::EventLoopResults const all = loop.run();
+  BOOST_TEST(all.nEvents() == 37ULL);
+  std::vector<double> entries = all.values("entry");
+  std::sort(entries.begin(), entries.end());
+  std::vector<double> expected(37);
+  std::iota(expected.begin(), expected.end(), 0.0);
+  BOOST_TEST(entries == expected);
+  BOOST_TEST(all.sum("total") == 37.0 * 38.0 / 2.0);
+  BOOST_TEST(all.values("sizes").size() == 37U);
+
+  // skip 5 events, then process 10
+  icarus::EventLoopResults const some = loop.run(10U, 5U);
+  BOOST_TEST(some.nEvents() == 10ULL);
+  entries = some.values("entry");
+  std::sort(entries.begin(), entries.end());
+  expected.resize(10);
+  std::iota(expected.begin(), expected.end(), 5.0);
+  BOOST_TEST(entries == expected);
+
+} // ParallelEventLoopTest()
+
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EventLoopResultsTestCase) {
+  EventLoopResultsRoundTripTest();
+} // BOOST_AUTO_TEST_CASE(EventLoopResultsTestCase)
+
+BOOST_AUTO_TEST_CASE(runInWorkersTestCase) {
+  for (unsigned int const nWorkers: { 1U, 2U, 3U, 8U })
+    BOOST_TEST_CONTEXT(nWorkers << " workers") runInWorkersTest(nWorkers);
+  runInWorkersFailureTest();
+} // BOOST_AUTO_TEST_CASE(runInWorkersTestCase)
+
+BOOST_AUTO_TEST_CASE(ParallelEventLoopTestCase) {
+  for (unsigned int const nWorkers: { 1U, 4U })
+    BOOST_TEST_CONTEXT(nWorkers << " workers") ParallelEventLoopTest(nWorkers);
+} // BOOST_AUTO_TEST_CASE(ParallelEventLoopTestCase)
+
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,208 @@
+/**
+ * @file   PipelinedEventRunner_test.cc
+ * @brief  Unit test for `icarus::PipelinedEventRunner`.
+ * @date   October 18, 2026
+ * @see    `icarusalg/gallery/helpers/C++/PipelinedEventRunner.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE PipelinedEventRunner
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_TEST()
+
+// ICARUS libraries
+#include "icarusalg/gallery/helpers/C++/PipelinedEventRunner.h"
+
+// framework libraries
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <atomic>
+#include <numeric> // std::iota()
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <thread>
+#include <type_traits> // std::is_same_v
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Minimal event type for `icarus::PipelinedEventRunner`.
+ *
+ * Two data products are available: `std::vector<int>` with as many elements as
+ * the event index plus one, and a `double` with half the event index.
+ * Reading a product of the event with index `failAt` throws an exception.
+ */
+class TestEvent {
+
+    public:
+
+  template <typename T>
+  struct ValidHandle {
+    T data;
+    T const& operator*() const { return data; }
+  };
+
+  static constexpr unsigned long NoFailure = ~0UL;
+
+  explicit TestEvent(unsigned long nEvents, unsigned long failAt = NoFailure)
+    : fNEvents{ nEvents }, fFailAt{ failAt }
+    {}
+
+  bool atEnd() const { return fEntry >= fNEvents; }
+  void next() { ++fEntry; }
+
+  unsigned long entry() const { return fEntry; }
+
+  /// Returns how many times data products were read.
+  unsigned int nFetches() const { return fNFetches; }
+
+  template <typename T>
+  ValidHandle<T> getValidHandle(art::InputTag const&) const
+    {
+      ++fNFetches;
+      if (fEntry == fFailAt) throw std::runtime_error{ "reading failure" };
+      if constexpr (std::is_same_v<T, double>) return { fEntry * 0.5 };
+      else return { T(fEntry + 1) };
+    }
+
+    private:
+  unsigned long fNEvents = 0;
+  unsigned long fFailAt = NoFailure;
+  unsigned long fEntry = 0;
+  mutable unsigned int fNFetches = 0;
+
+}; // TestEvent
+
+
+// -----------------------------------------------------------------------------
+void PipelinedEventRunnerTest(unsigned int depth) {
+
+  constexpr unsigned long NEvents = 50;
+
+  icarus::PipelinedEventRunner<TestEvent> runner { depth };
+  BOOST_TEST(runner.pipelineDepth() == depth);
+
+  std::thread::id const readingThread = std::this_thread::get_id();
+
+  // event callbacks run on the reading thread, in order
+  std::atomic<unsigned long> nRead { 0 };
+  std::vector<unsigned long> callbackEntries;
+  bool callbackOnReadingThread = true;
+  runner.addEventCallback(
+    [&](TestEvent const& event)
+      {
+        callbackEntries.push_back(event.entry());
+        if (std::this_thread::get_id() != readingThread)
+          callbackOnReadingThread = false;
+        ++nRead;
+      }
+    );
+
+  // the first task also measures how far ahead the reading thread is
+  std::vector<std::size_t> sizes;
+  unsigned long maxAhead = 0;
+  runner.addTask<std::vector<int>>(
+    [&sizes,&nRead,&maxAhead](std::vector<int> const& data)
+      {
+        maxAhead = std::max(maxAhead, nRead.load() - sizes.size());
+        sizes.push_back(data.size());
+      },
+    art::InputTag{ "data" }
+    );
+
+  // the second task shares a product with the first one
+  std::vector<double> sums;
+  runner.addTask<std::vector<int>, double>(
+    [&sums](std::vector<int> const& data, double weight)
+      { sums.push_back(data.size() + weight); },
+    art::InputTag{ "data" }, "weight"
+    );
+
+  TestEvent event { NEvents };
+  unsigned long long const nEvents = runner.run(event);
+
+  BOOST_TEST(nEvents == NEvents);
+  BOOST_TEST(event.atEnd());
+
+  // each product is read once per event
+  BOOST_TEST(event.nFetches() == 2 * NEvents);
+
+  std::vector<unsigned long> expectedEntries(NEvents);
+  std::iota(expectedEntries.begin(), expectedEntries.end(), 0UL);
+  BOOST_TEST(callbackEntries == expectedEntries);
+  BOOST_TEST(callbackOnReadingThread);
+
+  // each task saw all the events, in order
+  std::vector<std::size_t> expectedSizes(NEvents);
+  std::iota(expectedSizes.begin(), expectedSizes.end(), 1U);
+  BOOST_TEST(sizes == expectedSizes);
+  std::vector<double> expectedSums;
+  for (unsigned long i = 0; i < NEvents; ++i)
+    expectedSums.push_back((i + 1) + i * 0.5);
+  BOOST_TEST(sums == expectedSums);
+
+  // no more than `depth` events wait, besides the one being read
+  BOOST_TEST(maxAhead <= depth + 1);
+
+  // a limited number of events
+  TestEvent someEvents { NEvents };
+  sizes.clear();
+  BOOST_TEST(runner.run(someEvents, 10ULL) == 10ULL);
+  BOOST_TEST(someEvents.entry() == 10UL);
+  BOOST_TEST(sizes.size() == 10U);
+
+} // PipelinedEventRunnerTest()
+
+
+// -----------------------------------------------------------------------------
+void PipelinedEventRunnerFailureTest(unsigned int depth) {
+
+  constexpr unsigned long NEvents = 30;
+
+  // a task failure stops the loop and it's rethrown
+  {
+    icarus::PipelinedEventRunner<TestEvent> runner { depth };
+    unsigned int nProcessed = 0U;
+    runner.addTask<std::vector<int>>(
+      [&nProcessed](std::vector<int> const& data)
+        {
+          if (data.size() == 8) throw std::runtime_error{ "task failure" };
+          ++nProcessed;
+        },
+      art::InputTag{ "data" }
+      );
+    TestEvent event { NEvents };
+    BOOST_CHECK_THROW(runner.run(event), std::runtime_error);
+    BOOST_TEST(nProcessed == 7U);
+  }
+
+  // a reading failure stops the tasks and it's rethrown
+  {
+    icarus::PipelinedEventRunner<TestEvent> runner { depth };
+    std::atomic<unsigned int> nProcessed { 0U };
+    runner.addTask<double>
+      ([&nProcessed](double){ ++nProcessed; }, art::InputTag{ "weight" });
+    TestEvent event { NEvents, 12UL };
+    BOOST_CHECK_THROW(runner.run(event), std::runtime_error);
+    BOOST_TEST(nProcessed.load() <= 12U);
+  }
+
+} // PipelinedEventRunnerFailureTest()
+
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PipelinedEventRunnerTestCase) {
+  for (unsigned int const depth: { 0U, 1U, 2U, 8U })
+    BOOST_TEST_CONTEXT("depth " << depth) PipelinedEventRunnerTest(depth);
+} // BOOST_AUTO_TEST_CASE(PipelinedEventRunnerTestCase)
+
+BOOST_AUTO_TEST_CASE(PipelinedEventRunnerFailureTestCase) {
+  for (unsigned int const depth: { 0U, 2U })
+    BOOST_TEST_CONTEXT("depth " << depth) PipelinedEventRunnerFailureTest(depth);
+} // BOOST_AUTO_TEST_CASE(PipelinedEventRunnerFailureTestCase)
+
+
+// -----------------------------------------------------------------------------